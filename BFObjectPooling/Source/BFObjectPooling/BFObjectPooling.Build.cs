@@ -15,6 +15,7 @@ public class BFObjectPooling : ModuleRules
                 "UMG",          // UUserWidget pools
                 "Niagara",      // Niagara pools
                 "GameplayTags", // Pooled object tag support
+                "DeveloperSettings", // Pool sizing profiles
             }
         );
 
@@ -23,6 +24,8 @@ public class BFObjectPooling : ModuleRules
             {
                 "CoreUObject",
                 "Engine",
+                "RenderCore",   // PSO precaching for bWarmupAssets
+                "AnimationBudgetAllocator", // Budgeted poolable skeletal meshes
                 "Slate",
                 "SlateCore",
             }
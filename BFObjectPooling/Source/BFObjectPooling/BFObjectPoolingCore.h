@@ -7,11 +7,15 @@
 #include "BFObjectPooling/Module/BFObjectPooling.h" // CVars inside BF::OP namespace
 #include "BFObjectPooling/Interfaces/BFPooledObjectInterface.h"
 #include "BFObjectPooling/Pool/BFPooledObjectHandle.h"
+#include "BFObjectPooling/Pool/BFPooledObjectLiteHandle.h"
 #include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "BFObjectPooling/Pool/BFObjectPoolGroup.h"
+#include "BFObjectPooling/Pool/BFObjectPoolSubsystem.h"
 #include "BFObjectPooling/Pool/Private/BFPoolContainer.h"
 
 
 #include "BFObjectPooling/GameplayActors/BFPoolableActorHelpers.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableActorPresets.h"
 #include "BFObjectPooling/GameplayActors/BFPoolableDecalActor.h"
 #include "BFObjectPooling/GameplayActors/BFPoolableNiagaraActor.h"
 #include "BFObjectPooling/GameplayActors/BFPoolableProjectileActor.h"
@@ -0,0 +1,81 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "CoreMinimal.h"
+
+
+namespace BF::OP
+{
+	/* Slot bookkeeping for the subsystems that batch per object state into parallel arrays (UBFProjectileSimulationSubsystem, UBFPoolable3DWidgetAnimationSubsystem).
+	 * Objects is the subsystems UPROPERTY array and owns the slot order, every live object stores its own index in SlotMember. RemoveAttributes(Index) has to RemoveAtSwap
+	 * Index out of every other parallel array so they stay in step. While bDeferRemoval is set the owner is iterating and indices have to stay put, removal only nulls
+	 * the slot and Compact removes them once iteration is done. */
+	struct FBFBatchedSlots
+	{
+		template<typename ObjectType>
+		int32 GetNumLive(const TArray<TObjectPtr<ObjectType>>& Objects) const { return Objects.Num() - NumPendingRemoval; }
+
+		// Clears the objects slot index, the slot itself is removed now or on the next Compact.
+		template<typename ObjectType, typename RemoveAttributesFunc>
+		void Remove(TArray<TObjectPtr<ObjectType>>& Objects, int32 ObjectType::* SlotMember, int32 Index, RemoveAttributesFunc&& RemoveAttributes)
+		{
+			Objects[Index].Get()->*SlotMember = INDEX_NONE;
+			if(bDeferRemoval)
+				MarkPendingRemoval(Objects, Index);
+			else
+				RemoveAtSwap(Objects, SlotMember, Index, RemoveAttributes);
+		}
+
+		// For objects destroyed without being removed, there is no slot index left to clear.
+		template<typename ObjectType>
+		void MarkPendingRemoval(TArray<TObjectPtr<ObjectType>>& Objects, int32 Index)
+		{
+			Objects[Index] = nullptr;
+			++NumPendingRemoval;
+		}
+
+		template<typename ObjectType, typename RemoveAttributesFunc>
+		void Compact(TArray<TObjectPtr<ObjectType>>& Objects, int32 ObjectType::* SlotMember, RemoveAttributesFunc&& RemoveAttributes)
+		{
+			// Back to front so every entry swapped into a hole has already been checked.
+			for(int32 Index = Objects.Num() - 1; Index >= 0 && NumPendingRemoval > 0; --Index)
+			{
+				if(!Objects[Index])
+				{
+					RemoveAtSwap(Objects, SlotMember, Index, RemoveAttributes);
+					--NumPendingRemoval;
+				}
+			}
+			NumPendingRemoval = 0;
+		}
+
+		// Removes every slot, clearing the slot index of every object still in one.
+		template<typename ObjectType, typename RemoveAttributesFunc>
+		void Reset(TArray<TObjectPtr<ObjectType>>& Objects, int32 ObjectType::* SlotMember, RemoveAttributesFunc&& RemoveAttributes)
+		{
+			for(int32 Index = Objects.Num() - 1; Index >= 0; --Index)
+			{
+				if(Objects[Index])
+					Objects[Index].Get()->*SlotMember = INDEX_NONE;
+				RemoveAtSwap(Objects, SlotMember, Index, RemoveAttributes);
+			}
+			NumPendingRemoval = 0;
+		}
+
+		int32 NumPendingRemoval = 0;
+		bool bDeferRemoval = false;
+
+	private:
+		template<typename ObjectType, typename RemoveAttributesFunc>
+		static void RemoveAtSwap(TArray<TObjectPtr<ObjectType>>& Objects, int32 ObjectType::* SlotMember, int32 Index, RemoveAttributesFunc& RemoveAttributes)
+		{
+			Objects.RemoveAtSwap(Index);
+			RemoveAttributes(Index);
+
+			// Whatever was last now lives here.
+			if(Objects.IsValidIndex(Index) && Objects[Index])
+				Objects[Index].Get()->*SlotMember = Index;
+		}
+	};
+}
@@ -0,0 +1,154 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFDecalRingPool.h"
+#include "Components/DecalComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "BFObjectPooling/Module/BFObjectPooling.h"
+
+
+UBFDecalRingPool::UBFDecalRingPool()
+{
+	// Nothing to do per frame, the slots materials do the fading.
+	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+
+UBFDecalRingPool* UBFDecalRingPool::CreatePool(AActor* Owner, const FBFDecalRingPoolInitParams& Params)
+{
+	bfValid(Owner);
+	if(!Owner)
+		return nullptr;
+
+	UBFDecalRingPool* Pool = NewObject<UBFDecalRingPool>(Owner, NAME_None, RF_Transient);
+	Owner->AddInstanceComponent(Pool);
+	Pool->RegisterComponent();
+	Pool->InitPool(Params);
+	return Pool;
+}
+
+
+void UBFDecalRingPool::InitPool(const FBFDecalRingPoolInitParams& Params)
+{
+	bfEnsure(SlotComponents.Num() == 0); // Already initialized.
+	bfEnsure(Params.RingSize > 0);
+	AActor* Owner = GetOwner();
+	if(SlotComponents.Num() > 0 || !Owner)
+		return;
+	
+	InitInfo = Params;
+	const int32 RingSize = FMath::Max(1, InitInfo.RingSize);
+	SlotComponents.Reserve(RingSize);
+	SlotMaterials.SetNum(RingSize);
+	
+	for(int32 i = 0; i < RingSize; ++i)
+	{
+		UDecalComponent* Component = NewObject<UDecalComponent>(Owner, NAME_None, RF_Transient);
+		
+		// Decals are placed in world space, the owner moving shouldn't drag every bullet hole with it.
+		Component->SetUsingAbsoluteLocation(true);
+		Component->SetUsingAbsoluteRotation(true);
+		Component->SetUsingAbsoluteScale(true);
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->SetVisibility(false);
+		Component->SetupAttachment(Owner->GetRootComponent());
+		Owner->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+		SlotComponents.Add(Component);
+	}
+}
+
+
+int32 UBFDecalRingPool::SpawnDecal(const FBFPoolableDecalActorDescription& Description, const FTransform& Transform)
+{
+	bfEnsure(!Description.DecalMaterial.IsNull()); // You must set the decal material.
+	bfEnsure(SlotComponents.Num() > 0); // You must call InitPool (or CreatePool) first.
+	if(Description.DecalMaterial.IsNull() || SlotComponents.Num() == 0)
+		return INDEX_NONE;
+
+	const int32 SlotIndex = NextSlot;
+	UDecalComponent* Component = SlotComponents[SlotIndex];
+	if(!IsValid(Component))
+		return INDEX_NONE;
+	
+	NextSlot = (NextSlot + 1) % SlotComponents.Num();
+	NumUsedSlots = FMath::Min(NumUsedSlots + 1, SlotComponents.Num());
+
+	UMaterialInstanceDynamic* Material = GetOrCreateSlotMaterial(SlotIndex, BF::OP::ResolveSoftAsset(Description.DecalMaterial));
+	if(!Material)
+		return INDEX_NONE;
+	
+	Material->SetScalarParameterValue(InitInfo.SpawnTimeParameterName, GetWorld()->GetTimeSeconds());
+	Material->SetScalarParameterValue(InitInfo.FadeInParameterName, FMath::Max(Description.FadeInTime, KINDA_SMALL_NUMBER));
+	Material->SetScalarParameterValue(InitInfo.LifetimeParameterName, FMath::Max(Description.ActorCurfew, 0.f));
+	Material->SetScalarParameterValue(InitInfo.FadeOutParameterName, FMath::Max(Description.FadeOutTime, KINDA_SMALL_NUMBER));
+
+	// Only size, sort order or a new material need the render state recreated, moving the decal is just a transform update.
+	if(Component->DecalSize != Description.DecalExtent)
+	{
+		Component->DecalSize = Description.DecalExtent;
+		Component->MarkRenderStateDirty();
+	}
+	if(Component->SortOrder != Description.SortOrder)
+		Component->SetSortOrder(Description.SortOrder);
+	if(!Component->IsVisible())
+		Component->SetVisibility(true);
+	
+	Component->SetWorldTransform(Transform);
+	return SlotIndex;
+}
+
+
+int32 UBFDecalRingPool::SpawnDecalWithPreset(const UBFPoolableDecalActorPreset* Preset, const FTransform& Transform)
+{
+	bfValid(Preset);
+	if(!Preset)
+		return INDEX_NONE;
+	return SpawnDecal(Preset->Description, Transform);
+}
+
+
+void UBFDecalRingPool::ClearRing()
+{
+	for(UDecalComponent* Component : SlotComponents)
+	{
+		if(IsValid(Component))
+			Component->SetVisibility(false);
+	}
+	NextSlot = 0;
+	NumUsedSlots = 0;
+}
+
+
+void UBFDecalRingPool::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	for(UDecalComponent* Component : SlotComponents)
+	{
+		if(IsValid(Component))
+			Component->DestroyComponent();
+	}
+	SlotComponents.Reset();
+	SlotMaterials.Reset();
+	NextSlot = 0;
+	NumUsedSlots = 0;
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+
+UMaterialInstanceDynamic* UBFDecalRingPool::GetOrCreateSlotMaterial(int32 SlotIndex, UMaterialInterface* Material)
+{
+	if(!Material)
+		return nullptr;
+	
+	// Same material as this slot last drew, the instance just gets new parameters.
+	TObjectPtr<UMaterialInstanceDynamic>& SlotMaterial = SlotMaterials[SlotIndex];
+	if(SlotMaterial && SlotMaterial->Parent == Material)
+		return SlotMaterial;
+
+	// Every slot needs its own instance, even for a material that is already dynamic, since the fade parameters are per decal.
+	SlotMaterial = UMaterialInstanceDynamic::Create(Material, this);
+	
+	SlotComponents[SlotIndex]->SetDecalMaterial(SlotMaterial);
+	return SlotMaterial;
+}
@@ -0,0 +1,99 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Components/ActorComponent.h"
+#include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
+#include "BFDecalRingPool.generated.h"
+
+
+class UDecalComponent;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+
+USTRUCT(BlueprintType, meta=(DisplayName="BF Decal Ring Pool Init Params"))
+struct FBFDecalRingPoolInitParams
+{
+	GENERATED_BODY()
+public:
+	// Number of decal components, all created and registered up front. Once every slot is used each new decal overwrites the oldest one.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(ClampMin="1"))
+	int32 RingSize = 64;
+
+	/* Scalar parameters set on each slots dynamic material instance, the fade is done in the material from these so nothing runs per frame. With Time being the
+	 * materials Time node, Alpha = saturate((Time - SpawnTime) / FadeIn) * (Lifetime > 0 ? saturate((SpawnTime + Lifetime + FadeOut - Time) / FadeOut) : 1).
+	 * SpawnTime is in world seconds, FadeIn/FadeOut are the descriptions FadeInTime/FadeOutTime and Lifetime is its ActorCurfew (how long it stays fully visible, 0 if not set). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FName SpawnTimeParameterName = "BFSpawnTime";
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FName FadeInParameterName = "BFFadeInTime";
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FName LifetimeParameterName = "BFLifetime";
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FName FadeOutParameterName = "BFFadeOutTime";
+};
+
+
+/** UBFDecalRingPool:
+ * Ring buffer alternative to pooling ABFPoolableDecalActor for high volume persistent decals (bullet holes, blood splats). A fixed number of decal components stay
+ * registered for the lifetime of the pool and SpawnDecal overwrites the oldest one in place (transform, material, size, sort order and fade parameters), there is
+ * no un-pool/return cycle, no curfew and no fade timer. Fading is done by the slots material from the spawn time, see FBFDecalRingPoolInitParams.
+ *
+ * Each slot keeps a dynamic material instance of the last material it drew, spawning with the same material only sets its scalar parameters.
+ * Added to the owning actor via CreatePool, which also owns the decal components. */
+UCLASS(ClassGroup=(BFObjectPooling), meta=(DisplayName="BF Decal Ring Pool"))
+class BFOBJECTPOOLING_API UBFDecalRingPool : public UActorComponent
+{
+	GENERATED_BODY()
+public:
+	UBFDecalRingPool();
+	
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	static UBFDecalRingPool* CreatePool(AActor* Owner, const FBFDecalRingPoolInitParams& Params);
+	
+	virtual void InitPool(const FBFDecalRingPoolInitParams& Params);
+	
+	// Places the description at Transform in the oldest slot and returns the slot index, INDEX_NONE if the pool isn't initialized or the description has no material.
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	virtual int32 SpawnDecal(const FBFPoolableDecalActorDescription& Description, const FTransform& Transform);
+
+	// Same as SpawnDecal but reads the immutable presets description.
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	int32 SpawnDecalWithPreset(const UBFPoolableDecalActorPreset* Preset, const FTransform& Transform);
+	
+	// Hides every slot and restarts the ring, slots keep their components and material instances.
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	virtual void ClearRing();
+
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	UDecalComponent* GetDecalComponent(int32 SlotIndex) const { return SlotComponents.IsValidIndex(SlotIndex) ? SlotComponents[SlotIndex] : nullptr; }
+	
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	int32 GetRingSize() const { return SlotComponents.Num(); }
+	
+	// Slots that are currently showing a decal, reaches GetRingSize once the ring has wrapped.
+	UFUNCTION(BlueprintCallable, Category="BF| Decal Ring Pool")
+	int32 GetNumUsedSlots() const { return NumUsedSlots; }
+	const FBFDecalRingPoolInitParams& GetPoolInitInfo() const { return InitInfo; }
+	
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+protected:
+	UMaterialInstanceDynamic* GetOrCreateSlotMaterial(int32 SlotIndex, UMaterialInterface* Material);
+
+protected:
+	FBFDecalRingPoolInitParams InitInfo;
+	
+	// Indexed by slot, a slots material instance is null until it first draws a decal.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDecalComponent>> SlotComponents;
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> SlotMaterials;
+	int32 NextSlot = 0;
+	int32 NumUsedSlots = 0;
+};
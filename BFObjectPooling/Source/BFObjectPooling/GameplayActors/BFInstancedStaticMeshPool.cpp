@@ -0,0 +1,447 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFInstancedStaticMeshPool.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "BFObjectPooling/Module/BFObjectPooling.h"
+
+
+namespace BF::OP
+{
+	// Returned instances are collapsed rather than removed, they are only removed (last instance first) when their slot moves to another batch.
+	static const FTransform CollapsedInstanceTransform = FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	static constexpr int32 NumFadeCustomDataFloats = 2;
+}
+
+
+bool FBFInstancedMeshHandle::IsHandleValid() const
+{
+	if(PromotedHandle.IsValid())
+		return PromotedHandle->IsHandleValid();
+	return Pool.IsValid() && Pool->IsCheckoutValid(SlotIndex, CheckoutID);
+}
+
+
+bool FBFInstancedMeshHandle::ReturnToPool()
+{
+	const bool bReturned = PromotedHandle.IsValid() ? PromotedHandle->IsHandleValid() && PromotedHandle->ReturnToPool()
+		: Pool.IsValid() && Pool->ReturnToPool(SlotIndex, CheckoutID);
+	Reset();
+	return bReturned;
+}
+
+
+bool FBFInstancedMeshHandle::SetCurfew(float Seconds) const
+{
+	if(PromotedHandle.IsValid())
+	{
+		if(!PromotedHandle->IsHandleValid())
+			return false;
+		PromotedHandle->GetObject()->SetCurfew(Seconds);
+		return true;
+	}
+	return Pool.IsValid() && Pool->SetCurfew(SlotIndex, CheckoutID, Seconds);
+}
+
+
+bool FBFInstancedMeshHandle::ClearCurfew() const
+{
+	if(PromotedHandle.IsValid())
+	{
+		if(!PromotedHandle->IsHandleValid())
+			return false;
+		PromotedHandle->GetObject()->RemoveCurfew();
+		return true;
+	}
+	return Pool.IsValid() && Pool->ClearCurfew(SlotIndex, CheckoutID);
+}
+
+
+bool FBFInstancedMeshHandle::SetTransform(const FTransform& Transform) const
+{
+	if(PromotedHandle.IsValid())
+	{
+		if(!PromotedHandle->IsHandleValid())
+			return false;
+		PromotedHandle->GetObject()->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+		return true;
+	}
+	return Pool.IsValid() && Pool->SetInstanceTransform(SlotIndex, CheckoutID, Transform);
+}
+
+
+ABFPoolableStaticMeshActor* FBFInstancedMeshHandle::GetPromotedActor() const
+{
+	return PromotedHandle.IsValid() && PromotedHandle->IsHandleValid() ? PromotedHandle->GetObject() : nullptr;
+}
+
+
+UBFInstancedStaticMeshPool::UBFInstancedStaticMeshPool()
+{
+	// Only ticks while there are curfews pending or components to mark dirty.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+
+UBFInstancedStaticMeshPool* UBFInstancedStaticMeshPool::CreatePool(AActor* Owner, const FBFInstancedStaticMeshPoolInitParams& Params)
+{
+	bfValid(Owner);
+	if(!Owner)
+		return nullptr;
+
+	UBFInstancedStaticMeshPool* Pool = NewObject<UBFInstancedStaticMeshPool>(Owner, NAME_None, RF_Transient);
+	Owner->AddInstanceComponent(Pool);
+	Pool->RegisterComponent();
+	Pool->InitPool(Params);
+	return Pool;
+}
+
+
+void UBFInstancedStaticMeshPool::InitPool(const FBFInstancedStaticMeshPoolInitParams& Params)
+{
+	bfEnsure(Slots.Num() == 0); // Already initialized.
+	InitInfo = Params;
+	Slots.Reserve(InitInfo.PoolLimit);
+}
+
+
+FBFInstancedMeshHandle UBFInstancedStaticMeshPool::UnpoolInstance(const FBFPoolableStaticMeshActorDescription& Description, const FTransform& Transform, TConstArrayView<float> CustomData)
+{
+	bfEnsure(!Description.Mesh.IsNull()); // You must set the mesh.
+	if(Description.bSimulatePhysics)
+		return PromoteToActor(Description, Transform);
+
+	if(Description.Mesh.IsNull() || !GetOwner())
+		return {};
+	
+	const int32 BatchIndex = FindOrAddBatch(Description);
+	FInstanceBatch& Batch = Batches[BatchIndex];
+	UInstancedStaticMeshComponent* Component = BatchComponents[BatchIndex];
+	
+	int32 SlotIndex = INDEX_NONE;
+	if(Batch.FreeSlots.Num() > 0)
+	{
+		SlotIndex = Batch.FreeSlots.Pop();
+	}
+	else if(Slots.Num() < InitInfo.PoolLimit)
+	{
+		FInstanceSlot& NewSlot = Slots.AddDefaulted_GetRef();
+		NewSlot.BatchIndex = BatchIndex;
+		NewSlot.InstanceIndex = Component->AddInstance(BF::OP::CollapsedInstanceTransform, true);
+		SlotIndex = Slots.Num() - 1;
+		Batch.InstanceSlots.Add(SlotIndex);
+	}
+	else
+	{
+		SlotIndex = ReclaimFreeSlot(BatchIndex);
+		if(SlotIndex == INDEX_NONE)
+		{
+#if !UE_BUILD_SHIPPING
+			if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+				UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Instanced static mesh pool on {0} is at its PoolLimit of {1}.", GetOwner()->GetName(), InitInfo.PoolLimit);
+#endif
+			return {};
+		}
+	}
+
+	FInstanceSlot& Slot = Slots[SlotIndex];
+	Slot.bActive = true;
+	++NumActive;
+	
+	Component->UpdateInstanceTransform(Slot.InstanceIndex, Description.RelativeTransform * Transform, true, false, true);
+	SetFadeCustomData(Slot, 0.f, 0.f);
+	for(int32 i = 0; i < FMath::Min(CustomData.Num(), InitInfo.NumCustomDataFloats); ++i)
+		Component->SetCustomDataValue(Slot.InstanceIndex, BF::OP::NumFadeCustomDataFloats + i, CustomData[i], false);
+	MarkBatchDirty(BatchIndex);
+	
+	if(Description.ActorCurfew > 0)
+		SetCurfew(SlotIndex, Slot.CheckoutID, Description.ActorCurfew);
+
+	FBFInstancedMeshHandle Handle;
+	Handle.Pool = this;
+	Handle.SlotIndex = SlotIndex;
+	Handle.CheckoutID = Slot.CheckoutID;
+	return Handle;
+}
+
+
+void UBFInstancedStaticMeshPool::UnpoolInstanceBP(const FBFPoolableStaticMeshActorDescription& Description, const FTransform& Transform, const TArray<float>& CustomData, EBFSuccess& ReturnValue, FBFInstancedMeshHandle& Handle)
+{
+	Handle = UnpoolInstance(Description, Transform, CustomData);
+	ReturnValue = BF::OP::ToBPSuccessEnum(Handle.IsHandleValid());
+}
+
+
+bool UBFInstancedStaticMeshPool::ReturnToPool(int32 SlotIndex, int32 CheckoutID)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID))
+		return false;
+
+	FInstanceSlot& Slot = Slots[SlotIndex];
+	Slot.bActive = false;
+	Slot.CheckoutID = BF::OP::NextCheckoutID(Slot.CheckoutID);
+	Slot.CurfewTime = -1.f; // Its heap entry is skipped when popped.
+	--NumActive;
+
+	if(IsValid(BatchComponents[Slot.BatchIndex]))
+		CollapseInstance(Slot);
+	
+	Batches[Slot.BatchIndex].FreeSlots.Add(SlotIndex);
+	MarkBatchDirty(Slot.BatchIndex);
+	return true;
+}
+
+
+bool UBFInstancedStaticMeshPool::SetCurfew(int32 SlotIndex, int32 CheckoutID, float Seconds)
+{
+	bfEnsure(Seconds > 0);
+	if(!IsCheckoutValid(SlotIndex, CheckoutID) || Seconds <= 0)
+		return false;
+
+	FInstanceSlot& Slot = Slots[SlotIndex];
+	Slot.CurfewTime = GetWorld()->GetTimeSeconds() + Seconds;
+	CurfewHeap.HeapPush({Slot.CurfewTime, SlotIndex, CheckoutID});
+
+	// The material does the actual fade from these, nothing to do per frame.
+	if(InitInfo.FadeOutSeconds > 0)
+		SetFadeCustomData(Slot, Slot.CurfewTime - FMath::Min(InitInfo.FadeOutSeconds, Seconds), Slot.CurfewTime);
+	
+	SetComponentTickEnabled(true);
+	return true;
+}
+
+
+bool UBFInstancedStaticMeshPool::ClearCurfew(int32 SlotIndex, int32 CheckoutID)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID))
+		return false;
+
+	FInstanceSlot& Slot = Slots[SlotIndex];
+	if(Slot.CurfewTime >= 0 && InitInfo.FadeOutSeconds > 0)
+		SetFadeCustomData(Slot, 0.f, 0.f);
+	Slot.CurfewTime = -1.f;
+	return true;
+}
+
+
+bool UBFInstancedStaticMeshPool::SetInstanceTransform(int32 SlotIndex, int32 CheckoutID, const FTransform& Transform)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID))
+		return false;
+
+	const FInstanceSlot& Slot = Slots[SlotIndex];
+	BatchComponents[Slot.BatchIndex]->UpdateInstanceTransform(Slot.InstanceIndex, Transform, true, false, true);
+	MarkBatchDirty(Slot.BatchIndex);
+	return true;
+}
+
+
+void UBFInstancedStaticMeshPool::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	SCOPED_NAMED_EVENT(UBFInstancedStaticMeshPool_Tick, FColor::Green);
+
+	const float TimeNow = GetWorld()->GetTimeSeconds();
+	while(CurfewHeap.Num() > 0 && CurfewHeap.HeapTop().ExpireTime <= TimeNow)
+	{
+		FInstanceCurfew Curfew;
+		CurfewHeap.HeapPop(Curfew);
+
+		// Stale if the checkout was returned or its curfew was cleared/replaced since.
+		if(IsCheckoutValid(Curfew.SlotIndex, Curfew.CheckoutID) && Slots[Curfew.SlotIndex].CurfewTime == Curfew.ExpireTime)
+			ReturnToPool(Curfew.SlotIndex, Curfew.CheckoutID);
+	}
+
+	// Every transform/custom data change this frame is sent to the render thread in one go per component.
+	if(bHasDirtyBatches)
+	{
+		for(int32 i = 0; i < Batches.Num(); ++i)
+		{
+			if(Batches[i].bRenderStateDirty && IsValid(BatchComponents[i]))
+				BatchComponents[i]->MarkRenderStateDirty();
+			Batches[i].bRenderStateDirty = false;
+		}
+		bHasDirtyBatches = false;
+	}
+
+	if(CurfewHeap.Num() == 0)
+		SetComponentTickEnabled(false);
+}
+
+
+void UBFInstancedStaticMeshPool::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	for(UInstancedStaticMeshComponent* Component : BatchComponents)
+	{
+		if(IsValid(Component))
+			Component->DestroyComponent();
+	}
+	BatchComponents.Reset();
+	Batches.Reset();
+	Slots.Reset();
+	CurfewHeap.Reset();
+	PromotionPool.Reset();
+	NumActive = 0;
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+
+int32 UBFInstancedStaticMeshPool::FindOrAddBatch(const FBFPoolableStaticMeshActorDescription& Description)
+{
+	for(int32 i = 0; i < Batches.Num(); ++i)
+	{
+		// Collision is set per component so it is part of the key too, otherwise a description would silently get another descriptions collision.
+		const FInstanceBatch& Batch = Batches[i];
+		if(Batch.Mesh != Description.Mesh || Batch.Materials.Num() != Description.Materials.Num() || Batch.CollisionProfile != Description.CollisionProfile.Name
+			|| Batch.CollisionEnabled != Description.CollisionEnabled)
+			continue;
+
+		bool bSameMaterials = true;
+		for(int32 j = 0; j < Batch.Materials.Num() && bSameMaterials; ++j)
+			bSameMaterials = Batch.Materials[j].Material == Description.Materials[j].Material && Batch.Materials[j].MaterialIndex == Description.Materials[j].MaterialIndex;
+		
+		if(bSameMaterials)
+			return i;
+	}
+
+	AActor* Owner = GetOwner();
+	UInstancedStaticMeshComponent* Component = InitInfo.PoolType == EBFInstancedPoolType::HierarchicalInstancedStaticMesh
+		? NewObject<UHierarchicalInstancedStaticMeshComponent>(Owner, NAME_None, RF_Transient)
+		: NewObject<UInstancedStaticMeshComponent>(Owner, NAME_None, RF_Transient);
+
+	// Instances are in world space, so the component sits at the origin regardless of where the owner is or goes.
+	Component->SetUsingAbsoluteLocation(true);
+	Component->SetUsingAbsoluteRotation(true);
+	Component->SetUsingAbsoluteScale(true);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetStaticMesh(BF::OP::ResolveSoftAsset(Description.Mesh));
+	for(const auto& [Material, Slot] : Description.Materials)
+		Component->SetMaterial(Slot, BF::OP::ResolveSoftAsset(Material));
+	Component->SetCollisionProfileName(Description.CollisionProfile.Name);
+	Component->SetCollisionEnabled(Description.CollisionEnabled);
+	Component->NumCustomDataFloats = BF::OP::NumFadeCustomDataFloats + InitInfo.NumCustomDataFloats;
+	Component->SetupAttachment(Owner->GetRootComponent());
+	Owner->AddInstanceComponent(Component);
+	Component->RegisterComponent();
+	Component->SetWorldTransform(FTransform::Identity);
+	
+	FInstanceBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Mesh = Description.Mesh;
+	Batch.Materials = Description.Materials;
+	Batch.CollisionProfile = Description.CollisionProfile.Name;
+	Batch.CollisionEnabled = Description.CollisionEnabled;
+	BatchComponents.Add(Component);
+	return Batches.Num() - 1;
+}
+
+
+int32 UBFInstancedStaticMeshPool::ReclaimFreeSlot(int32 BatchIndex)
+{
+	for(int32 DonorIndex = 0; DonorIndex < Batches.Num(); ++DonorIndex)
+	{
+		if(DonorIndex == BatchIndex || Batches[DonorIndex].FreeSlots.Num() == 0 || !IsValid(BatchComponents[DonorIndex]))
+			continue;
+
+		const int32 SlotIndex = Batches[DonorIndex].FreeSlots.Pop();
+		RemoveBatchInstance(DonorIndex, Slots[SlotIndex].InstanceIndex);
+
+		// Same slot (and so the same checkout ID sequence), just an instance of another component now.
+		FInstanceSlot& Slot = Slots[SlotIndex];
+		Slot.BatchIndex = BatchIndex;
+		Slot.InstanceIndex = BatchComponents[BatchIndex]->AddInstance(BF::OP::CollapsedInstanceTransform, true);
+		Batches[BatchIndex].InstanceSlots.Add(SlotIndex);
+		CollapseInstance(Slot);
+		return SlotIndex;
+	}
+	return INDEX_NONE;
+}
+
+
+void UBFInstancedStaticMeshPool::RemoveBatchInstance(int32 BatchIndex, int32 InstanceIndex)
+{
+	FInstanceBatch& Batch = Batches[BatchIndex];
+	UInstancedStaticMeshComponent* Component = BatchComponents[BatchIndex];
+	const int32 LastIndex = Batch.InstanceSlots.Num() - 1;
+	
+	// Removing anything but the last instance would shift (ISM) or swap (HISM) other instances indices under their handles.
+	if(InstanceIndex != LastIndex)
+	{
+		const int32 MovedSlot = Batch.InstanceSlots[LastIndex];
+		FTransform Transform;
+		Component->GetInstanceTransform(LastIndex, Transform, true);
+		Component->UpdateInstanceTransform(InstanceIndex, Transform, true, false, true);
+		for(int32 i = 0; i < Component->NumCustomDataFloats; ++i)
+			Component->SetCustomDataValue(InstanceIndex, i, Component->PerInstanceSMCustomData[LastIndex * Component->NumCustomDataFloats + i], false);
+		
+		Slots[MovedSlot].InstanceIndex = InstanceIndex;
+		Batch.InstanceSlots[InstanceIndex] = MovedSlot;
+	}
+	
+	Component->RemoveInstance(LastIndex);
+	Batch.InstanceSlots.Pop();
+	MarkBatchDirty(BatchIndex);
+}
+
+
+void UBFInstancedStaticMeshPool::CollapseInstance(const FInstanceSlot& Slot)
+{
+	UInstancedStaticMeshComponent* Component = BatchComponents[Slot.BatchIndex];
+	Component->UpdateInstanceTransform(Slot.InstanceIndex, BF::OP::CollapsedInstanceTransform, true, false, true);
+
+	// Zero scale instances shouldn't keep a body, make sure of it so nothing can collide with a returned instance. Un-pooling gives it a new one.
+	if(Component->InstanceBodies.IsValidIndex(Slot.InstanceIndex) && Component->InstanceBodies[Slot.InstanceIndex])
+	{
+		Component->InstanceBodies[Slot.InstanceIndex]->TermBody();
+		delete Component->InstanceBodies[Slot.InstanceIndex];
+		Component->InstanceBodies[Slot.InstanceIndex] = nullptr;
+	}
+}
+
+
+FBFInstancedMeshHandle UBFInstancedStaticMeshPool::PromoteToActor(const FBFPoolableStaticMeshActorDescription& Description, const FTransform& Transform)
+{
+	if(!PromotionPool.IsValid())
+	{
+		FBFObjectPoolInitParams Params;
+		Params.Owner = GetOwner();
+		Params.PoolClass = InitInfo.PromotionActorClass ? InitInfo.PromotionActorClass.Get() : ABFPoolableStaticMeshActor::StaticClass();
+		Params.PoolType = EBFPoolType::Actor;
+		Params.PoolLimit = InitInfo.PromotionPoolLimit;
+		PromotionPool = TBFObjectPool<ABFPoolableStaticMeshActor>::CreatePool();
+		PromotionPool->InitPool(Params);
+	}
+
+	TBFPooledObjectHandlePtr<ABFPoolableStaticMeshActor> ActorHandle = PromotionPool->UnpoolObject(false);
+	if(!ActorHandle.IsValid() || !ActorHandle->IsHandleValid())
+		return {};
+
+	// FireAndForget takes the handle it is given so we keep our own reference, the actor still returns itself like any other fire and forget actor.
+	FBFInstancedMeshHandle Handle;
+	Handle.Pool = this;
+	Handle.PromotedHandle = ActorHandle;
+	ActorHandle->GetObject()->FireAndForget(ActorHandle, Description, Transform);
+	return Handle;
+}
+
+
+void UBFInstancedStaticMeshPool::SetFadeCustomData(const FInstanceSlot& Slot, float FadeStart, float FadeEnd)
+{
+	UInstancedStaticMeshComponent* Component = BatchComponents[Slot.BatchIndex];
+	Component->SetCustomDataValue(Slot.InstanceIndex, 0, FadeStart, false);
+	Component->SetCustomDataValue(Slot.InstanceIndex, 1, FadeEnd, false);
+	MarkBatchDirty(Slot.BatchIndex);
+}
+
+
+void UBFInstancedStaticMeshPool::MarkBatchDirty(int32 BatchIndex)
+{
+	Batches[BatchIndex].bRenderStateDirty = true;
+	if(!bHasDirtyBatches)
+	{
+		bHasDirtyBatches = true;
+		SetComponentTickEnabled(true);
+	}
+}
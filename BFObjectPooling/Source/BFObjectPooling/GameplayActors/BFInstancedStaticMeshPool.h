@@ -0,0 +1,179 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Components/ActorComponent.h"
+#include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "BFPoolableActorHelpers.h"
+#include "BFPoolableStaticMeshActor.h"
+#include "BFInstancedStaticMeshPool.generated.h"
+
+
+class UInstancedStaticMeshComponent;
+class UBFInstancedStaticMeshPool;
+
+
+/** A checkout of one instance from a UBFInstancedStaticMeshPool (or of a promoted ABFPoolableStaticMeshActor), same idea as a lite handle, a slot index and checkout ID so copies
+ * are free and stale copies just fail. Unlike the shared pool handles dropping it doesn't return the instance, the descriptions ActorCurfew or ReturnToPool() does. */
+USTRUCT(BlueprintType, meta=(DisplayName="BF Instanced Mesh Handle"))
+struct BFOBJECTPOOLING_API FBFInstancedMeshHandle
+{
+	GENERATED_BODY()
+public:
+	bool IsHandleValid() const;
+	bool ReturnToPool();
+	bool SetCurfew(float Seconds) const;
+	bool ClearCurfew() const;
+	bool SetTransform(const FTransform& Transform) const;
+	
+	// Physics simulating descriptions are promoted to a real actor from the pools promotion pool, these forward to it.
+	bool IsPromoted() const { return PromotedHandle.IsValid(); }
+	ABFPoolableStaticMeshActor* GetPromotedActor() const;
+	void Reset() { *this = FBFInstancedMeshHandle(); }
+
+	TWeakObjectPtr<UBFInstancedStaticMeshPool> Pool = nullptr;
+	TBFPooledObjectHandlePtr<ABFPoolableStaticMeshActor, ESPMode::NotThreadSafe> PromotedHandle = nullptr;
+	int32 SlotIndex = INDEX_NONE;
+	int32 CheckoutID = -1;
+};
+
+
+USTRUCT(BlueprintType, meta=(DisplayName="BF Instanced Static Mesh Pool Init Params"))
+struct FBFInstancedStaticMeshPoolInitParams
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	EBFInstancedPoolType PoolType = EBFInstancedPoolType::InstancedStaticMesh;
+	
+	/* Max instances across every mesh, returned ones are collapsed to zero scale so this is also the most the components will ever hold. At the limit a collapsed
+	 * instance of another mesh is moved over, so the limit is shared rather than stuck on meshes that are no longer used. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(ClampMin="1"))
+	int32 PoolLimit = 1000;
+
+	/* Per instance floats after the two the pool uses, which are the fade start and end in world seconds (0 for no fade). Materials fade with
+	 * Alpha = End > Start ? saturate((End - Time) / (End - Start)) : 1 using PerInstanceCustomData 0 and 1, the rest come from UnpoolInstance's CustomData. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(ClampMin="0"))
+	int32 NumCustomDataFloats = 0;
+
+	// Seconds before a curfew expires for the fade custom data to start, the fade is done in the material so costs nothing per frame. 0 to disable.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(ClampMin="0.0"))
+	float FadeOutSeconds = 0.f;
+
+	// Descriptions with bSimulatePhysics are promoted to one of these actors from a regular actor pool owned by this pool.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	TSubclassOf<ABFPoolableStaticMeshActor> PromotionActorClass;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(ClampMin="0"))
+	int32 PromotionPoolLimit = 32;
+};
+
+
+/** UBFInstancedStaticMeshPool:
+ * Pool for purely visual static meshes (debris, shell casings, rubble) where the pooled objects are instance slots in one ISM/HISM component per mesh and material set
+ * instead of one actor, component and draw call per item. Un-pooling takes a collapsed instance (or adds one up to PoolLimit), moves it into place and applies the
+ * descriptions curfew, returning collapses it again. Handles map to a slot, which knows its current batch and instance index.
+ * Transform and custom data changes only mark the component dirty once at the end of the frame.
+ *
+ * Descriptions with bSimulatePhysics can't be instances, those are promoted to an ABFPoolableStaticMeshActor FireAndForget from a lazily created actor pool and
+ * the handle forwards to it, so calling code is the same either way.
+ *
+ * Added to the owning actor via CreatePool, which also owns the mesh components. */
+UCLASS(ClassGroup=(BFObjectPooling), meta=(DisplayName="BF Instanced Static Mesh Pool"))
+class BFOBJECTPOOLING_API UBFInstancedStaticMeshPool : public UActorComponent
+{
+	GENERATED_BODY()
+public:
+	UBFInstancedStaticMeshPool();
+	
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool")
+	static UBFInstancedStaticMeshPool* CreatePool(AActor* Owner, const FBFInstancedStaticMeshPoolInitParams& Params);
+	
+	virtual void InitPool(const FBFInstancedStaticMeshPoolInitParams& Params);
+	
+	// Returns an invalid handle if the pool is full (or the promotion pool is for physics descriptions), CustomData fills the NumCustomDataFloats after the fade floats.
+	virtual FBFInstancedMeshHandle UnpoolInstance(const FBFPoolableStaticMeshActorDescription& Description, const FTransform& Transform, TConstArrayView<float> CustomData = {});
+
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool", meta=(DisplayName="Unpool Instance", AutoCreateRefTerm="CustomData", ExpandEnumAsExecs="ReturnValue"))
+	void UnpoolInstanceBP(const FBFPoolableStaticMeshActorDescription& Description, const FTransform& Transform, const TArray<float>& CustomData, EBFSuccess& ReturnValue, FBFInstancedMeshHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool", meta=(DisplayName="Return Instance To Pool"))
+	bool ReturnInstanceToPoolBP(UPARAM(ref)FBFInstancedMeshHandle& Handle) { return Handle.ReturnToPool(); }
+
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool", meta=(DisplayName="Set Instance Curfew"))
+	bool SetInstanceCurfewBP(const FBFInstancedMeshHandle& Handle, float Seconds) { return Handle.SetCurfew(Seconds); }
+
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool", meta=(DisplayName="Is Instance Handle Valid"))
+	bool IsInstanceHandleValidBP(const FBFInstancedMeshHandle& Handle) const { return Handle.IsHandleValid(); }
+
+	// Slot level API the handles route through.
+	bool IsCheckoutValid(int32 SlotIndex, int32 CheckoutID) const { return Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].bActive && Slots[SlotIndex].CheckoutID == CheckoutID; }
+	bool ReturnToPool(int32 SlotIndex, int32 CheckoutID);
+	bool SetCurfew(int32 SlotIndex, int32 CheckoutID, float Seconds);
+	bool ClearCurfew(int32 SlotIndex, int32 CheckoutID);
+	bool SetInstanceTransform(int32 SlotIndex, int32 CheckoutID, const FTransform& Transform);
+
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool")
+	int32 GetNumActiveInstances() const { return NumActive; }
+	UFUNCTION(BlueprintCallable, Category="BF| Instanced Static Mesh Pool")
+	int32 GetNumInstances() const { return Slots.Num(); }
+	const FBFInstancedStaticMeshPoolInitParams& GetPoolInitInfo() const { return InitInfo; }
+	const TBFObjectPoolPtr<ABFPoolableStaticMeshActor>& GetPromotionPool() const { return PromotionPool; }
+	
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+protected:
+	struct FInstanceSlot
+	{
+		int32 BatchIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+		int32 CheckoutID = 0;
+		float CurfewTime = -1.f; // World seconds, matched against the heap entry so cleared/replaced curfews are skipped when popped.
+		bool bActive = false;
+	};
+
+	// Every mesh, material set and collision setup gets its own component, most pools only ever see a handful so finding one is a short linear search.
+	struct FInstanceBatch
+	{
+		TSoftObjectPtr<UStaticMesh> Mesh;
+		TArray<FBFPoolableMeshMaterialDescription> Materials;
+		FName CollisionProfile;
+		TEnumAsByte<ECollisionEnabled::Type> CollisionEnabled = ECollisionEnabled::NoCollision;
+		TArray<int32> FreeSlots; // Collapsed instances of this batch, handed to other batches when the pool is at its limit.
+		TArray<int32> InstanceSlots; // Slot of every instance in the component, by instance index.
+		bool bRenderStateDirty = false;
+	};
+
+	struct FInstanceCurfew
+	{
+		float ExpireTime = 0.f;
+		int32 SlotIndex = INDEX_NONE;
+		int32 CheckoutID = -1;
+		bool operator<(const FInstanceCurfew& Rhs) const { return ExpireTime < Rhs.ExpireTime; }
+	};
+	
+	int32 FindOrAddBatch(const FBFPoolableStaticMeshActorDescription& Description);
+	// At the PoolLimit, moves a collapsed slot from another batch to this one so the limit is shared by every mesh rather than stuck on ones no longer used.
+	int32 ReclaimFreeSlot(int32 BatchIndex);
+	// Removes the instance by moving the batches last instance into its place first, so no other slots instance index changes.
+	void RemoveBatchInstance(int32 BatchIndex, int32 InstanceIndex);
+	// Zero scale and without a physics body, so returned instances can't be hit.
+	void CollapseInstance(const FInstanceSlot& Slot);
+	FBFInstancedMeshHandle PromoteToActor(const FBFPoolableStaticMeshActorDescription& Description, const FTransform& Transform);
+	void SetFadeCustomData(const FInstanceSlot& Slot, float FadeStart, float FadeEnd);
+	void MarkBatchDirty(int32 BatchIndex);
+
+protected:
+	FBFInstancedStaticMeshPoolInitParams InitInfo;
+	
+	// Indexed the same as Batches.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> BatchComponents;
+	TArray<FInstanceBatch> Batches;
+	TArray<FInstanceSlot> Slots;
+	TArray<FInstanceCurfew> CurfewHeap;
+	TBFObjectPoolPtr<ABFPoolableStaticMeshActor> PromotionPool = nullptr;
+	int32 NumActive = 0;
+	uint8 bHasDirtyBatches : 1 = false;
+};
@@ -2,6 +2,7 @@
 // Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
 
 #include "BFPoolable3DWidgetActor.h"
+#include "BFPoolable3DWidgetAnimationSubsystem.h"
 #include "BFObjectPooling/PoolBP/BFPooledObjectHandleBP.h"
 #include "Components/WidgetComponent.h"
 
@@ -9,8 +10,9 @@
 ABFPoolable3DWidgetActor::ABFPoolable3DWidgetActor(const FObjectInitializer& ObjectInitializer)
 	: Super( ObjectInitializer )
 {
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = true;
+	// Target facing and the lifetime curve are driven by UBFPoolable3DWidgetAnimationSubsystem.
+	PrimaryActorTick.bCanEverTick = false;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	RootComponent = CreateDefaultSubobject<USceneComponent>("RootComponent");
 	WidgetComponent = CreateDefaultSubobject<UWidgetComponent>("WidgetComponent");
@@ -18,31 +20,6 @@ ABFPoolable3DWidgetActor::ABFPoolable3DWidgetActor(const FObjectInitializer& Obj
 }
 
 
-void ABFPoolable3DWidgetActor::Tick(float Dt)
-{
-	Super::Tick(Dt);
-	
-	if(IsValid(ActivationInfo.TargetComponent) && ActivationInfo.WidgetSpace != EBFWidgetSpace::Screen) // SS doesnt require this.
-	{
-		FRotator Rot = (ActivationInfo.TargetComponent->GetComponentLocation() - GetActorLocation()).Rotation();
-		WidgetComponent->SetWorldRotation(Rot);
-	}
-
-	float Curfew = ActivationInfo.ActorCurfew;
-	UCurveVector4* Curve = ActivationInfo.WidgetLifetimePositionAndSizeCurve;
-	if(Curfew > 0 && Curve) // Can only do this if know its lifetime so we can normalize and sample.
-	{
-		float NormalizedTimeAlive = FMath::Clamp( ( GetWorld()->GetTimeSeconds() - StartingTime) / Curfew, 0.f, 1.f);
-		FVector4 CurveValue = Curve->GetVectorValue(NormalizedTimeAlive);
-		FVector PosOffset = FVector{CurveValue.X, CurveValue.Y, CurveValue.Z};
-		PosOffset = ActivationInfo.bInvertWidgetCurve ? -PosOffset : PosOffset; 
-		WidgetComponent->SetWorldLocation(AbsoluteStartLocation + WidgetComponent->GetComponentTransform().TransformVector(PosOffset));// Ensure our local space defined curve offset is sampled in WS
-		WidgetComponent->SetDrawSize(ActivationInfo.DrawSize * CurveValue.W);
-	}
-}
-
-
-
 void ABFPoolable3DWidgetActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle,
 	const FBFPoolable3DWidgetActorDescription& ActivationParams, const FTransform& ActorTransform)
 {
@@ -51,15 +28,7 @@ void ABFPoolable3DWidgetActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle,
 	
 	SetPoolHandleBP(Handle);
 	SetPoolableActorParams(ActivationParams);
-	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
-
-	SetActorHiddenInGame(false);
-	SetActorTickEnabled(true);
-	
-	SetActorTransform(ActorTransform);
-	ActivatePoolableActor();
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -71,12 +40,38 @@ void ABFPoolable3DWidgetActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoolabl
 	
 	SetPoolHandle(Handle);
 	SetPoolableActorParams(ActivationParams);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolable3DWidgetActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolable3DWidgetActorPreset* Preset, const FTransform& ActorTransform, USceneComponent* TargetComponent)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
 	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	SetTargetComponent(TargetComponent);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolable3DWidgetActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolable3DWidgetActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolable3DWidgetActorPreset* Preset, const FTransform& ActorTransform, USceneComponent* TargetComponent)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	SetTargetComponent(TargetComponent);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolable3DWidgetActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	if(GetActivationInfo().ActorCurfew > 0)
+		SetCurfew(GetActivationInfo().ActorCurfew);
 
 	SetActorHiddenInGame(false);
-	SetActorTickEnabled(true);
 	
 	SetActorTransform(ActorTransform);
 	ActivatePoolableActor();
@@ -85,35 +80,52 @@ void ABFPoolable3DWidgetActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoolabl
 
 void ABFPoolable3DWidgetActor::SetPoolableActorParams( const FBFPoolable3DWidgetActorDescription& ActivationParams)
 {
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams;
 }
 
 
+void ABFPoolable3DWidgetActor::SetPoolableActorPreset(const UBFPoolable3DWidgetActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
+
 void ABFPoolable3DWidgetActor::ActivatePoolableActor()
 {
 	SetupObjectState();
 	AbsoluteStartLocation = GetActorLocation();
 	WidgetComponent->SetWorldLocation(AbsoluteStartLocation); // In case using curve to drive position, ensure we snap back.
 	bfValid(WidgetComponent->GetWidget());
+
+	// Screen space widgets don't need to face anything.
+	const FBFPoolable3DWidgetActorDescription& Info = GetActivationInfo();
+	USceneComponent* TargetComponent = TargetComponentOverride.IsValid() ? TargetComponentOverride.Get() : Info.TargetComponent.Get();
+	if(UBFPoolable3DWidgetAnimationSubsystem* Animation = UBFPoolable3DWidgetAnimationSubsystem::Get(this))
+		Animation->RegisterWidgetActor(this, Info.WidgetSpace != EBFWidgetSpace::Screen ? TargetComponent : nullptr);
 }
 
 
 void ABFPoolable3DWidgetActor::SetupObjectState()
 {
+	const FBFPoolable3DWidgetActorDescription& Info = GetActivationInfo();
+	
 	// Create new only if they differ or if we don't have a widget.
-	if(!WidgetComponent->GetWidget() || WidgetComponent->GetWidget()->GetClass() != ActivationInfo.WidgetClass)
-		WidgetComponent->SetWidget(CreateWidget<UUserWidget>(GetWorld(), ActivationInfo.WidgetClass));
+	const TSubclassOf<UUserWidget> DesiredWidgetClass = BF::OP::ResolveSoftClass(Info.WidgetClass);
+	if(!WidgetComponent->GetWidget() || WidgetComponent->GetWidget()->GetClass() != DesiredWidgetClass)
+		WidgetComponent->SetWidget(CreateWidget<UUserWidget>(GetWorld(), DesiredWidgetClass));
 
-	WidgetComponent->bCastFarShadow = ActivationInfo.bShouldCastShadow;
+	WidgetComponent->bCastFarShadow = Info.bShouldCastShadow;
 	WidgetComponent->SetVisibility(true);
 	WidgetComponent->SetTickMode(ETickMode::Enabled);
-	WidgetComponent->SetWidgetSpace((EWidgetSpace)ActivationInfo.WidgetSpace);
+	WidgetComponent->SetWidgetSpace((EWidgetSpace)Info.WidgetSpace);
 	
-	WidgetComponent->SetTintColorAndOpacity(ActivationInfo.WidgetTintAndOpacity);
-	WidgetComponent->SetTickWhenOffscreen(ActivationInfo.bShouldTickWhenOffscreen);
-	WidgetComponent->SetTickableWhenPaused(ActivationInfo.bTickableWhenPaused);
-	WidgetComponent->SetDrawSize(ActivationInfo.DrawSize);
-	WidgetComponent->SetTwoSided(ActivationInfo.bTwoSided);
+	WidgetComponent->SetTintColorAndOpacity(Info.WidgetTintAndOpacity);
+	WidgetComponent->SetTickWhenOffscreen(Info.bShouldTickWhenOffscreen);
+	WidgetComponent->SetTickableWhenPaused(Info.bTickableWhenPaused);
+	WidgetComponent->SetDrawSize(Info.DrawSize);
+	WidgetComponent->SetTwoSided(Info.bTwoSided);
 	
 	WidgetComponent->UpdateWidget();
 
@@ -141,6 +153,12 @@ bool ABFPoolable3DWidgetActor::ReturnToPool()
 void ABFPoolable3DWidgetActor::OnObjectPooled_Implementation()
 {
 	RemoveCurfew();
+
+	if(AnimationIndex != INDEX_NONE)
+	{
+		if(UBFPoolable3DWidgetAnimationSubsystem* Animation = UBFPoolable3DWidgetAnimationSubsystem::Get(this))
+			Animation->UnregisterWidgetActor(this);
+	}
 	
 	ObjectHandle = nullptr;
 	BPObjectHandle = nullptr;
@@ -149,7 +167,11 @@ void ABFPoolable3DWidgetActor::OnObjectPooled_Implementation()
 	WidgetComponent->SetWidgetSpace(EWidgetSpace::World);
 	WidgetComponent->SetVisibility(false);
 	WidgetComponent->UpdateWidget();
-	ActivationInfo = {};
+	TargetComponentOverride = nullptr;
+	if(ActivePreset)
+		ActivePreset = nullptr;
+	else
+		ActivationInfo = {};
 }
 
 
@@ -188,16 +210,14 @@ void ABFPoolable3DWidgetActor::SetCurfew(float SecondsUntilReturn)
 {
 	bfEnsure(SecondsUntilReturn > 0);
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, this, &ABFPoolable3DWidgetActor::OnCurfewExpired, SecondsUntilReturn, false);
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolable3DWidgetActor::OnCurfewExpired));
 }
 
 
 void ABFPoolable3DWidgetActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-	
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
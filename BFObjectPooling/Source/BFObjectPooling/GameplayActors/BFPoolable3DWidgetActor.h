@@ -4,6 +4,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "GameFramework/Actor.h"
 #include "BFObjectPooling/Pool/BFObjectPool.h"
 #include "BFPoolable3DWidgetActor.generated.h"
@@ -37,7 +38,6 @@ public:
 	ABFPoolable3DWidgetActor(const FObjectInitializer& ObjectInitializer);
 	virtual void OnObjectPooled_Implementation() override;
 	virtual void FellOutOfWorld(const UDamageType& DmgType) override;
-	virtual void Tick(float Dt) override;
 	
 	// For easy fire and forget usage, will invalidate the Handle as the PoolActor now takes responsibility for returning based on our poolable actor params.
 	UFUNCTION(BlueprintCallable, Category="BF|Poolable 3D Widget Actor", meta=(DisplayName="Fire And Forget"))
@@ -52,6 +52,14 @@ public:
 	// For easy fire and forget usage, will invalidate the Handle as the PoolActor now takes responsibility for returning based on our poolable actor params.
 	virtual void FireAndForget(TBFPooledObjectHandlePtr<ABFPoolable3DWidgetActor, ESPMode::NotThreadSafe>& Handle, 
 		const FBFPoolable3DWidgetActorDescription& ActivationParams, const FTransform& ActorTransform);
+
+
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and the widget is only recreated if the class differs.
+	 * The target component is per activation so is passed here instead of being read from the preset. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable 3D Widget Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolable3DWidgetActorPreset* Preset, const FTransform& ActorTransform, USceneComponent* TargetComponent = nullptr);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolable3DWidgetActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolable3DWidgetActorPreset* Preset, const FTransform& ActorTransform, USceneComponent* TargetComponent = nullptr);
 	
 
 
@@ -68,6 +76,16 @@ public:
 	// If you are manually wanting to control the system then you can set its params here and call ActivatePoolableActor yourself if you want to just simply activate it and let it return when done see FireAndForget.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable 3D Widget Actor")
 	virtual void SetPoolableActorParams(const FBFPoolable3DWidgetActorDescription& ActivationParams);
+
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable 3D Widget Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolable3DWidgetActorPreset* Preset);
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolable3DWidgetActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
+
+	// Per activation override for the component we face towards, cleared when returned to the pool.
+	void SetTargetComponent(USceneComponent* TargetComponent) { TargetComponentOverride = TargetComponent; }
 	
 	/*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	 *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
@@ -91,10 +109,15 @@ public:
 	UWidgetComponent* GetWidgetComponent() const { return WidgetComponent; }
 
 protected:
+	friend class UBFPoolable3DWidgetAnimationSubsystem;
+	
 	virtual void OnCurfewExpired();
 	
 	// Called just prior to being activated in the world.
 	virtual void SetupObjectState(); 
+
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
 protected:
 	/* BP pools store UObject handles for convenience and I cant template member functions (:
 	 * So I have decided for everyone that we non ThreadSafe for performance benefits, you are using Multithreading with BP typically. You can always implement your own classes anyway.  */
@@ -108,8 +131,16 @@ protected:
 	float StartingTime = 0.f;
 	FVector AbsoluteStartLocation = FVector::ZeroVector;
 
+	// Our slot in the UBFPoolable3DWidgetAnimationSubsystem, which faces us to the target and samples the curve instead of us ticking. INDEX_NONE if there is nothing to animate.
+	int32 AnimationIndex = INDEX_NONE;
+
 	FBFPoolable3DWidgetActorDescription ActivationInfo;
 	FTimerHandle CurfewTimerHandle;
+	TWeakObjectPtr<USceneComponent> TargetComponentOverride;
+
+	// Presets are referenced, not copied.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolable3DWidgetActorPreset> ActivePreset = nullptr;
 
 	UPROPERTY(Transient)
 	uint32 bIsUsingBPHandle:1 = false;
@@ -0,0 +1,221 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFPoolable3DWidgetAnimationSubsystem.h"
+#include "BFPoolable3DWidgetActor.h"
+#include "BFObjectPooling/Module/BFObjectPooling.h"
+#include "Components/WidgetComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+
+UBFPoolable3DWidgetAnimationSubsystem* UBFPoolable3DWidgetAnimationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBFPoolable3DWidgetAnimationSubsystem>() : nullptr;
+}
+
+
+bool UBFPoolable3DWidgetAnimationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+void UBFPoolable3DWidgetAnimationSubsystem::RegisterWidgetActor(ABFPoolable3DWidgetActor* WidgetActor, USceneComponent* TargetComponent)
+{
+	bfValid(WidgetActor);
+	const FBFPoolable3DWidgetActorDescription& Info = WidgetActor->GetActivationInfo();
+	const UCurveVector4* Curve = Info.ActorCurfew > 0.f ? Info.WidgetLifetimePositionAndSizeCurve : nullptr; // Can only sample a curve over a known lifetime.
+	if(!Curve && !TargetComponent)
+	{
+		UnregisterWidgetActor(WidgetActor);
+		return;
+	}
+	
+	int32 Index = WidgetActor->AnimationIndex;
+	if(Index == INDEX_NONE)
+	{
+		Index = WidgetActors.Add(WidgetActor);
+		Curves.AddDefaulted();
+		TargetComponents.AddDefaulted();
+		StartLocations.AddUninitialized();
+		DrawSizes.AddUninitialized();
+		StartTimes.AddUninitialized();
+		InvLifetimes.AddUninitialized();
+		BakedCurveIndices.Add(INDEX_NONE);
+		bInvertCurve.AddUninitialized();
+		WidgetActor->AnimationIndex = Index;
+	}
+
+	Curves[Index] = Curve;
+	TargetComponents[Index] = TargetComponent;
+	StartLocations[Index] = WidgetActor->GetActorLocation();
+	DrawSizes[Index] = Info.DrawSize;
+	StartTimes[Index] = GetWorld()->GetTimeSeconds();
+	InvLifetimes[Index] = Curve ? 1.f / Info.ActorCurfew : 0.f;
+	// Baked before the old one is released so re-registering with the same curve keeps its table, releasing may move the new one (its index is remapped in place).
+	const int32 OldBakedIndex = BakedCurveIndices[Index];
+	BakedCurveIndices[Index] = FindOrBakeCurve(Curve);
+	ReleaseBakedCurve(OldBakedIndex);
+	bInvertCurve[Index] = Info.bInvertWidgetCurve;
+}
+
+
+void UBFPoolable3DWidgetAnimationSubsystem::UnregisterWidgetActor(ABFPoolable3DWidgetActor* WidgetActor)
+{
+	if(!WidgetActor || WidgetActor->AnimationIndex == INDEX_NONE)
+		return;
+
+	const int32 Index = WidgetActor->AnimationIndex;
+	bfEnsure(WidgetActors.IsValidIndex(Index) && WidgetActors[Index] == WidgetActor);
+	Slots.Remove(WidgetActors, &ABFPoolable3DWidgetActor::AnimationIndex, Index, [this](int32 Slot) { RemoveAttributesAtSwap(Slot); });
+}
+
+
+void UBFPoolable3DWidgetAnimationSubsystem::Tick(float DeltaTime)
+{
+	SCOPED_NAMED_EVENT(UBFPoolable3DWidgetAnimationSubsystem_Tick, FColor::Green);
+	const int32 NumAnimating = WidgetActors.Num();
+	if(NumAnimating == 0)
+		return;
+
+	// Tables are rebuilt if the sample count changed (or on the first tick), everything registered before then was evaluating the curve directly.
+	const int32 NumSamples = BF::OP::CVarWidgetAnimationCurveSamples.GetValueOnGameThread();
+	if(NumSamples != BakedSampleCount)
+	{
+		BakedSampleCount = NumSamples;
+		BakedCurves.Reset();
+		BakedCurveLookup.Reset();
+		for(int32 Index = 0; Index < NumAnimating; ++Index)
+			BakedCurveIndices[Index] = FindOrBakeCurve(Curves[Index]);
+	}
+	
+	if(CurveSamples.Num() < NumAnimating)
+		CurveSamples.SetNumUninitialized(NumAnimating);
+
+	// Sample every curve up front, nothing here touches the components.
+	const float Now = GetWorld()->GetTimeSeconds();
+	for(int32 Index = 0; Index < NumAnimating; ++Index)
+	{
+		if(!WidgetActors[Index] || InvLifetimes[Index] <= 0.f)
+			continue;
+
+		const float NormalizedTimeAlive = FMath::Clamp((Now - StartTimes[Index]) * InvLifetimes[Index], 0.f, 1.f);
+		const int32 BakedIndex = BakedCurveIndices[Index];
+		if(BakedIndex == INDEX_NONE)
+		{
+			CurveSamples[Index] = FVector4f(Curves[Index]->GetVectorValue(NormalizedTimeAlive));
+			continue;
+		}
+
+		const TArray<FVector4f>& Table = BakedCurves[BakedIndex].Samples;
+		const float Position = NormalizedTimeAlive * (Table.Num() - 1);
+		const int32 Lower = FMath::Min(FMath::FloorToInt32(Position), Table.Num() - 2);
+		const VectorRegister4Float LowerSample = VectorLoad(&Table[Lower].X);
+		const VectorRegister4Float UpperSample = VectorLoad(&Table[Lower + 1].X);
+		VectorStore(VectorMultiplyAdd(VectorSubtract(UpperSample, LowerSample), VectorSetFloat1(Position - Lower), LowerSample), &CurveSamples[Index].X);
+	}
+
+	// Moving a component can run overlap events that return (unregister) any widget, so the slot is re-checked after each call.
+	Slots.bDeferRemoval = true;
+	for(int32 Index = 0; Index < NumAnimating; ++Index)
+	{
+		ABFPoolable3DWidgetActor* WidgetActor = WidgetActors[Index];
+		if(!WidgetActor)
+			continue;
+		
+		if(!IsValid(WidgetActor))
+		{
+			// Destroyed without being returned.
+			Slots.MarkPendingRemoval(WidgetActors, Index);
+			continue;
+		}
+
+		UWidgetComponent* WidgetComponent = WidgetActor->GetWidgetComponent();
+		if(const USceneComponent* TargetComponent = TargetComponents[Index].Get())
+			WidgetComponent->SetWorldRotation((TargetComponent->GetComponentLocation() - WidgetActor->GetActorLocation()).Rotation());
+
+		if(InvLifetimes[Index] > 0.f && WidgetActors[Index] == WidgetActor)
+		{
+			const FVector4f& Sample = CurveSamples[Index];
+			const FVector PosOffset = FVector(Sample.X, Sample.Y, Sample.Z) * (bInvertCurve[Index] ? -1.f : 1.f);
+			WidgetComponent->SetWorldLocation(StartLocations[Index] + WidgetComponent->GetComponentTransform().TransformVector(PosOffset)); // Local space defined curve offset sampled in WS.
+			if(WidgetActors[Index] == WidgetActor)
+				WidgetComponent->SetDrawSize(DrawSizes[Index] * Sample.W);
+		}
+	}
+	Slots.bDeferRemoval = false;
+
+	Slots.Compact(WidgetActors, &ABFPoolable3DWidgetActor::AnimationIndex, [this](int32 Slot) { RemoveAttributesAtSwap(Slot); });
+}
+
+
+int32 UBFPoolable3DWidgetAnimationSubsystem::FindOrBakeCurve(const UCurveVector4* Curve)
+{
+	if(!Curve || BakedSampleCount < 2)
+		return INDEX_NONE;
+
+	if(const int32* Found = BakedCurveLookup.Find(Curve))
+	{
+		++BakedCurves[*Found].NumUsers;
+		return *Found;
+	}
+
+	FBakedCurve& Baked = BakedCurves.AddDefaulted_GetRef();
+	Baked.Curve = Curve;
+	Baked.NumUsers = 1;
+	Baked.Samples.SetNumUninitialized(BakedSampleCount);
+	for(int32 Sample = 0; Sample < BakedSampleCount; ++Sample)
+		Baked.Samples[Sample] = FVector4f(Curve->GetVectorValue(static_cast<float>(Sample) / (BakedSampleCount - 1)));
+	
+	return BakedCurveLookup.Add(Curve, BakedCurves.Num() - 1);
+}
+
+
+void UBFPoolable3DWidgetAnimationSubsystem::ReleaseBakedCurve(int32 BakedIndex)
+{
+	if(BakedIndex == INDEX_NONE || --BakedCurves[BakedIndex].NumUsers > 0)
+		return;
+
+	// The last table takes its place, a handful of tables per world so remapping its users is a short scan.
+	const int32 LastIndex = BakedCurves.Num() - 1;
+	BakedCurveLookup.Remove(BakedCurves[BakedIndex].Curve);
+	BakedCurves.RemoveAtSwap(BakedIndex);
+	if(BakedIndex == LastIndex)
+		return;
+
+	BakedCurveLookup[BakedCurves[BakedIndex].Curve] = BakedIndex;
+	for(int32& CurveIndex : BakedCurveIndices)
+	{
+		if(CurveIndex == LastIndex)
+			CurveIndex = BakedIndex;
+	}
+}
+
+
+void UBFPoolable3DWidgetAnimationSubsystem::RemoveAttributesAtSwap(int32 Index)
+{
+	ReleaseBakedCurve(BakedCurveIndices[Index]);
+	Curves.RemoveAtSwap(Index);
+	TargetComponents.RemoveAtSwap(Index);
+	StartLocations.RemoveAtSwap(Index);
+	DrawSizes.RemoveAtSwap(Index);
+	StartTimes.RemoveAtSwap(Index);
+	InvLifetimes.RemoveAtSwap(Index);
+	BakedCurveIndices.RemoveAtSwap(Index);
+	bInvertCurve.RemoveAtSwap(Index);
+}
+
+
+TStatId UBFPoolable3DWidgetAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBFPoolable3DWidgetAnimationSubsystem, STATGROUP_Tickables);
+}
+
+
+void UBFPoolable3DWidgetAnimationSubsystem::Deinitialize()
+{
+	Slots.Reset(WidgetActors, &ABFPoolable3DWidgetActor::AnimationIndex, [this](int32 Slot) { RemoveAttributesAtSwap(Slot); });
+	Super::Deinitialize();
+}
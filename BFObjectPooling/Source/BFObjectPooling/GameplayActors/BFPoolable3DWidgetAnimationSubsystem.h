@@ -0,0 +1,80 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BFBatchedSlots.h"
+#include "BFPoolable3DWidgetAnimationSubsystem.generated.h"
+
+
+class ABFPoolable3DWidgetActor;
+class UCurveVector4;
+class USceneComponent;
+
+
+/** Animates every active ABFPoolable3DWidgetActor in the world from one tick instead of each actor ticking itself, facing their target component and driving the
+ * WidgetLifetimePositionAndSizeCurve offset/draw size over their curfew. Curves are sampled for every widget first in one loop, from a baked table per curve
+ * (BF.OP.WidgetAnimation.CurveSamples, lerped with all four channels in one vector register) or by evaluating the curve when baking is disabled, then applied to the components.
+ * Widgets with neither a target nor a curve are never registered. Removal while applying only nulls the slot, the arrays are compacted after. */
+UCLASS()
+class BFOBJECTPOOLING_API UBFPoolable3DWidgetAnimationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	static UBFPoolable3DWidgetAnimationSubsystem* Get(const UObject* WorldContextObject);
+
+	// Starts animating from the widgets current location and time, re-registering restarts it.
+	void RegisterWidgetActor(ABFPoolable3DWidgetActor* WidgetActor, USceneComponent* TargetComponent);
+	void UnregisterWidgetActor(ABFPoolable3DWidgetActor* WidgetActor);
+	int32 GetNumAnimatedWidgets() const { return Slots.GetNumLive(WidgetActors); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// INDEX_NONE when the curve should be evaluated directly, otherwise the caller is a user of the table until it releases it.
+	int32 FindOrBakeCurve(const UCurveVector4* Curve);
+	// Drops the table once nothing animating uses its curve anymore.
+	void ReleaseBakedCurve(int32 BakedIndex);
+	// Everything but WidgetActors, see BF::OP::FBFBatchedSlots.
+	void RemoveAttributesAtSwap(int32 Index);
+
+	struct FBakedCurve
+	{
+		TArray<FVector4f> Samples;
+		FObjectKey Curve;
+		int32 NumUsers = 0;
+	};
+
+protected:
+	// Null while pending removal.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABFPoolable3DWidgetActor>> WidgetActors;
+
+	// Held for the raw evaluation path and so baked tables can't outlive their curve while in use.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<const UCurveVector4>> Curves;
+	
+	TArray<TWeakObjectPtr<USceneComponent>> TargetComponents;
+	TArray<FVector> StartLocations;
+	TArray<FVector2D> DrawSizes;
+	TArray<float> StartTimes;
+	TArray<float> InvLifetimes; // 0 without a curve.
+	TArray<int32> BakedCurveIndices;
+	TArray<uint8> bInvertCurve;
+
+	// Per tick scratch, only the first NumAnimating entries are meaningful.
+	TArray<FVector4f> CurveSamples;
+
+	// Curve samples at evenly spaced normalized times, keyed by curve since most widgets in a world share a handful of curves.
+	TArray<FBakedCurve> BakedCurves;
+	TMap<FObjectKey, int32> BakedCurveLookup;
+	int32 BakedSampleCount = 0;
+
+	// Removal is deferred while applying.
+	BF::OP::FBFBatchedSlots Slots;
+};
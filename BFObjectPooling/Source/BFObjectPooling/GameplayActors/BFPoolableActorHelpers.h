@@ -2,11 +2,93 @@
 // Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
 
 #pragma once
+#include "Logging/StructuredLog.h"
+#include "Engine/TimerHandle.h"
+#include "TimerManager.h"
+#include "BFObjectPooling/Module/BFObjectPooling.h"
 #include "BFPoolableActorHelpers.generated.h"
 
 
 class UNiagaraSystem;
 class UCurveVector4;
+class USkinnedMeshComponent;
+
+
+namespace BF::OP
+{
+	/* Description assets are soft references so declaring a description (or a preset) doesn't force load its content, they are expected to be loaded by the time
+	 * the actor activates (see FBFObjectPoolInitParams::AssetsToPreload and TBFObjectPool::InitPoolAsync). If not we fall back to a synchronous load so activation
+	 * still works, that is a hitch though so it gets logged outside of shipping. */
+	template<typename T>
+	T* ResolveSoftAsset(const TSoftObjectPtr<T>& SoftAsset)
+	{
+		if(SoftAsset.IsNull())
+			return nullptr;
+		
+		if(T* Asset = SoftAsset.Get())
+			return Asset;
+
+#if !UE_BUILD_SHIPPING
+		if(CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+			UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] {0} was not preloaded and had to be loaded synchronously, add it to the pools AssetsToPreload.", SoftAsset.ToString());
+#endif
+		return SoftAsset.LoadSynchronous();
+	}
+
+	/* Built in actor curfews are owned by the pool through whichever handle the actor was given (see TBFObjectPool::SetCurfew) instead of each actor registering
+	 * its own world timer, an actor that hasn't been handed a handle yet (manual control) falls back to a timer. */
+	template<typename ActorType, typename HandlePtrType, typename BPHandlePtrType>
+	void SetPoolableActorCurfew(ActorType* Actor, const HandlePtrType& Handle, const BPHandlePtrType& BPHandle, bool bUsingBPHandle, FTimerHandle& FallbackTimer, float Seconds, const FSimpleDelegate& OnExpired)
+	{
+		const bool bPoolOwned = bUsingBPHandle ? BPHandle.IsValid() && BPHandle->SetCurfew(Seconds, OnExpired) : Handle.IsValid() && Handle->SetCurfew(Seconds, OnExpired);
+		if(!bPoolOwned)
+			Actor->GetWorld()->GetTimerManager().SetTimer(FallbackTimer, OnExpired, Seconds, false);
+	}
+
+	template<typename ActorType, typename HandlePtrType, typename BPHandlePtrType>
+	void RemovePoolableActorCurfew(ActorType* Actor, const HandlePtrType& Handle, const BPHandlePtrType& BPHandle, bool bUsingBPHandle, FTimerHandle& FallbackTimer)
+	{
+		if(bUsingBPHandle && BPHandle.IsValid())
+			BPHandle->ClearCurfew();
+		else if(!bUsingBPHandle && Handle.IsValid())
+			Handle->ClearCurfew();
+		
+		if(FallbackTimer.IsValid())
+			Actor->GetWorld()->GetTimerManager().ClearTimer(FallbackTimer);
+		FallbackTimer.Invalidate();
+	}
+
+	template<typename T>
+	TSubclassOf<T> ResolveSoftClass(const TSoftClassPtr<T>& SoftClass)
+	{
+		if(SoftClass.IsNull())
+			return nullptr;
+		
+		if(UClass* Class = SoftClass.Get())
+			return Class;
+
+#if !UE_BUILD_SHIPPING
+		if(CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+			UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] {0} was not preloaded and had to be loaded synchronously, add it to the pools AssetsToPreload.", SoftClass.ToString());
+#endif
+		return SoftClass.LoadSynchronous();
+	}
+
+	// Used by the descriptions AppendAssetsToPreload.
+	template<typename T>
+	void AppendSoftAsset(TArray<TSoftObjectPtr<UObject>>& Assets, const TSoftObjectPtr<T>& SoftAsset)
+	{
+		if(!SoftAsset.IsNull())
+			Assets.AddUnique(TSoftObjectPtr<UObject>(SoftAsset.ToSoftObjectPath()));
+	}
+
+	template<typename T>
+	void AppendSoftAsset(TArray<TSoftObjectPtr<UObject>>& Assets, const TSoftClassPtr<T>& SoftClass)
+	{
+		if(!SoftClass.IsNull())
+			Assets.AddUnique(TSoftObjectPtr<UObject>(SoftClass.ToSoftObjectPath()));
+	}
+}
 
 
 
@@ -56,10 +138,16 @@ struct FBFPoolableMeshMaterialDescription
 	GENERATED_BODY();
 public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UMaterialInterface> Material = nullptr;
+	TSoftObjectPtr<UMaterialInterface> Material;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	int32 MaterialIndex = 0;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, Material);
+	}
 };
 
 
@@ -95,7 +183,7 @@ struct FBFPoolableStaticMeshDescription
 	GENERATED_BODY();
 public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UStaticMesh> Mesh = nullptr;
+	TSoftObjectPtr<UStaticMesh> Mesh;
 
 	// Defines the collision profile to use for the mesh, only used when simulating physics like inside of FBFPoolableProjectileActor with bShouldMeshSimulatePhysicsOnImpact.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -107,6 +195,14 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	TArray<FBFPoolableMeshMaterialDescription> Materials;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, Mesh);
+		for(const FBFPoolableMeshMaterialDescription& MaterialDescription : Materials)
+			MaterialDescription.AppendAssetsToPreload(Assets);
+	}
 };
 
 
@@ -132,7 +228,7 @@ public:
 
 	// Optional Niagara system to be played along with the projectile.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UNiagaraSystem> NiagaraSystem = nullptr;
+	TSoftObjectPtr<UNiagaraSystem> NiagaraSystem;
 
 	// Optional attachment socket name for the niagara system, should be relative to the static mesh along with this actor, if not using a static mesh this isn't used.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -217,6 +313,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bShouldReturnOnStop:1 = false;
 
+	/* If true the projectile movement component doesn't tick, UBFProjectileSimulationSubsystem moves every batched projectile in the world together (ParallelFor over
+	 * struct of arrays state, then one transform write back per projectile). Hit, bounce and stop events fire the same way. Movement mirrors the component for gravity,
+	 * max speed, homing, bouncing and friction, anything else it supports (sliding, sub stepping, interpolation) is not simulated. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bUseBatchedSimulation:1 = false;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		ProjectileMesh.AppendAssetsToPreload(Assets);
+		BF::OP::AppendSoftAsset(Assets, NiagaraSystem);
+	}
 };
 
 
@@ -253,7 +361,7 @@ struct FBFPoolable3DWidgetActorDescription
 public:
 	// Widget to display
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TSubclassOf<UUserWidget> WidgetClass = nullptr;
+	TSoftClassPtr<UUserWidget> WidgetClass;
 
 	// If set will face the widget towards the target component (Only if Screen Space is disabled.)
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -305,6 +413,12 @@ public:
 	// Optionally can invert the sampled curve value.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bInvertWidgetCurve:1 = false;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, WidgetClass);
+	}
 };
 
 
@@ -316,7 +430,7 @@ struct FBFPoolableDecalActorDescription
 	GENERATED_BODY();
 public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UMaterialInterface> DecalMaterial = nullptr;
+	TSoftObjectPtr<UMaterialInterface> DecalMaterial;
 
 	// World space extent of the decal.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -340,6 +454,12 @@ public:
 	// Higher values draw over lower values.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	int32 SortOrder = 0;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, DecalMaterial);
+	}
 };
 
  
@@ -351,7 +471,7 @@ struct FBFPoolableNiagaraActorDescription
 public:
 	// The System to play.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UNiagaraSystem> NiagaraSystem = nullptr;
+	TSoftObjectPtr<UNiagaraSystem> NiagaraSystem;
 	
 	// If curfew is set then this delayed time is already accounted for and we will return at curfew + delay time.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -365,6 +485,17 @@ public:
 	// Requires the handle to have been given to us which is the expected behavior. If disabled you need to make sure you have some way of returning the actor to the pool still.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bAutoReturnOnSystemFinish:1 = true;
+
+	/* If true the systems UNiagaraEffectType scalability (distance, instance count and view frustum pre culling, whichever the effect type enables) is checked against the
+	 * location before anything is done, QuickUnpoolNiagaraActor(Batch) checks before un-pooling and FireAndForget returns the actor straight away without activating it. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bPreCullWithScalability:1 = false;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, NiagaraSystem);
+	}
 };
 
 
@@ -381,7 +512,7 @@ struct FBFPoolableSoundActorDescription
 public:
 	// The sound to play.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<USoundBase> Sound = nullptr;
+	TSoftObjectPtr<USoundBase> Sound;
 
 	// Optional sound attenuation settings.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -431,6 +562,17 @@ public:
 	// Requires the handle to have been given to us which is the expected behavior. If disabled you need to make sure you have some way of returning the actor to the pool still.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bAutoReturnOnSoundFinish:1 = true;
+
+	/* If true one shot (non looping) sounds that ABFPoolableSoundActor::WouldSoundBeAudible says nobody would hear are skipped, QuickUnpoolSoundActor(Batch) checks before
+	 * un-pooling and FireAndForget returns the actor straight away without activating it. Looping sounds are always played so the audio engine can virtualize them. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bSkipIfInaudible:1 = false;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, Sound);
+	}
 };
 
 
@@ -451,7 +593,7 @@ public:
 	TEnumAsByte<ECollisionEnabled::Type> CollisionEnabled = ECollisionEnabled::NoCollision;
 	
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<USkeletalMesh> Mesh = nullptr;
+	TSoftObjectPtr<USkeletalMesh> Mesh;
 
 	// Defines the meshes transform relative to the parent root.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -462,11 +604,11 @@ public:
 	
 	// Animation instance to use for the mesh if any.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TSubclassOf<UAnimInstance> AnimationInstance = nullptr;
+	TSoftClassPtr<UAnimInstance> AnimationInstance;
 
 	// Optional animation sequence to play on the mesh, will play only if there is no animation instance set above.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UAnimSequence> AnimSequence = nullptr;
+	TSoftObjectPtr<UAnimSequence> AnimSequence;
 	
 	/** Values above 0 drive how long until the pooled actor will attempt to auto return to the pool,
 	* requires you to have given the handle to the pooled actor either via SetPoolHandle or FireAndForget.*/
@@ -492,6 +634,31 @@ public:
 	// Only applies to AnimSequence.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bLoopAnimSequence:1 = false;
+
+	/* Runtime only (presets can't reference a live component), if set the mesh copies this components pose instead of running its own animation so any number of
+	 * pooled meshes (crowds, corpses) cost one animation update. The leader must use the same skeleton, AnimationInstance/AnimSequence are ignored while following. */
+	UPROPERTY(Transient, BlueprintReadWrite)
+	TWeakObjectPtr<USkinnedMeshComponent> LeaderPoseComponent;
+
+	/* If true the mesh is registered with the worlds animation budget allocator (a.Budget.Enabled) while un-pooled, which throttles its tick and interpolates by
+	 * significance to stay within the frame budget. Requires the actors mesh component to be a USkeletalMeshComponentBudgeted, which a subclass
+	 * sets with ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(TEXT("SkeletalMeshComponent")). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bUseAnimationBudget:1 = false;
+
+	// If true the mesh uses the engines update rate optimizations (URO) while un-pooled, skipping and interpolating animation updates based on LOD and visibility.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bUpdateRateOptimizations:1 = false;
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, Mesh);
+		for(const FBFPoolableMeshMaterialDescription& MaterialDescription : Materials)
+			MaterialDescription.AppendAssetsToPreload(Assets);
+		BF::OP::AppendSoftAsset(Assets, AnimationInstance);
+		BF::OP::AppendSoftAsset(Assets, AnimSequence);
+	}
 };
 
 
@@ -511,7 +678,7 @@ public:
 	
 	// Mesh to display
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	TObjectPtr<UStaticMesh> Mesh = nullptr;
+	TSoftObjectPtr<UStaticMesh> Mesh;
 
 	// Defines the meshes transform relative to the parent root.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -528,7 +695,14 @@ public:
 	// If true the mesh will simulate physics.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bSimulatePhysics:1 = false;
-	
+
+	// Appends the soft assets this description references, use it to fill out FBFObjectPoolInitParams::AssetsToPreload.
+	void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const
+	{
+		BF::OP::AppendSoftAsset(Assets, Mesh);
+		for(const FBFPoolableMeshMaterialDescription& MaterialDescription : Materials)
+			MaterialDescription.AppendAssetsToPreload(Assets);
+	}
 };
 
 
@@ -0,0 +1,81 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFPoolableActorPresets.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+
+#define LOCTEXT_NAMESPACE "BFPoolableActorPresets"
+
+
+namespace BF::OP
+{
+	// Presets are validated when saved/validated in editor rather than ensured every time they are activated.
+	static EDataValidationResult ValidatePresetAsset(FDataValidationContext& Context, bool bIsValid, const FText& Error)
+	{
+		if(bIsValid)
+			return EDataValidationResult::Valid;
+
+		Context.AddError(Error);
+		return EDataValidationResult::Invalid;
+	}
+}
+
+
+EDataValidationResult UBFPoolableProjectileActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	// Same requirement HandleComponentCreation ensures at runtime, if we have a collision shape it must have a profile and a size.
+	const FBFCollisionShapeDescription& Shape = Description.ProjectileCollisionShape;
+	return BF::OP::ValidatePresetAsset(Context, Shape.CollisionShapeType == EBFCollisionShapeType::NoCollisionShape ||
+		(Shape.CollisionProfile.Name != NAME_None && !Shape.ShapeParams.IsNearlyZero()), LOCTEXT("ProjectileShape", "Projectile collision shape requires a collision profile and non zero shape params."));
+}
+
+
+EDataValidationResult UBFPoolableStaticMeshActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	return BF::OP::ValidatePresetAsset(Context, !Description.Mesh.IsNull(), LOCTEXT("StaticMesh", "Static mesh actor preset requires a mesh."));
+}
+
+
+EDataValidationResult UBFPoolableSkeletalMeshActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	return BF::OP::ValidatePresetAsset(Context, !Description.Mesh.IsNull(), LOCTEXT("SkeletalMesh", "Skeletal mesh actor preset requires a mesh."));
+}
+
+
+EDataValidationResult UBFPoolableDecalActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	return BF::OP::ValidatePresetAsset(Context, !Description.DecalMaterial.IsNull(), LOCTEXT("DecalMaterial", "Decal actor preset requires a decal material."));
+}
+
+
+EDataValidationResult UBFPoolableNiagaraActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	return BF::OP::ValidatePresetAsset(Context, !Description.NiagaraSystem.IsNull(), LOCTEXT("NiagaraSystem", "Niagara actor preset requires a niagara system."));
+}
+
+
+EDataValidationResult UBFPoolableSoundActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	return BF::OP::ValidatePresetAsset(Context, !Description.Sound.IsNull(), LOCTEXT("Sound", "Sound actor preset requires a sound."));
+}
+
+
+EDataValidationResult UBFPoolable3DWidgetActorPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	return BF::OP::ValidatePresetAsset(Context, !Description.WidgetClass.IsNull(), LOCTEXT("WidgetClass", "3D widget actor preset requires a widget class."));
+}
+
+
+#undef LOCTEXT_NAMESPACE
+#endif
+
+
+void UBFPoolableProjectileActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
+void UBFPoolableStaticMeshActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
+void UBFPoolableSkeletalMeshActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
+void UBFPoolableDecalActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
+void UBFPoolableNiagaraActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
+void UBFPoolableSoundActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
+void UBFPoolable3DWidgetActorPreset::AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const { Description.AppendAssetsToPreload(Assets); }
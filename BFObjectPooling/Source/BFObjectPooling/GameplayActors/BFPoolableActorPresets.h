@@ -0,0 +1,130 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Engine/DataAsset.h"
+#include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.generated.h"
+
+
+/** Presets are the shareable, immutable alternative to passing a description struct to the built in poolable actors.
+ * Passing a description copies the whole struct (material arrays, delegates and all) into the actor and re-applies every property each activation,
+ * a preset is only referenced and the actor remembers which preset it last applied. Re-activating with the same preset skips the mesh/material/asset setup
+ * and only applies the per activation state (transform, velocity, collision, timers).
+ *
+ * Dynamic delegates can't be authored on an asset so any delegates on a presets description are ignored, use the actors own events or subclass the actor if you need them.
+ * Anything that needs to change per activation and isn't covered by the FireAndForgetWithPreset params should use the regular description path instead. */
+UCLASS(Abstract, Const, BlueprintType, meta=(DisplayName="BF Poolable Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableActorPreset : public UDataAsset
+{
+	GENERATED_BODY()
+public:
+	// Appends the soft assets the presets description references, add these (and the preset itself) to the pools AssetsToPreload so activation never has to load them.
+	UFUNCTION(BlueprintCallable, Category="BF|Preset")
+	virtual void AppendAssetsToPreload(UPARAM(ref) TArray<TSoftObjectPtr<UObject>>& Assets) const {}
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable Projectile Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableProjectileActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolableProjectileActorDescription Description;
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable Static Mesh Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableStaticMeshActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolableStaticMeshActorDescription Description;
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable Skeletal Mesh Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableSkeletalMeshActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolableSkeletalMeshActorDescription Description;
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable Decal Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableDecalActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolableDecalActorDescription Description;
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable Niagara Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableNiagaraActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolableNiagaraActorDescription Description;
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable Sound Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolableSoundActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolableSoundActorDescription Description;
+};
+
+
+UCLASS(meta=(DisplayName="BF Poolable 3D Widget Actor Preset"))
+class BFOBJECTPOOLING_API UBFPoolable3DWidgetActorPreset : public UBFPoolableActorPreset
+{
+	GENERATED_BODY()
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+	virtual void AppendAssetsToPreload(TArray<TSoftObjectPtr<UObject>>& Assets) const override;
+	
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF|Preset", meta=(ShowOnlyInnerProperties))
+	FBFPoolable3DWidgetActorDescription Description;
+};
@@ -35,15 +35,8 @@ void ABFPoolableDecalActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle,
 	
 	SetPoolHandleBP(Handle);
 	SetPoolableActorParams(ActivationParams);
-	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
-
-	SetActorHiddenInGame(false);
 	SetActorTickEnabled(true);
-	
-	SetActorTransform(ActorTransform);
-	ActivatePoolableActor();
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -55,9 +48,35 @@ void ABFPoolableDecalActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoolableDe
 	
 	SetPoolHandle(Handle);
 	SetPoolableActorParams(ActivationParams);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableDecalActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolableDecalActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
 	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	SetActorTickEnabled(true);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableDecalActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableDecalActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableDecalActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableDecalActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	if(GetActivationInfo().ActorCurfew > 0)
+		SetCurfew(GetActivationInfo().ActorCurfew);
 	
 	SetActorHiddenInGame(false);
 	
@@ -68,10 +87,18 @@ void ABFPoolableDecalActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoolableDe
 
 void ABFPoolableDecalActor::SetPoolableActorParams( const FBFPoolableDecalActorDescription& ActivationParams)
 {
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams;
 }
 
 
+void ABFPoolableDecalActor::SetPoolableActorPreset(const UBFPoolableDecalActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
+
 void ABFPoolableDecalActor::ActivatePoolableActor()
 {
 	SetupObjectState();
@@ -80,16 +107,23 @@ void ABFPoolableDecalActor::ActivatePoolableActor()
 
 void ABFPoolableDecalActor::SetupObjectState()
 {
-	bfValid(ActivationInfo.DecalMaterial); // you must set the decal material
-	DecalComponent->SetMaterial(0, ActivationInfo.DecalMaterial);
-	DecalComponent->DecalSize = ActivationInfo.DecalExtent;
-	DecalComponent->SortOrder = ActivationInfo.SortOrder;
+	const FBFPoolableDecalActorDescription& Info = GetActivationInfo();
+	bfEnsure(!Info.DecalMaterial.IsNull()); // you must set the decal material
+
+	// Same preset as last time means the component already has this material, size and sort order.
+	if(!IsPresetAlreadyApplied())
+	{
+		DecalComponent->SetMaterial(0, BF::OP::ResolveSoftAsset(Info.DecalMaterial));
+		DecalComponent->DecalSize = Info.DecalExtent;
+		DecalComponent->SortOrder = Info.SortOrder;
+		LastAppliedPreset = ActivePreset;
+	}
 	
-	if(ActivationInfo.FadeInTime > 0)
+	if(Info.FadeInTime > 0)
 	{
 		float FadeDurationScale = BF::OP::DecalFadeDurationCVar->GetValueOnGameThread();
 		DecalComponent->FadeInStartDelay = 0.f;
-		DecalComponent->FadeInDuration = FadeDurationScale > KINDA_SMALL_NUMBER ? ActivationInfo.FadeInTime / FadeDurationScale : KINDA_SMALL_NUMBER;
+		DecalComponent->FadeInDuration = FadeDurationScale > KINDA_SMALL_NUMBER ? Info.FadeInTime / FadeDurationScale : KINDA_SMALL_NUMBER;
 		
 		if(DecalComponent->SceneProxy)
 			GetWorld()->Scene->UpdateDecalFadeOutTime(DecalComponent);
@@ -127,7 +161,10 @@ void ABFPoolableDecalActor::OnObjectPooled_Implementation()
 
 	ObjectHandle = nullptr;
 	BPObjectHandle = nullptr;
-	ActivationInfo = {};
+	if(ActivePreset)
+		ActivePreset = nullptr; // Keep LastAppliedPreset, the components still hold its assets.
+	else
+		ActivationInfo = {};
 }
 
 
@@ -166,36 +203,34 @@ void ABFPoolableDecalActor::SetCurfew(float SecondsUntilReturn)
 {
 	bfEnsure(SecondsUntilReturn > 0);
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, this, &ABFPoolableDecalActor::OnCurfewExpired, SecondsUntilReturn, false);
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolableDecalActor::OnCurfewExpired));
 }
 
 
 void ABFPoolableDecalActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-	
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
 void ABFPoolableDecalActor::OnCurfewExpired()
 {
-	if(ActivationInfo.FadeOutTime > 0)
+	const float FadeOutTime = GetActivationInfo().FadeOutTime;
+	if(FadeOutTime > 0)
 	{
 		float FadeDurationScale = BF::OP::DecalFadeDurationCVar->GetValueOnGameThread();
 		DecalComponent->FadeStartDelay = 0.f;
-		DecalComponent->FadeDuration = FadeDurationScale > KINDA_SMALL_NUMBER ? ActivationInfo.FadeOutTime / FadeDurationScale : KINDA_SMALL_NUMBER;
+		DecalComponent->FadeDuration = FadeDurationScale > KINDA_SMALL_NUMBER ? FadeOutTime / FadeDurationScale : KINDA_SMALL_NUMBER;
 		
 		if(DecalComponent->SceneProxy)
 			GetWorld()->Scene->UpdateDecalFadeOutTime(DecalComponent);
 		else
 			DecalComponent->MarkRenderStateDirty();
 
-		FTimerDelegate TimerDel;
-		FTimerHandle TimerHandle;
-		TimerDel.BindWeakLambda(this, [this]() { ReturnToPool(); });
-		GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDel, DecalComponent->FadeDuration, false);
+		// Re-armed as the curfew so returning early (or re-firing) mid fade clears it.
+		BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, DecalComponent->FadeDuration,
+			FSimpleDelegate::CreateWeakLambda(this, [this]() { ReturnToPool(); }));
 		return;
 	}
 	ReturnToPool();
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "BFObjectPooling/Pool/BFObjectPool.h"
 #include "BFObjectPooling/Interfaces/BFPooledObjectInterface.h"
 #include "BFObjectPooling/Pool/BFPooledObjectHandle.h"
@@ -50,6 +51,11 @@ public:
 		const FBFPoolableDecalActorDescription& ActivationParams, const FTransform& ActorTransform);
 
 
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and asset setup is skipped when this actor last activated with the same preset. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Decal Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolableDecalActorPreset* Preset, const FTransform& ActorTransform);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableDecalActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableDecalActorPreset* Preset, const FTransform& ActorTransform);
 	
 
 	/** Used when manually controlling this pooled actor, otherwise you should use FireAndForget. This is typically handed to the pooled actor because you are now ready to let the pooled actor handle its own
@@ -64,6 +70,13 @@ public:
 	// If you are manually wanting to control the system then you can set its params here and call ActivatePoolableActor yourself if you want to just simply activate it and let it return when done see FireAndForget.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Decal Actor")
 	virtual void SetPoolableActorParams(const FBFPoolableDecalActorDescription& ActivationParams);
+
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Decal Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolableDecalActorPreset* Preset);
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolableDecalActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
 	
 	/*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	 *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
@@ -91,6 +104,12 @@ protected:
 	
 	// Called just prior to being activated in the world.
 	virtual void SetupObjectState();
+
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
+
+	// True when the active preset is the one we last set our assets up with, so only per activation state needs applying.
+	bool IsPresetAlreadyApplied() const { return ActivePreset && ActivePreset == LastAppliedPreset; }
 protected:
 	/* BP pools store UObject handles for convenience and I cant template member functions (:
 	 * So I have decided for everyone that we non ThreadSafe for performance benefits, you are using Multithreading with BP typically. You can always implement your own classes anyway.  */
@@ -103,6 +122,13 @@ protected:
 	FBFPoolableDecalActorDescription ActivationInfo;
 	FTimerHandle CurfewTimerHandle;
 
+	// Presets are referenced, not copied. LastAppliedPreset survives being pooled so the next activation with the same preset can skip asset setup.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableDecalActorPreset> ActivePreset = nullptr;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableDecalActorPreset> LastAppliedPreset = nullptr;
+
 	UPROPERTY(Transient)
 	uint32 bIsUsingBPHandle:1 = false;
 };
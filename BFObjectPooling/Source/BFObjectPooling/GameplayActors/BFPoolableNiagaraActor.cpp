@@ -4,6 +4,7 @@
 #include "BFPoolableNiagaraActor.h"
 #include "NiagaraComponent.h"
 #include "NiagaraSystem.h"
+#include "NiagaraWorldManager.h"
 #include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
 #include "BFObjectPooling/PoolBP/BFPooledObjectHandleBP.h"
 
@@ -32,36 +33,11 @@ void ABFPoolableNiagaraActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle,
 		const FBFPoolableNiagaraActorDescription& ActivationParams, const FTransform& ActorTransform)
 {
 	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
-	bfValid(ActivationParams.NiagaraSystem); // you must set the system
-
+	bfEnsure(!ActivationParams.NiagaraSystem.IsNull()); // you must set the system
 
 	SetPoolHandleBP(Handle);
-	SetActorTransform(ActorTransform);
 	SetPoolableActorParams(ActivationParams);
-	
-	if(ActivationInfo.ActorCurfew > 0)
-	{
-		if(ActivationInfo.DelayedActivationTimeSeconds > 0)
-			ActivationInfo.ActorCurfew += ActivationInfo.DelayedActivationTimeSeconds;
-		
-		SetCurfew(ActivationInfo.ActorCurfew);
-	}
-
-	if(ActivationInfo.DelayedActivationTimeSeconds > 0)
-	{
-		FTimerDelegate TimerDel;
-		TimerDel.BindWeakLambda(this, [this]()
-		{
-			SetActorHiddenInGame(false);
-			ActivatePoolableActor();
-		});
-		GetWorld()->GetTimerManager().SetTimer(DelayedActivationTimerHandle, TimerDel, ActivationInfo.DelayedActivationTimeSeconds, false);
-	}
-	else // Start it now
-	{
-		SetActorHiddenInGame(false);
-		ActivatePoolableActor();
-	}
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -69,27 +45,60 @@ void ABFPoolableNiagaraActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoolable
 		const FBFPoolableNiagaraActorDescription& ActivationParams, const FTransform& ActorTransform)
 {
 	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
-	bfValid(ActivationParams.NiagaraSystem); // you must set the system
+	bfEnsure(!ActivationParams.NiagaraSystem.IsNull()); // you must set the system
 
-	// Even if delayed we set the transform and stay waiting hidden until the delayed activation time.
 	SetPoolHandle(Handle);
-	SetActorTransform(ActorTransform);
 	SetPoolableActorParams(ActivationParams);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableNiagaraActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolableNiagaraActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableNiagaraActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableNiagaraActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableNiagaraActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
 	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
 
 
-	if(ActivationInfo.DelayedActivationTimeSeconds > 0)
+void ABFPoolableNiagaraActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	const FBFPoolableNiagaraActorDescription& Info = GetActivationInfo();
+	if(Info.bPreCullWithScalability && WouldSystemBePreCulled(this, Info, ActorTransform.GetLocation()))
+	{
+		// Already un-pooled, but nothing has been activated yet so handing it straight back is cheap.
+		ReturnToPool();
+		return;
+	}
+	
+	// Even if delayed we set the transform and stay waiting hidden until the delayed activation time.
+	SetActorTransform(ActorTransform);
+	
+	// The curfew starts from activation so delayed systems still get their full lifetime.
+	if(Info.ActorCurfew > 0)
+		SetCurfew(Info.ActorCurfew + FMath::Max(Info.DelayedActivationTimeSeconds, 0.f));
+
+	if(Info.DelayedActivationTimeSeconds > 0)
 	{
-		FTimerHandle TimerHandle;
 		FTimerDelegate TimerDel;
 		TimerDel.BindWeakLambda(this, [this]()
 		{
 			SetActorHiddenInGame(false);
 			ActivatePoolableActor();
 		});
-		GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDel, ActivationInfo.DelayedActivationTimeSeconds, false);
+		GetWorld()->GetTimerManager().SetTimer(DelayedActivationTimerHandle, TimerDel, Info.DelayedActivationTimeSeconds, false);
 	}
 	else // Start it now
 	{
@@ -101,15 +110,39 @@ void ABFPoolableNiagaraActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoolable
 
 void ABFPoolableNiagaraActor::SetPoolableActorParams(const FBFPoolableNiagaraActorDescription& ActivationParams)
 {
-	bfValid(ActivationParams.NiagaraSystem); // You must set the system for a niagara actor otherwise what is the point.
+	bfEnsure(!ActivationParams.NiagaraSystem.IsNull()); // You must set the system for a niagara actor otherwise what is the point.
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams;
 }
 
 
+void ABFPoolableNiagaraActor::SetPoolableActorPreset(const UBFPoolableNiagaraActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
+
+FBFPoolableNiagaraActorDescription& ABFPoolableNiagaraActor::GetMutableActivationInfo()
+{
+	if(ActivePreset)
+	{
+		ActivationInfo = ActivePreset->Description;
+		ActivePreset = nullptr;
+	}
+	return ActivationInfo;
+}
+
+
 void ABFPoolableNiagaraActor::ActivatePoolableActor()
 {
-	bfValid(ActivationInfo.NiagaraSystem); // You must set the system
-	GetNiagaraComponent()->SetAsset(ActivationInfo.NiagaraSystem);
+	bfEnsure(!GetActivationInfo().NiagaraSystem.IsNull()); // You must set the system
+
+	// Same preset as last time means the component already has the system, a reset is all thats needed.
+	if(!IsPresetAlreadyApplied())
+		GetNiagaraComponent()->SetAsset(BF::OP::ResolveSoftAsset(GetActivationInfo().NiagaraSystem));
+	
+	LastAppliedPreset = ActivePreset;
 	ResetSystem();
 }
 
@@ -144,7 +177,10 @@ void ABFPoolableNiagaraActor::OnObjectPooled_Implementation()
 	BPObjectHandle = nullptr;
 	bHasFinished = false; 
 	OnNiagaraSystemFinishedDelegate.Clear();
-	ActivationInfo = {};
+	if(ActivePreset)
+		ActivePreset = nullptr; // Keep LastAppliedPreset, the components still hold its assets.
+	else
+		ActivationInfo = {};
 	
 	if(GetNiagaraComponent())
 		GetNiagaraComponent()->DeactivateImmediate();
@@ -202,6 +238,19 @@ void ABFPoolableNiagaraActor::ResetSystem()
 }
 
 
+bool ABFPoolableNiagaraActor::WouldSystemBePreCulled(const UObject* WorldContextObject, const FBFPoolableNiagaraActorDescription& Description, const FVector& Location)
+{
+	UNiagaraSystem* System = Description.NiagaraSystem.Get();
+	UWorld* World = GEngine && System ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if(!World)
+		return false;
+
+	// The world manager caches the player views and effect type instance counts per frame, so this is only a handful of compares.
+	FNiagaraWorldManager* WorldManager = FNiagaraWorldManager::Get(World);
+	return WorldManager && WorldManager->ShouldPreCull(System, Location);
+}
+
+
 bool ABFPoolableNiagaraActor::IsSystemLooping() const
 {
 	if(GetNiagaraComponent() && !GetNiagaraComponent()->IsComplete() && GetNiagaraComponent()->GetAsset())
@@ -214,16 +263,14 @@ void ABFPoolableNiagaraActor::SetCurfew(float SecondsUntilReturn)
 {
 	bfEnsure(SecondsUntilReturn > 0);
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, this,  &ABFPoolableNiagaraActor::OnCurfewExpired, SecondsUntilReturn);
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolableNiagaraActor::OnCurfewExpired));
 }
 
 
 void ABFPoolableNiagaraActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
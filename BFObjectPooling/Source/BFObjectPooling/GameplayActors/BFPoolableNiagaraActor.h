@@ -7,6 +7,7 @@
 #include "BFObjectPooling/Pool/BFObjectPool.h"
 #include "BFObjectPooling/Pool/BFPooledObjectHandle.h"
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "GameFramework/Actor.h"
 #include "BFPoolableNiagaraActor.generated.h"
 
@@ -56,7 +57,13 @@ public:
 	// For easy fire and forget usage, will invalidate the Handle as the PoolActor now takes responsibility for returning based on our poolable actor params.
 	virtual void FireAndForget(TBFPooledObjectHandlePtr<ABFPoolableNiagaraActor, ESPMode::NotThreadSafe>& Handle, 
 		const FBFPoolableNiagaraActorDescription& ActivationParams, const FTransform& ActorTransform);
-	
+
+
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and asset setup is skipped when this actor last activated with the same preset. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolableNiagaraActorPreset* Preset, const FTransform& ActorTransform);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableNiagaraActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableNiagaraActorPreset* Preset, const FTransform& ActorTransform);
 
 	
 	/** Used when manually controlling this pooled actor, otherwise you should use FireAndForget. This is typically handed to the pooled actor because you are now ready to let the pooled actor handle its own
@@ -72,6 +79,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
 	virtual void SetPoolableActorParams(const FBFPoolableNiagaraActorDescription& ActivationParams);
 
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolableNiagaraActorPreset* Preset);
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolableNiagaraActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
+
 	/*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	 *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
@@ -96,11 +110,11 @@ public:
 
 	// Enables or disables the auto return on system finish. If enabled the system will attempt to return to the pool when it finishes but it requires you have to set the handle via SetPoolHandle or FireAndForget.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
-	void SetAutoReturnOnSystemFinish(bool bShouldAutoReturnOnSoundFinish) { ActivationInfo.bAutoReturnOnSystemFinish = bShouldAutoReturnOnSoundFinish; }
+	void SetAutoReturnOnSystemFinish(bool bShouldAutoReturnOnSoundFinish) { GetMutableActivationInfo().bAutoReturnOnSystemFinish = bShouldAutoReturnOnSoundFinish; }
 
 	// Is this system set to automatically return to the pool when the system finishes.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
-	bool GetAutoReturnOnSystemFinish() const { return ActivationInfo.bAutoReturnOnSystemFinish; }
+	bool GetAutoReturnOnSystemFinish() const { return GetActivationInfo().bAutoReturnOnSystemFinish; }
 	
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
 	bool HasSystemFinished() const { return bHasFinished; }
@@ -117,12 +131,26 @@ public:
 		
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor")
 	UNiagaraSystem* GetNiagaraSystem() const;
+
+	/** True if Niagara would cull the descriptions system at Location before it even spawned, the same pre cull UNiagaraFunctionLibrary::SpawnSystemAtLocation does using the
+	 * effect types distance, instance count and view frustum settings. Significance culling needs a live instance so isn't covered, unloaded systems are never culled. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Niagara Actor", meta=(WorldContext="WorldContextObject"))
+	static bool WouldSystemBePreCulled(const UObject* WorldContextObject, const FBFPoolableNiagaraActorDescription& Description, const FVector& Location);
 	
 protected:
 	UFUNCTION(CallInEditor)
 	virtual void OnNiagaraSystemFinished(UNiagaraComponent* FinishedComponent);
 
 	virtual void OnCurfewExpired();
+
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
+
+	// True when the active preset is the one we last set our assets up with, so only per activation state needs applying.
+	bool IsPresetAlreadyApplied() const { return ActivePreset && ActivePreset == LastAppliedPreset; }
+
+	// Copy on write access for setters, a preset is never modified so the first write copies it into our own ActivationInfo and drops the preset.
+	FBFPoolableNiagaraActorDescription& GetMutableActivationInfo();
 public:
 	UPROPERTY(BlueprintAssignable, Category="BF| Poolable Niagara Actor")
 	FOnPoolableNiagaraSystemFinished OnNiagaraSystemFinishedDelegate;
@@ -139,6 +167,13 @@ protected:
 	FTimerHandle CurfewTimerHandle;
 	FTimerHandle DelayedActivationTimerHandle;
 
+	// Presets are referenced, not copied. LastAppliedPreset survives being pooled so the next activation with the same preset can skip asset setup.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableNiagaraActorPreset> ActivePreset = nullptr;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableNiagaraActorPreset> LastAppliedPreset = nullptr;
+
 	UPROPERTY(Transient, BlueprintReadOnly)
 	uint32 bHasFinished:1 = false;
 	uint32 bIsUsingBPHandle:1 = false;
@@ -3,6 +3,7 @@
 
 
 #include "BFPoolableProjectileActor.h"
+#include "BFProjectileSimulationSubsystem.h"
 #include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
 #include "BFObjectPooling/PoolBP/BFPooledObjectHandleBP.h"
 #include "Niagara/Classes/NiagaraSystem.h"
@@ -20,9 +21,10 @@ ABFPoolableProjectileActor::ABFPoolableProjectileActor(const FObjectInitializer&
 	PrimaryActorTick.bCanEverTick = false;
 	PrimaryActorTick.bStartWithTickEnabled = false;
 
-	// Start with a SceneComponent in case we don't need a shape collision component.
-	RootComponent = CreateDefaultSubobject<USceneComponent>("RootComponent");
-	RootComponent->SetMobility(EComponentMobility::Movable);
+	// Start with a SceneComponent in case we don't need a shape collision component, kept around as the root for NoCollisionShape.
+	SceneRootComponent = CreateDefaultSubobject<USceneComponent>("RootComponent");
+	SceneRootComponent->SetMobility(EComponentMobility::Movable);
+	RootComponent = SceneRootComponent;
 	
 	ProjectileMovementComponent = CreateDefaultSubobject<UProjectileMovementComponent>("ProjectileMovementComponent");
 }
@@ -41,14 +43,7 @@ void ABFPoolableProjectileActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle
 	
 	SetPoolHandleBP(Handle);
 	SetPoolableActorParams(ActivationParams);
-
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
-
-	SetActorEnableCollision(true);
-	
-	SetActorTransform(ActorTransform);
-	ActivatePoolableActor();
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -59,9 +54,41 @@ void ABFPoolableProjectileActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoola
 
 	SetPoolHandle(Handle);
 	SetPoolableActorParams(ActivationParams);
+	FireAndForget_Internal(ActorTransform);
+}
 
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+
+void ABFPoolableProjectileActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolableProjectileActorPreset* Preset, const FTransform& ActorTransform,
+	FVector Velocity, bool bOverrideVelocity, USceneComponent* HomingTargetComponent)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
+
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	if(bOverrideVelocity)
+		SetShotVelocityOverride(Velocity);
+	SetShotHomingTarget(HomingTargetComponent);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableProjectileActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableProjectileActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableProjectileActorPreset* Preset,
+	const FTransform& ActorTransform, const TOptional<FVector>& Velocity, USceneComponent* HomingTargetComponent)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
+
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	VelocityOverride = Velocity;
+	SetShotHomingTarget(HomingTargetComponent);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableProjectileActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	if(GetActivationInfo().ActorCurfew > 0)
+		SetCurfew(GetActivationInfo().ActorCurfew);
 
 	SetActorEnableCollision(true);
 	
@@ -72,16 +99,25 @@ void ABFPoolableProjectileActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoola
 
 void ABFPoolableProjectileActor::SetPoolableActorParams( const FBFPoolableProjectileActorDescription& ActivationParams)
 {
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams;
 }
 
 
+void ABFPoolableProjectileActor::SetPoolableActorPreset(const UBFPoolableProjectileActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
+
 void ABFPoolableProjectileActor::ActivatePoolableActor()
 {
 	HandleComponentCreation();
 	SetupObjectState();
 	
-	if((ActivationInfo.ProjectileMesh.Mesh || ActivationInfo.NiagaraSystem) && IsHidden())
+	const FBFPoolableProjectileActorDescription& Info = GetActivationInfo();
+	if((!Info.ProjectileMesh.Mesh.IsNull() || !Info.NiagaraSystem.IsNull()) && IsHidden())
 		SetActorHiddenInGame(false); // make sure we are visible when it matters
 }
 
@@ -90,26 +126,65 @@ void ABFPoolableProjectileActor::SetupObjectState()
 {
 	bfValid(ProjectileMovementComponent);
 
-	if(ActivationInfo.bIsVelocityInLocalSpace)
-		ActivationInfo.Velocity = GetActorTransform().TransformVector(ActivationInfo.Velocity);
+	const FBFPoolableProjectileActorDescription& Info = GetActivationInfo();
+
+	// Resolved into the movement component rather than written back to the description, presets are shared and the description may be re-used.
+	FVector Velocity = VelocityOverride.Get(Info.Velocity);
+	if(Info.bIsVelocityInLocalSpace)
+		Velocity = GetActorTransform().TransformVector(Velocity);
+
+	USceneComponent* HomingTarget = HomingTargetOverride.IsValid() ? HomingTargetOverride.Get() : Info.HomingTargetComponent.Get();
 	
-	ProjectileMovementComponent->bSweepCollision = ActivationInfo.bSweepCollision;
-	ProjectileMovementComponent->bShouldBounce = ActivationInfo.bShouldBounce;
-	ProjectileMovementComponent->bRotationFollowsVelocity = ActivationInfo.bRotationFollowsVelocity;
-	ProjectileMovementComponent->bRotationRemainsVertical = ActivationInfo.bRotationRemainsVertical;
-
-	ProjectileMovementComponent->Velocity = ActivationInfo.Velocity;
-	ProjectileMovementComponent->MaxSpeed = ActivationInfo.MaxSpeed;
-	ProjectileMovementComponent->Bounciness = ActivationInfo.Bounciness;
-	ProjectileMovementComponent->ProjectileGravityScale = ActivationInfo.ProjectileGravityScale;
-	ProjectileMovementComponent->Friction = ActivationInfo.Friction;
+	ProjectileMovementComponent->bSweepCollision = Info.bSweepCollision;
+	ProjectileMovementComponent->bShouldBounce = Info.bShouldBounce;
+	ProjectileMovementComponent->bRotationFollowsVelocity = Info.bRotationFollowsVelocity;
+	ProjectileMovementComponent->bRotationRemainsVertical = Info.bRotationRemainsVertical;
+
+	ProjectileMovementComponent->Velocity = Velocity;
+	ProjectileMovementComponent->MaxSpeed = Info.MaxSpeed;
+	ProjectileMovementComponent->Bounciness = Info.Bounciness;
+	ProjectileMovementComponent->ProjectileGravityScale = Info.ProjectileGravityScale;
+	ProjectileMovementComponent->Friction = Info.Friction;
 	
-	ProjectileMovementComponent->bIsHomingProjectile = ActivationInfo.HomingTargetComponent != nullptr;
-	ProjectileMovementComponent->HomingTargetComponent = ActivationInfo.HomingTargetComponent;
-	ProjectileMovementComponent->HomingAccelerationMagnitude = ActivationInfo.HomingAccelerationSpeed;
+	ProjectileMovementComponent->bIsHomingProjectile = HomingTarget != nullptr;
+	ProjectileMovementComponent->HomingTargetComponent = HomingTarget;
+	ProjectileMovementComponent->HomingAccelerationMagnitude = Info.HomingAccelerationSpeed;
 	
 	ProjectileMovementComponent->SetUpdatedComponent(RootComponent); // When we come to a full stop it auto nulls this for whatever reason epic?
-	ProjectileMovementComponent->SetComponentTickEnabled(true);
+
+	// The movement component still holds the resolved settings so anything reading it (and the velocity written back on unregister) sees the same values.
+	UBFProjectileSimulationSubsystem* Simulation = Info.bUseBatchedSimulation ? UBFProjectileSimulationSubsystem::Get(this) : nullptr;
+	if(Simulation)
+	{
+		FBFProjectileSimulationParams Params;
+		Params.Velocity = Velocity;
+		Params.HomingTarget = HomingTarget;
+		Params.MaxSpeed = Info.MaxSpeed;
+		Params.GravityScale = Info.ProjectileGravityScale;
+		Params.Bounciness = Info.Bounciness;
+		Params.Friction = Info.Friction;
+		Params.HomingAcceleration = Info.HomingAccelerationSpeed;
+		Params.BounceStopSpeed = ProjectileMovementComponent->BounceVelocityStopSimulatingThreshold;
+		Params.bShouldBounce = Info.bShouldBounce;
+		Params.bSweepCollision = Info.bSweepCollision;
+		Params.bRotationFollowsVelocity = Info.bRotationFollowsVelocity;
+		Params.bRotationRemainsVertical = Info.bRotationRemainsVertical;
+		Params.bBounceAngleAffectsFriction = ProjectileMovementComponent->bBounceAngleAffectsFriction;
+		
+		ProjectileMovementComponent->SetComponentTickEnabled(false);
+		Simulation->RegisterProjectile(this, Params);
+	}
+	else
+	{
+		if(BatchedSimulationIndex != INDEX_NONE)
+		{
+			// Re-activated while batched without asking for it anymore.
+			if(UBFProjectileSimulationSubsystem* OldSimulation = UBFProjectileSimulationSubsystem::Get(this))
+				OldSimulation->UnregisterProjectile(this);
+			ProjectileMovementComponent->Velocity = Velocity;
+		}
+		ProjectileMovementComponent->SetComponentTickEnabled(true);
+	}
 }
 
 
@@ -138,9 +213,21 @@ void ABFPoolableProjectileActor::OnObjectPooled_Implementation()
 	ObjectHandle = nullptr;
 	BPObjectHandle = nullptr;
 
-	ActivationInfo = {};
+	if(ActivePreset)
+		ActivePreset = nullptr; // Keep LastAppliedPreset, the components still hold its assets.
+	else
+		ActivationInfo = {};
+	
+	VelocityOverride.Reset();
+	HomingTargetOverride = nullptr;
 	ProjectileMovementComponent->SetComponentTickEnabled(false);
 
+	if(BatchedSimulationIndex != INDEX_NONE)
+	{
+		if(UBFProjectileSimulationSubsystem* Simulation = UBFProjectileSimulationSubsystem::Get(this))
+			Simulation->UnregisterProjectile(this);
+	}
+
 	if(OptionalNiagaraComponent)
 	{
 		OptionalNiagaraComponent->Deactivate();
@@ -197,135 +284,67 @@ void ABFPoolableProjectileActor::FellOutOfWorld(const UDamageType& DmgType)
 
 bool ABFPoolableProjectileActor::HandleComponentCreation()
 {
-	// Basically if we have a collision type we ensure that we also have valid data for that type
-	bfEnsure(ActivationInfo.ProjectileCollisionShape.CollisionShapeType == EBFCollisionShapeType::NoCollisionShape ||
-		(ActivationInfo.ProjectileCollisionShape.CollisionProfile.Name != NAME_None &&
-		!ActivationInfo.ProjectileCollisionShape.ShapeParams.IsNearlyZero()));
-
-	bool bUpdatedRoot = false;
+	const FBFPoolableProjectileActorDescription& Info = GetActivationInfo();
+	const bool bPresetApplied = IsPresetAlreadyApplied();
 	
-	/** The main purpose here is to reuse the existing component when possible and
-	 * when its not because this time around being activated we have a different collision
-	 * shape or none at all, then I need to handle setting up this projectile. */
-	switch(ActivationInfo.ProjectileCollisionShape.CollisionShapeType)
-	{
-		case EBFCollisionShapeType::Box:
-		{
-			UBoxComponent* Comp = nullptr;
-			if(!IsValid(RootComponent) || !RootComponent->IsA<UBoxComponent>())
-			{
-				Comp = BF::OP::NewComponent<UBoxComponent>(this, nullptr, "BoxCollisionComponent");
-				bUpdatedRoot = true;
-			}
-			else
-				Comp = CastChecked<UBoxComponent>(RootComponent);	
-
-			Comp->SetBoxExtent(ActivationInfo.ProjectileCollisionShape.ShapeParams);
-			Comp->SetCollisionProfileName(ActivationInfo.ProjectileCollisionShape.CollisionProfile.Name);
-			Comp->OnComponentHit.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorHit);
-			Comp->OnComponentBeginOverlap.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorOverlap);
-
-			if(bUpdatedRoot)
-			{
-				Comp->SetWorldTransform(GetActorTransform());
+	// Basically if we have a collision type we ensure that we also have valid data for that type
+	bfEnsure(Info.ProjectileCollisionShape.CollisionShapeType == EBFCollisionShapeType::NoCollisionShape ||
+		(Info.ProjectileCollisionShape.CollisionProfile.Name != NAME_None &&
+		!Info.ProjectileCollisionShape.ShapeParams.IsNearlyZero()));
 
-				UActorComponent* OldComp = RootComponent;
-				SetRootComponent(Comp);
-				if(OldComp)
-					OldComp->DestroyComponent();
+	/** The main purpose here is to reuse the existing component when possible, a different shape than last time swaps in the cached
+	 * component for it (only created the first time any activation asks for that shape) and leaves the old root dormant. */
+	const FBFCollisionShapeDescription& ShapeInfo = Info.ProjectileCollisionShape;
+	USceneComponent* NewRoot = FindOrCreateRootComponent(ShapeInfo.CollisionShapeType);
+	const bool bUpdatedRoot = NewRoot != RootComponent;
 
-				ProjectileMovementComponent->SetUpdatedComponent(Comp);
-			}
-			break;
-		}
-		case EBFCollisionShapeType::Sphere:
+	if(UShapeComponent* Shape = Cast<UShapeComponent>(NewRoot))
+	{
+		// A cached shape may still have the size of whatever last used it.
+		if(bUpdatedRoot || !bPresetApplied)
 		{
-			USphereComponent* Comp = nullptr;
-			if(!IsValid(RootComponent) || !RootComponent->IsA<USphereComponent>())
-			{
-				Comp = BF::OP::NewComponent<USphereComponent>(this, nullptr, "SphereCollisionComponent");
-				bUpdatedRoot = true;
-			}
-			else
-				Comp = CastChecked<USphereComponent>(RootComponent);
-				
-
-			Comp->SetSphereRadius(ActivationInfo.ProjectileCollisionShape.ShapeParams.X);
-			Comp->SetCollisionProfileName(ActivationInfo.ProjectileCollisionShape.CollisionProfile.Name);
-			Comp->OnComponentHit.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorHit);
-			Comp->OnComponentBeginOverlap.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorOverlap);
-
-			if(bUpdatedRoot)
+			switch(ShapeInfo.CollisionShapeType)
 			{
-				Comp->SetWorldTransform(GetActorTransform());
-				UActorComponent* OldComp = RootComponent;
-				SetRootComponent(Comp);
-				if(OldComp)
-					OldComp->DestroyComponent();
-				ProjectileMovementComponent->SetUpdatedComponent(Comp);
+				case EBFCollisionShapeType::Box: CastChecked<UBoxComponent>(Shape)->SetBoxExtent(ShapeInfo.ShapeParams); break;
+				case EBFCollisionShapeType::Sphere: CastChecked<USphereComponent>(Shape)->SetSphereRadius(ShapeInfo.ShapeParams.X); break;
+				case EBFCollisionShapeType::Capsule: CastChecked<UCapsuleComponent>(Shape)->SetCapsuleSize(ShapeInfo.ShapeParams.X, ShapeInfo.ShapeParams.Y); break;
+				default: break;
 			}
-			break;
 		}
-		case EBFCollisionShapeType::Capsule:
-		{
-			UCapsuleComponent* Comp = nullptr;
-			if(!IsValid(RootComponent) || !RootComponent->IsA<UCapsuleComponent>())
-			{
-				bUpdatedRoot = true;
-				Comp = BF::OP::NewComponent<UCapsuleComponent>(this, nullptr, "CapsuleCollisionComponent");
-			}
-			else
-				Comp = CastChecked<UCapsuleComponent>(RootComponent);
-
-			Comp->SetCapsuleSize(ActivationInfo.ProjectileCollisionShape.ShapeParams.X, ActivationInfo.ProjectileCollisionShape.ShapeParams.Y);
-			Comp->SetCollisionProfileName(ActivationInfo.ProjectileCollisionShape.CollisionProfile.Name);
-			Comp->OnComponentHit.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorHit);
-			Comp->OnComponentBeginOverlap.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorOverlap);
+		Shape->SetCollisionProfileName(ShapeInfo.CollisionProfile.Name);
+		Shape->OnComponentHit.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorHit);
+		Shape->OnComponentBeginOverlap.AddDynamic(this, &ABFPoolableProjectileActor::OnProjectileActorOverlap);
+	}
 
-			if(bUpdatedRoot)
-			{
-				Comp->SetWorldTransform(GetActorTransform());
-				UActorComponent* OldComp = RootComponent;
-				SetRootComponent(Comp);
-				if(OldComp)
-					OldComp->DestroyComponent();
-				ProjectileMovementComponent->SetUpdatedComponent(Comp);
-			}
-			break;
-		}
-		case EBFCollisionShapeType::NoCollisionShape:
-			{
-				if(!IsValid(RootComponent) || RootComponent->IsA<USphereComponent>() || RootComponent->IsA<UBoxComponent>() || RootComponent->IsA<UCapsuleComponent>())
-				{
-					USceneComponent* Comp = BF::OP::NewComponent<USceneComponent>(this, nullptr, "SceneRootComponent");
-					Comp->SetWorldTransform(GetActorTransform());
-					UActorComponent* OldComp = RootComponent;
-					SetRootComponent(Comp);
-					if(OldComp)
-						OldComp->DestroyComponent();
-					ProjectileMovementComponent->SetUpdatedComponent(Comp);
-					bUpdatedRoot = true;
-				}
-				break;
-			}
+	if(bUpdatedRoot)
+	{
+		NewRoot->SetWorldTransform(GetActorTransform());
+		USceneComponent* OldRoot = RootComponent;
+		SetRootComponent(NewRoot);
+		ProjectileMovementComponent->SetUpdatedComponent(NewRoot);
+
+		// Stays registered but detached, so it costs no transform updates. The mesh/niagara below re-attach to the new root.
+		if(UShapeComponent* OldShape = Cast<UShapeComponent>(OldRoot))
+			OldShape->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	}
 
 	
 	// Handle Component attachment, no need to pay transform updates if we aren't using the component.
-	if(IsValid(ActivationInfo.ProjectileMesh.Mesh))
+	if(!Info.ProjectileMesh.Mesh.IsNull())
 	{
-		if(!OptionalStaticMeshComponent)
-			OptionalStaticMeshComponent = BF::OP::NewComponent<UStaticMeshComponent>(this, nullptr, "StaticMeshComponent");
-
+		FindOrCreateStaticMeshComponent();
 		OptionalStaticMeshComponent->SetSimulatePhysics(false);
 		OptionalStaticMeshComponent->SetVisibility(true);
 		OptionalStaticMeshComponent->AttachToComponent(RootComponent, FAttachmentTransformRules::SnapToTargetIncludingScale);
-		OptionalStaticMeshComponent->SetStaticMesh(ActivationInfo.ProjectileMesh.Mesh);
+		if(!bPresetApplied)
+		{
+			OptionalStaticMeshComponent->SetStaticMesh(BF::OP::ResolveSoftAsset(Info.ProjectileMesh.Mesh));
 		
-		for(const auto& [Material, Slot] : ActivationInfo.ProjectileMesh.Materials)
-			OptionalStaticMeshComponent->SetMaterial(Slot, Material);
+			for(const auto& [Material, Slot] : Info.ProjectileMesh.Materials)
+				OptionalStaticMeshComponent->SetMaterial(Slot, BF::OP::ResolveSoftAsset(Material));
+		}
 
-		OptionalStaticMeshComponent->SetRelativeTransform(ActivationInfo.ProjectileMesh.RelativeTransform);
+		OptionalStaticMeshComponent->SetRelativeTransform(Info.ProjectileMesh.RelativeTransform);
 		
 	}
 	else if(OptionalStaticMeshComponent) // We did need the component at one stage but no more lets hide it
@@ -337,20 +356,20 @@ bool ABFPoolableProjectileActor::HandleComponentCreation()
 
 	
 	// Same thought process as above.
-	if(IsValid(ActivationInfo.NiagaraSystem))
+	if(!Info.NiagaraSystem.IsNull())
 	{
-		if(!OptionalNiagaraComponent) // We never create one unless we need it, after that point we just toggle it on and off basically.
-			OptionalNiagaraComponent = BF::OP::NewComponent<UNiagaraComponent>(this, nullptr, "NiagaraComponent");
+		FindOrCreateNiagaraComponent(); // We never create one unless we need it (or it was precreated), after that point we just toggle it on and off basically.
 
 		// Internally does nothing if we are already attached so no need to check.
-		if(ActivationInfo.NiagaraSystemAttachmentSocketName != NAME_None && OptionalStaticMeshComponent)
-			OptionalNiagaraComponent->AttachToComponent(OptionalStaticMeshComponent, FAttachmentTransformRules::SnapToTargetIncludingScale, ActivationInfo.NiagaraSystemAttachmentSocketName);
+		if(Info.NiagaraSystemAttachmentSocketName != NAME_None && OptionalStaticMeshComponent)
+			OptionalNiagaraComponent->AttachToComponent(OptionalStaticMeshComponent, FAttachmentTransformRules::SnapToTargetIncludingScale, Info.NiagaraSystemAttachmentSocketName);
 		else
 			OptionalNiagaraComponent->AttachToComponent(RootComponent, FAttachmentTransformRules::SnapToTargetIncludingScale);
 		
 		OptionalNiagaraComponent->SetComponentTickEnabled(true);
-		OptionalNiagaraComponent->SetRelativeTransform(ActivationInfo.NiagaraSystemRelativeTransform);
-		OptionalNiagaraComponent->SetAsset(ActivationInfo.NiagaraSystem);
+		OptionalNiagaraComponent->SetRelativeTransform(Info.NiagaraSystemRelativeTransform);
+		if(!bPresetApplied)
+			OptionalNiagaraComponent->SetAsset(BF::OP::ResolveSoftAsset(Info.NiagaraSystem));
 		OptionalNiagaraComponent->Activate();
 	}
 	else if(OptionalNiagaraComponent)
@@ -359,23 +378,98 @@ bool ABFPoolableProjectileActor::HandleComponentCreation()
 		OptionalNiagaraComponent->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
 	}
 
+	LastAppliedPreset = ActivePreset;
 	return bUpdatedRoot;
 }
 
+
+USceneComponent* ABFPoolableProjectileActor::FindOrCreateRootComponent(EBFCollisionShapeType ShapeType)
+{
+	// Created without collision, the activation that asks for the shape sets its profile.
+	auto FindOrCreateShape = [this]<typename ComponentType>(TObjectPtr<ComponentType>& Cached, FName Name) -> ComponentType*
+	{
+		if(!IsValid(Cached))
+		{
+			Cached = BF::OP::NewComponent<ComponentType>(this, nullptr, Name);
+			Cached->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
+		return Cached;
+	};
+	
+	switch(ShapeType)
+	{
+		case EBFCollisionShapeType::Box: return FindOrCreateShape(BoxCollisionComponent, "BoxCollisionComponent");
+		case EBFCollisionShapeType::Sphere: return FindOrCreateShape(SphereCollisionComponent, "SphereCollisionComponent");
+		case EBFCollisionShapeType::Capsule: return FindOrCreateShape(CapsuleCollisionComponent, "CapsuleCollisionComponent");
+		case EBFCollisionShapeType::NoCollisionShape:
+		default:
+		{
+			if(!IsValid(SceneRootComponent))
+			{
+				SceneRootComponent = BF::OP::NewComponent<USceneComponent>(this, nullptr, "SceneRootComponent");
+				SceneRootComponent->SetMobility(EComponentMobility::Movable);
+			}
+			return SceneRootComponent;
+		}
+	}
+}
+
+
+UStaticMeshComponent* ABFPoolableProjectileActor::FindOrCreateStaticMeshComponent()
+{
+	if(!OptionalStaticMeshComponent)
+		OptionalStaticMeshComponent = BF::OP::NewComponent<UStaticMeshComponent>(this, nullptr, "StaticMeshComponent");
+	return OptionalStaticMeshComponent;
+}
+
+
+UNiagaraComponent* ABFPoolableProjectileActor::FindOrCreateNiagaraComponent()
+{
+	if(!OptionalNiagaraComponent)
+	{
+		OptionalNiagaraComponent = BF::OP::NewComponent<UNiagaraComponent>(this, nullptr, "NiagaraComponent");
+		OptionalNiagaraComponent->SetComponentTickEnabled(false);
+	}
+	return OptionalNiagaraComponent;
+}
+
+
+void ABFPoolableProjectileActor::PrecreateComponents(const FBFPoolableProjectileActorDescription& Description)
+{
+	FindOrCreateRootComponent(Description.ProjectileCollisionShape.CollisionShapeType);
+	
+	if(!Description.ProjectileMesh.Mesh.IsNull())
+		FindOrCreateStaticMeshComponent();
+	
+	if(!Description.NiagaraSystem.IsNull())
+		FindOrCreateNiagaraComponent();
+}
+
+
+void ABFPoolableProjectileActor::OnObjectCreated_Implementation()
+{
+	for(const EBFCollisionShapeType ShapeType : PrecreatedCollisionShapes)
+		FindOrCreateRootComponent(ShapeType);
+
+	if(bPrecreateStaticMeshComponent)
+		FindOrCreateStaticMeshComponent();
+	
+	if(bPrecreateNiagaraComponent)
+		FindOrCreateNiagaraComponent();
+}
+
 void ABFPoolableProjectileActor::SetCurfew(float SecondsUntilReturn)
 {
 	bfEnsure(SecondsUntilReturn > 0);
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, this, &ABFPoolableProjectileActor::OnCurfewExpired, SecondsUntilReturn, false);
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolableProjectileActor::OnCurfewExpired));
 }
 
 
 void ABFPoolableProjectileActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
@@ -387,24 +481,24 @@ void ABFPoolableProjectileActor::OnCurfewExpired()
 
 void ABFPoolableProjectileActor::OnProjectileStopped_Implementation(const FHitResult& HitResult)
 {
-	ActivationInfo.OnProjectileStoppedDelegate.ExecuteIfBound(HitResult);
+	GetActivationInfo().OnProjectileStoppedDelegate.ExecuteIfBound(HitResult);
 
-	if(ActivationInfo.bShouldReturnOnStop)
+	if(GetActivationInfo().bShouldReturnOnStop)
 		ReturnToPool();
 }
 
 
 void ABFPoolableProjectileActor::OnProjectileActorHit_Implementation(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
-	ActivationInfo.OnProjectileHitOrOverlapDelegate.ExecuteIfBound(Hit, false);
+	GetActivationInfo().OnProjectileHitOrOverlapDelegate.ExecuteIfBound(Hit, false);
 
-	if(ActivationInfo.bShouldReturnOnImpact)
+	if(GetActivationInfo().bShouldReturnOnImpact)
 		ReturnToPool();
-	else if(ActivationInfo.bShouldMeshSimulatePhysicsOnImpact && OptionalStaticMeshComponent)
+	else if(GetActivationInfo().bShouldMeshSimulatePhysicsOnImpact && OptionalStaticMeshComponent)
 	{
 		// Use the scene comps collision when wanting to simulate physics.
 		OptionalStaticMeshComponent->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-		OptionalStaticMeshComponent->SetCollisionProfileName(ActivationInfo.ProjectileMesh.CollisionProfile.Name);
+		OptionalStaticMeshComponent->SetCollisionProfileName(GetActivationInfo().ProjectileMesh.CollisionProfile.Name);
 		OptionalStaticMeshComponent->SetSimulatePhysics(true);
 
 		// Disable collision for the shape component otherwise we have an invisible shape blocking things.
@@ -416,15 +510,15 @@ void ABFPoolableProjectileActor::OnProjectileActorHit_Implementation(UPrimitiveC
 
 void ABFPoolableProjectileActor::OnProjectileActorOverlap_Implementation(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	ActivationInfo.OnProjectileHitOrOverlapDelegate.ExecuteIfBound(SweepResult, true);
+	GetActivationInfo().OnProjectileHitOrOverlapDelegate.ExecuteIfBound(SweepResult, true);
 	
-	if(ActivationInfo.bShouldReturnOnImpact)
+	if(GetActivationInfo().bShouldReturnOnImpact)
 		ReturnToPool();
-	else if(ActivationInfo.bShouldMeshSimulatePhysicsOnImpact && OptionalStaticMeshComponent)
+	else if(GetActivationInfo().bShouldMeshSimulatePhysicsOnImpact && OptionalStaticMeshComponent)
 	{
 		// Use the scene comps collision when wanting to simulate physics.
 		OptionalStaticMeshComponent->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-		OptionalStaticMeshComponent->SetCollisionProfileName(ActivationInfo.ProjectileMesh.CollisionProfile.Name);
+		OptionalStaticMeshComponent->SetCollisionProfileName(GetActivationInfo().ProjectileMesh.CollisionProfile.Name);
 		OptionalStaticMeshComponent->SetSimulatePhysics(true);
 
 		// Disable collision for the shape component otherwise we have an invisible shape blocking things.
@@ -7,11 +7,15 @@
 #include "BFObjectPooling/Pool/BFPooledObjectHandle.h"
 #include "GameFramework/Actor.h"
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "BFPoolableProjectileActor.generated.h"
 
 
 class UNiagaraComponent;
 class UProjectileMovementComponent;
+class UBoxComponent;
+class UCapsuleComponent;
+class USphereComponent;
 
 
 
@@ -29,9 +33,9 @@ class UProjectileMovementComponent;
 
 /** A generic poolable projectile actor that already implements the IBFPooledObjectInterface and can be used for various situations involving projectiles in the world.
  * Collision shape, collision type, mesh, materials, VFX system etc can all be customized per pooled Projectile actor, even within the same pool.
- * You also don't pay for transform updates or collision checks for non used components. This comes with a *tiny* runtime
- * cost in order to re create the components *ONLY* when needed or changed from previous pool usages but it is very minimal and only happens when the actor is activated, the trade off is far worth it and can be easily mitigated by choosing to pre-spawn the
- * actors from the pool init struct. */
+ * You also don't pay for transform updates or collision checks for non used components. Each shape component is only created the first time it is needed and kept
+ * (detached with collision disabled) once another shape takes over as the root, so mixed shape pools only swap the root rather than destroy and register components on the fire path.
+ * PrecreatedCollisionShapes (or PrecreateComponents from the pools OnObjectAddedToPool) moves that first creation into the pools prewarm as well. */
 UCLASS(meta = (DisplayName = "BF Poolable Projectile Actor"))
 class BFOBJECTPOOLING_API ABFPoolableProjectileActor : public AActor, public IBFPooledObjectInterface 
 {
@@ -40,6 +44,7 @@ class BFOBJECTPOOLING_API ABFPoolableProjectileActor : public AActor, public IBF
 public:
 	ABFPoolableProjectileActor(const FObjectInitializer& ObjectInitializer);
 	virtual void OnObjectPooled_Implementation() override;
+	virtual void OnObjectCreated_Implementation() override;
 	virtual void PostInitializeComponents() override;
 	virtual void FellOutOfWorld(const UDamageType& DmgType) override;
 
@@ -59,6 +64,15 @@ public:
 		const FBFPoolableProjectileActorDescription& ActivationParams, const FTransform& ActorTransform);
 
 
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and asset setup (mesh, materials, shape size, niagara system) is skipped when this actor
+	 * last fired with the same preset. Velocity and homing target are per shot so can be overridden here, otherwise the presets values are used. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Projectile Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolableProjectileActorPreset* Preset, const FTransform& ActorTransform,
+		FVector Velocity, bool bOverrideVelocity = false, USceneComponent* HomingTargetComponent = nullptr);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableProjectileActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableProjectileActorPreset* Preset,
+		const FTransform& ActorTransform, const TOptional<FVector>& Velocity = {}, USceneComponent* HomingTargetComponent = nullptr);
+
 
 	/** Used when manually controlling this pooled actor, otherwise you should use FireAndForget. This is typically handed to the pooled actor because you are now ready to let the pooled actor handle its own
 	 * state and return itself to the pool whenever it finishes or curfew elapses. */
@@ -73,6 +87,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Projectile Actor")
 	virtual void SetPoolableActorParams(const FBFPoolableProjectileActorDescription& ActivationParams);
 
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Projectile Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolableProjectileActorPreset* Preset);
+
+	// Per shot overrides for when using a preset (also works with plain params), cleared when returned to the pool.
+	void SetShotVelocityOverride(const FVector& Velocity) { VelocityOverride = Velocity; }
+	void SetShotHomingTarget(USceneComponent* HomingTargetComponent) { HomingTargetOverride = HomingTargetComponent; }
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolableProjectileActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
+
 	 /*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	  *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
 	UFUNCTION(BlueprintCallable, Category="BF|Poolable Static Mesh Actor")
@@ -96,8 +121,15 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Projectile Actor")
 	UStaticMeshComponent* GetStaticMeshComponent() const { return OptionalStaticMeshComponent; }
+
+	/* Creates (dormant) every component the description would need without activating anything, so the first activation with it only swaps the root.
+	 * Meant for the pools OnObjectAddedToPool delegate, which also runs for time sliced prewarms. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Projectile Actor")
+	virtual void PrecreateComponents(const FBFPoolableProjectileActorDescription& Description);
 	
 protected:
+	friend class UBFProjectileSimulationSubsystem;
+	
 	UFUNCTION(BlueprintNativeEvent, Category="BF| Poolable Projectile Actor")
 	void OnProjectileActorHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
 
@@ -116,6 +148,17 @@ protected:
 
 	// Called just prior to being activated in the world.
 	virtual void SetupObjectState(); 
+
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
+
+	// True when the active preset is the one we last set our assets up with, so only per activation state needs applying.
+	bool IsPresetAlreadyApplied() const { return ActivePreset && ActivePreset == LastAppliedPreset; }
+
+	// Cached root for the shape type, created (with collision disabled) the first time it is asked for. NoCollisionShape is the scene root from our CDO.
+	USceneComponent* FindOrCreateRootComponent(EBFCollisionShapeType ShapeType);
+	UStaticMeshComponent* FindOrCreateStaticMeshComponent();
+	UNiagaraComponent* FindOrCreateNiagaraComponent();
 protected:
 	/* BP pools store UObject handles for convenience and I cant template member functions (:
 	 * So I have decided for everyone that we non ThreadSafe for performance benefits, you are using Multithreading with BP typically. You can always implement your own classes anyway.  */
@@ -133,9 +176,45 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="BF| Poolable Projectile Actor")
 	TObjectPtr<UNiagaraComponent> OptionalNiagaraComponent = nullptr;	
 
+	// Shapes this pool will use, created when the pool creates the actor (prewarm included) instead of on the first activation that asks for them.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF| Poolable Projectile Actor")
+	TArray<EBFCollisionShapeType> PrecreatedCollisionShapes;
+
+	// Same as PrecreatedCollisionShapes for the optional mesh and niagara components.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF| Poolable Projectile Actor")
+	uint8 bPrecreateStaticMeshComponent:1 = false;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="BF| Poolable Projectile Actor")
+	uint8 bPrecreateNiagaraComponent:1 = false;
+
+	// One instance per root type, whichever isn't the current root sits detached with collision disabled until it is needed again.
+	UPROPERTY(Transient)
+	TObjectPtr<USceneComponent> SceneRootComponent = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<USphereComponent> SphereCollisionComponent = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCapsuleComponent> CapsuleCollisionComponent = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UBoxComponent> BoxCollisionComponent = nullptr;
+
 	FTimerHandle CurfewTimerHandle;
 	FBFPoolableProjectileActorDescription ActivationInfo;
 
+	// Our slot in the UBFProjectileSimulationSubsystem while batched, INDEX_NONE while the movement component moves us (or we're pooled).
+	int32 BatchedSimulationIndex = INDEX_NONE;
+	TOptional<FVector> VelocityOverride;
+	TWeakObjectPtr<USceneComponent> HomingTargetOverride;
+
+	// Presets are referenced, not copied. LastAppliedPreset survives being pooled so the next activation with the same preset can skip asset setup.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableProjectileActorPreset> ActivePreset = nullptr;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableProjectileActorPreset> LastAppliedPreset = nullptr;
+
 	UPROPERTY(Transient)
 	uint32 bIsUsingBPHandle:1 = false;
 };
@@ -4,6 +4,8 @@
 #include "BFPoolableSkeletalMeshActor.h"
 #include "BFObjectPooling/Pool/Private/BFPoolContainer.h"
 #include "BFObjectPooling/PoolBP/BFPooledObjectHandleBP.h"
+#include "IAnimationBudgetAllocator.h"
+#include "SkeletalMeshComponentBudgeted.h"
 
 
 ABFPoolableSkeletalMeshActor::ABFPoolableSkeletalMeshActor(const FObjectInitializer& ObjectInitializer)
@@ -17,6 +19,10 @@ ABFPoolableSkeletalMeshActor::ABFPoolableSkeletalMeshActor(const FObjectInitiali
 	
 	SkeletalMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>("SkeletalMeshComponent");
 	SkeletalMeshComponent->SetupAttachment(RootComponent);
+
+	// Subclasses opt into bUseAnimationBudget with SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>, registration is then ours to do on un-pool.
+	if(USkeletalMeshComponentBudgeted* BudgetedComponent = Cast<USkeletalMeshComponentBudgeted>(SkeletalMeshComponent))
+		BudgetedComponent->SetAutoRegisterWithBudgetAllocator(false);
 }
 
 
@@ -26,27 +32,9 @@ void ABFPoolableSkeletalMeshActor::FireAndForgetBP(FBFPooledObjectHandleBP& Hand
 	bfEnsure(Handle.Handle.IsValid()); // You must have a valid handle.
 	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
 
-	// Either dont use a delay or activate before returning to the pool.
-	bfEnsure(ActivationParams.PhysicsBodySleepDelay < 0.f || ActivationParams.ActorCurfew < 0.f ||
-		ActivationParams.ActorCurfew > ActivationParams.PhysicsBodySleepDelay);
-
 	SetPoolHandleBP(Handle);
 	SetPoolableActorParams(ActivationParams);
-	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
-
-	// Assumes we are responsible for activation so just go ahead and make sure.
-	SetActorHiddenInGame(false);
-	SetActorEnableCollision(true);
-	
-	// Enable ticking only when needed
-	bool bNeedsTick = ActivationInfo.bSimulatePhysics || ActivationInfo.AnimationInstance || ActivationInfo.AnimSequence;
-	SkeletalMeshComponent->SetComponentTickEnabled(bNeedsTick);
-	SkeletalMeshComponent->SetComponentTickInterval(ActivationParams.MeshTickInterval);
-
-	SetActorTransform(ActorTransform, false, nullptr, ETeleportType::ResetPhysics);
-	ActivatePoolableActor(ActivationInfo.bSimulatePhysics);
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -56,41 +44,77 @@ void ABFPoolableSkeletalMeshActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoo
 	bfEnsure(Handle.IsValid()); // You must have a valid handle.
 	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
 	
-	// Either dont use a delay or activate before returning to the pool.
-	bfEnsure(ActivationParams.PhysicsBodySleepDelay < 0.f || ActivationParams.ActorCurfew < 0.f || ActivationParams.ActorCurfew > ActivationParams.PhysicsBodySleepDelay);
-	
 	SetPoolHandle(Handle);
 	SetPoolableActorParams(ActivationParams);
+	FireAndForget_Internal(ActorTransform);
+}
 
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+
+void ABFPoolableSkeletalMeshActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolableSkeletalMeshActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableSkeletalMeshActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableSkeletalMeshActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableSkeletalMeshActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableSkeletalMeshActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	const FBFPoolableSkeletalMeshActorDescription& Info = GetActivationInfo();
+	
+	// Either dont use a delay or activate before returning to the pool.
+	bfEnsure(Info.PhysicsBodySleepDelay < 0.f || Info.ActorCurfew < 0.f || Info.ActorCurfew > Info.PhysicsBodySleepDelay);
+	
+	if(Info.ActorCurfew > 0)
+		SetCurfew(Info.ActorCurfew);
 
 	// Assumes we are responsible for activation so just go ahead and make sure.
 	SetActorHiddenInGame(false);
 	SetActorEnableCollision(true);
 	
-	// Enable ticking only when needed
-	bool bNeedsTick = ActivationInfo.bSimulatePhysics || ActivationInfo.AnimationInstance || ActivationInfo.AnimSequence;
+	// Enable ticking only when needed, followers of a leader pose have their bones updated by the leader.
+	const bool bFollowingLeader = Info.LeaderPoseComponent.IsValid();
+	bool bNeedsTick = Info.bSimulatePhysics || (!bFollowingLeader && (!Info.AnimationInstance.IsNull() || !Info.AnimSequence.IsNull()));
 	SkeletalMeshComponent->SetComponentTickEnabled(bNeedsTick);	
-	SkeletalMeshComponent->SetComponentTickInterval(ActivationParams.MeshTickInterval);
+	SkeletalMeshComponent->SetComponentTickInterval(Info.MeshTickInterval);
 
 	SetActorTransform(ActorTransform, false, nullptr, ETeleportType::ResetPhysics);
-	ActivatePoolableActor(ActivationInfo.bSimulatePhysics);
+	ActivatePoolableActor(Info.bSimulatePhysics);
 }
 
 
-
 void ABFPoolableSkeletalMeshActor::SetPoolableActorParams( const FBFPoolableSkeletalMeshActorDescription& ActivationParams)
 {
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams; 
 }
 
+
+void ABFPoolableSkeletalMeshActor::SetPoolableActorPreset(const UBFPoolableSkeletalMeshActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
 void ABFPoolableSkeletalMeshActor::ActivatePoolableActor(bool bSimulatePhysics)
 {
 	SetupObjectState(bSimulatePhysics);
 
 	// Should be overridden if not desired.
-	if(bSimulatePhysics && ActivationInfo.PhysicsBodySleepDelay > 0)
+	const float PhysicsBodySleepDelay = GetActivationInfo().PhysicsBodySleepDelay;
+	if(bSimulatePhysics && PhysicsBodySleepDelay > 0)
 	{
 		RemovePhysicsSleepDelay();
 		FTimerDelegate TimerDel;
@@ -99,34 +123,64 @@ void ABFPoolableSkeletalMeshActor::ActivatePoolableActor(bool bSimulatePhysics)
 			SkeletalMeshComponent->PutAllRigidBodiesToSleep();
 			SkeletalMeshComponent->SetCollisionProfileName(MeshSleepPhysicsProfile.Name);
 		});
-		GetWorld()->GetTimerManager().SetTimer(SleepPhysicsTimerHandle, TimerDel, ActivationInfo.PhysicsBodySleepDelay, false);
+		GetWorld()->GetTimerManager().SetTimer(SleepPhysicsTimerHandle, TimerDel, PhysicsBodySleepDelay, false);
 	}
 }
 
 
 void ABFPoolableSkeletalMeshActor::SetupObjectState(bool bSimulatePhysics)
 {
-	bfValid(ActivationInfo.Mesh);
-	SkeletalMeshComponent->SetSkeletalMesh(ActivationInfo.Mesh);
+	const FBFPoolableSkeletalMeshActorDescription& Info = GetActivationInfo();
+	bfEnsure(!Info.Mesh.IsNull());
+
+	// Same preset as last time means the component already has these assets, SetSkeletalMesh in particular is not cheap.
+	if(!IsPresetAlreadyApplied())
+	{
+		SkeletalMeshComponent->SetSkeletalMesh(BF::OP::ResolveSoftAsset(Info.Mesh));
 
-	for(const auto& [Material, Slot] : ActivationInfo.Materials)
-		SkeletalMeshComponent->SetMaterial(Slot, Material);
+		for(const auto& [Material, Slot] : Info.Materials)
+			SkeletalMeshComponent->SetMaterial(Slot, BF::OP::ResolveSoftAsset(Material));
+		
+		LastAppliedPreset = ActivePreset;
+	}
 	
-	SkeletalMeshComponent->SetRelativeTransform(ActivationInfo.RelativeTransform);
+	SkeletalMeshComponent->SetRelativeTransform(Info.RelativeTransform);
+
+	SkeletalMeshComponent->SetCollisionProfileName(Info.CollisionProfile.Name);
+	SkeletalMeshComponent->SetCollisionEnabled(Info.CollisionEnabled);
 
-	SkeletalMeshComponent->SetCollisionProfileName(ActivationInfo.CollisionProfile.Name);
-	SkeletalMeshComponent->SetCollisionEnabled(ActivationInfo.CollisionEnabled);
+	USkinnedMeshComponent* LeaderPoseComponent = Info.LeaderPoseComponent.Get();
+	if(LeaderPoseComponent != SkeletalMeshComponent->LeaderPoseComponent.Get())
+		SkeletalMeshComponent->SetLeaderPoseComponent(LeaderPoseComponent);
 
+	// The params are only created when the component registers with URO on, so the first time a pooled actor turns it on it registers again (once per actor).
+	SkeletalMeshComponent->bEnableUpdateRateOptimizations = Info.bUpdateRateOptimizations;
+	if(Info.bUpdateRateOptimizations && !SkeletalMeshComponent->AnimUpdateRateParams)
+		SkeletalMeshComponent->ReregisterComponent();
+	
 	// Apply the anim before simulating.
-	if(IsValid(ActivationInfo.AnimationInstance) || IsValid(ActivationInfo.AnimSequence))
+	if(!LeaderPoseComponent && (!Info.AnimationInstance.IsNull() || !Info.AnimSequence.IsNull()))
 	{
-		if(IsValid(ActivationInfo.AnimationInstance))
-			SkeletalMeshComponent->SetAnimInstanceClass(ActivationInfo.AnimationInstance);
+		if(!Info.AnimationInstance.IsNull())
+			SkeletalMeshComponent->SetAnimInstanceClass(BF::OP::ResolveSoftClass(Info.AnimationInstance));
 		else 
-			SkeletalMeshComponent->PlayAnimation(ActivationInfo.AnimSequence, ActivationInfo.bLoopAnimSequence); 
+			SkeletalMeshComponent->PlayAnimation(BF::OP::ResolveSoftAsset(Info.AnimSequence), Info.bLoopAnimSequence); 
 	}
 
 	SkeletalMeshComponent->SetSimulatePhysics(bSimulatePhysics);
+
+	// Last so the allocator takes over tick state from whatever we just set up.
+	if(Info.bUseAnimationBudget && !bSimulatePhysics && !LeaderPoseComponent)
+	{
+		USkeletalMeshComponentBudgeted* BudgetedComponent = Cast<USkeletalMeshComponentBudgeted>(SkeletalMeshComponent);
+		IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld());
+		bfEnsure(BudgetedComponent); // bUseAnimationBudget needs a subclass that sets the mesh component class to USkeletalMeshComponentBudgeted.
+		if(BudgetedComponent && Allocator && !bRegisteredWithAnimationBudget)
+		{
+			Allocator->RegisterComponent(BudgetedComponent);
+			bRegisteredWithAnimationBudget = true;
+		}
+	}
 }
 
 
@@ -152,6 +206,18 @@ void ABFPoolableSkeletalMeshActor::OnObjectPooled_Implementation()
 	RemoveCurfew();
 	RemovePhysicsSleepDelay();
 
+	// Unregistered before we touch the tick below, otherwise the allocator would just turn it back on.
+	if(bRegisteredWithAnimationBudget)
+	{
+		if(IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld()))
+			Allocator->UnregisterComponent(CastChecked<USkeletalMeshComponentBudgeted>(SkeletalMeshComponent));
+		bRegisteredWithAnimationBudget = false;
+	}
+
+	if(SkeletalMeshComponent->LeaderPoseComponent.IsValid())
+		SkeletalMeshComponent->SetLeaderPoseComponent(nullptr);
+	SkeletalMeshComponent->bEnableUpdateRateOptimizations = false;
+
 	if(SkeletalMeshComponent->IsSimulatingPhysics())
 	{
 		// I noticed due to disabling SKM tick it causes the bones
@@ -164,7 +230,10 @@ void ABFPoolableSkeletalMeshActor::OnObjectPooled_Implementation()
 	SkeletalMeshComponent->SetComponentTickEnabled(false);
 	ObjectHandle = nullptr;
 	BPObjectHandle = nullptr;
-	ActivationInfo = {};
+	if(ActivePreset)
+		ActivePreset = nullptr; // Keep LastAppliedPreset, the components still hold its assets.
+	else
+		ActivationInfo = {};
 }
 
 
@@ -216,16 +285,14 @@ void ABFPoolableSkeletalMeshActor::SetCurfew(float SecondsUntilReturn)
 {
 	bfEnsure(SecondsUntilReturn > 0);
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, this, &ABFPoolableSkeletalMeshActor::OnCurfewExpired, SecondsUntilReturn, false);
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolableSkeletalMeshActor::OnCurfewExpired));
 }
 
 
 void ABFPoolableSkeletalMeshActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-	
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
@@ -6,6 +6,7 @@
 #include "BFObjectPooling/Pool/BFObjectPool.h"
 #include "BFObjectPooling/Pool/BFPooledObjectHandle.h"
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "GameFramework/Actor.h"
 #include "BFPoolableSkeletalMeshActor.generated.h"
 
@@ -47,6 +48,13 @@ public:
 	// For easy fire and forget usage, will invalidate the Handle as the PoolActor now takes responsibility for returning based on our poolable actor params.
 	virtual void FireAndForget(TBFPooledObjectHandlePtr<ABFPoolableSkeletalMeshActor, ESPMode::NotThreadSafe>& Handle, 
 		const FBFPoolableSkeletalMeshActorDescription& ActivationParams, const FTransform& ActorTransform);
+
+
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and asset setup is skipped when this actor last activated with the same preset. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Skeletal Mesh Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolableSkeletalMeshActorPreset* Preset, const FTransform& ActorTransform);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableSkeletalMeshActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableSkeletalMeshActorPreset* Preset, const FTransform& ActorTransform);
 	
 
 	/** Used when manually controlling this pooled actor, otherwise you should use FireAndForget. This is typically handed to the pooled actor because you are now ready to let the pooled actor handle its own
@@ -61,6 +69,13 @@ public:
 	// If you are manually wanting to control the system then you can set its params here and call ActivatePoolableActor yourself if you want to just simply activate it and let it return when done see FireAndForget.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Skeletal Mesh Actor")
 	virtual void SetPoolableActorParams(const FBFPoolableSkeletalMeshActorDescription& ActivationParams);
+
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Skeletal Mesh Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolableSkeletalMeshActorPreset* Preset);
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolableSkeletalMeshActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
 	
 	/*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	 *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
@@ -98,6 +113,12 @@ protected:
 	// Called just prior to being activated in the world.
 	virtual void SetupObjectState(bool bSimulatePhysics);
 
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
+
+	// True when the active preset is the one we last set our assets up with, so only per activation state needs applying.
+	bool IsPresetAlreadyApplied() const { return ActivePreset && ActivePreset == LastAppliedPreset; }
+
 	virtual void RemovePhysicsSleepDelay();
 
 protected:
@@ -116,8 +137,16 @@ protected:
 	FTimerHandle CurfewTimerHandle;
 	FTimerHandle SleepPhysicsTimerHandle;
 
+	// Presets are referenced, not copied. LastAppliedPreset survives being pooled so the next activation with the same preset can skip asset setup.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableSkeletalMeshActorPreset> ActivePreset = nullptr;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableSkeletalMeshActorPreset> LastAppliedPreset = nullptr;
+
 	UPROPERTY(Transient)
 	uint32 bIsUsingBPHandle:1 = false;
+	uint32 bRegisteredWithAnimationBudget:1 = false;
 };
 
 
@@ -4,6 +4,7 @@
 #include "BFPoolableSoundActor.h"
 #include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
 #include "BFObjectPooling/PoolBP/BFPooledObjectHandleBP.h"
+#include "AudioDevice.h"
 
 
 ABFPoolableSoundActor::ABFPoolableSoundActor(const FObjectInitializer& ObjectInitializer)
@@ -29,32 +30,11 @@ void ABFPoolableSoundActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle,
 	const FBFPoolableSoundActorDescription& ActivationParams, const FTransform& ActorTransform)
 {
 	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
-	bfValid(ActivationParams.Sound); // you must set the system
+	bfEnsure(!ActivationParams.Sound.IsNull()); // you must set the system
 
 	SetPoolHandleBP(Handle);
 	SetPoolableActorParams(ActivationParams);
-	SetActorTransform(ActorTransform);
-
-	// Ensure the curfew accounts for the delayed activation time if set.
-	if(ActivationInfo.ActorCurfew > 0)
-	{
-		if(ActivationInfo.DelayedActivationTimeSeconds > 0)
-			ActivationInfo.ActorCurfew += ActivationInfo.DelayedActivationTimeSeconds;
-		
-		SetCurfew(ActivationInfo.ActorCurfew);
-	}
-
-	if(ActivationInfo.DelayedActivationTimeSeconds > 0)
-	{
-		FTimerHandle TimerHandle;
-		FTimerDelegate TimerDel;
-		TimerDel.BindUObject(this, &ABFPoolableSoundActor::ActivatePoolableActor);
-		GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDel, ActivationInfo.DelayedActivationTimeSeconds, false);
-	}
-	else // Start it now
-	{
-		ActivatePoolableActor();
-	}
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -63,22 +43,55 @@ void ABFPoolableSoundActor::FireAndForget(
 	const FBFPoolableSoundActorDescription& ActivationParams, const FTransform& ActorTransform)
 {
 	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
-	bfValid(ActivationParams.Sound); // you must set the system
-
+	bfEnsure(!ActivationParams.Sound.IsNull()); // you must set the system
 
 	SetPoolHandle(Handle);
 	SetPoolableActorParams(ActivationParams);
-	SetActorTransform(ActorTransform);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableSoundActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolableSoundActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableSoundActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableSoundActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableSoundActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableSoundActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	const FBFPoolableSoundActorDescription& Info = GetActivationInfo();
+	if(Info.bSkipIfInaudible && !WouldSoundBeAudible(this, Info, ActorTransform.GetLocation()))
+	{
+		// Already un-pooled, but nothing has been activated yet so handing it straight back is cheap.
+		ReturnToPool();
+		return;
+	}
 	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+	SetActorTransform(ActorTransform);
+
+	// Ensure the curfew accounts for the delayed activation time if set.
+	if(Info.ActorCurfew > 0)
+		SetCurfew(Info.ActorCurfew + FMath::Max(Info.DelayedActivationTimeSeconds, 0.f));
 	
-	if(ActivationInfo.DelayedActivationTimeSeconds > KINDA_SMALL_NUMBER)
+	if(Info.DelayedActivationTimeSeconds > KINDA_SMALL_NUMBER)
 	{
-		FTimerHandle TimerHandle;
 		FTimerDelegate TimerDel;
 		TimerDel.BindUObject(this, &ABFPoolableSoundActor::ActivatePoolableActor);
-		GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDel, ActivationInfo.DelayedActivationTimeSeconds, false);
+		GetWorld()->GetTimerManager().SetTimer(DelayedActivationTimerHandle, TimerDel, Info.DelayedActivationTimeSeconds, false);
 	}
 	else // Start it now
 	{
@@ -89,35 +102,63 @@ void ABFPoolableSoundActor::FireAndForget(
 
 void ABFPoolableSoundActor::SetPoolableActorParams(const FBFPoolableSoundActorDescription& ActivationParams)
 {
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams;
 }
 
 
+void ABFPoolableSoundActor::SetPoolableActorPreset(const UBFPoolableSoundActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
+
+FBFPoolableSoundActorDescription& ABFPoolableSoundActor::GetMutableActivationInfo()
+{
+	if(ActivePreset)
+	{
+		ActivationInfo = ActivePreset->Description;
+		ActivePreset = nullptr;
+	}
+	return ActivationInfo;
+}
+
+
 void ABFPoolableSoundActor::ActivatePoolableActor()
 {
 	SetupObjectState();
+	const FBFPoolableSoundActorDescription& Info = GetActivationInfo();
 	bfEnsure(AudioComponent->Sound); // You must set the sound manually or via SetPoolableActorParams.
-	bfEnsure(ActivationInfo.StartingTimeOffset <= AudioComponent->Sound->GetDuration()); // Trying to start the sound with a time greater than the sound duration.
+	bfEnsure(Info.StartingTimeOffset <= AudioComponent->Sound->GetDuration()); // Trying to start the sound with a time greater than the sound duration.
 	bHasSoundFinished = false;
 	StartTime = GetWorld()->GetTimeSeconds();
 	
-	if(ActivationInfo.FadeInTime < 0)
-		AudioComponent->Play(ActivationInfo.StartingTimeOffset); // SetupObjectState will trigger start via FadeIn if we are using that so don't play here.
+	if(Info.FadeInTime < 0)
+		AudioComponent->Play(Info.StartingTimeOffset); // SetupObjectState will trigger start via FadeIn if we are using that so don't play here.
 }
 
 
 void ABFPoolableSoundActor::SetupObjectState()
 {
-	bfEnsure(ActivationInfo.Sound); // You must set the sound manually or if you intend to use this method you must set the sound via SetPoolableActorParams.
-	AudioComponent->SetSound( ActivationInfo.Sound );
-	AudioComponent->SetVolumeMultiplier(ActivationInfo.VolumeMultiplier);
-	AudioComponent->SetPitchMultiplier(ActivationInfo.PitchMultiplier);
-	AudioComponent->AdjustAttenuation(ActivationInfo.AttenuationSettings);
-	AudioComponent->bReverb = ActivationInfo.bReverb;
-	AudioComponent->SetUISound(ActivationInfo.bUISound);
-
-	if(ActivationInfo.FadeInTime > 0)
-		AudioComponent->FadeIn(ActivationInfo.FadeInTime, ActivationInfo.VolumeMultiplier, ActivationInfo.StartingTimeOffset, (EAudioFaderCurve)ActivationInfo.FadeInCurve);
+	const FBFPoolableSoundActorDescription& Info = GetActivationInfo();
+	bfEnsure(!Info.Sound.IsNull()); // You must set the sound manually or if you intend to use this method you must set the sound via SetPoolableActorParams.
+
+	// Same preset as last time means the component already has the sound and attenuation.
+	if(!IsPresetAlreadyApplied())
+	{
+		AudioComponent->SetSound(BF::OP::ResolveSoftAsset(Info.Sound));
+		AudioComponent->AdjustAttenuation(Info.AttenuationSettings);
+		LastAppliedPreset = ActivePreset;
+	}
+	
+	AudioComponent->SetVolumeMultiplier(Info.VolumeMultiplier);
+	AudioComponent->SetPitchMultiplier(Info.PitchMultiplier);
+	AudioComponent->bReverb = Info.bReverb;
+	AudioComponent->SetUISound(Info.bUISound);
+
+	if(Info.FadeInTime > 0)
+		AudioComponent->FadeIn(Info.FadeInTime, Info.VolumeMultiplier, Info.StartingTimeOffset, (EAudioFaderCurve)Info.FadeInCurve);
 }
 
 
@@ -151,7 +192,10 @@ void ABFPoolableSoundActor::OnObjectPooled_Implementation()
 	bWaitForSoundFinishBeforeCurfew = false;
 
 	StartTime = 0;
-	ActivationInfo = {};
+	if(ActivePreset)
+		ActivePreset = nullptr; // Keep LastAppliedPreset, the components still hold its assets.
+	else
+		ActivationInfo = {};
 
 	if(AudioComponent)
 		AudioComponent->Stop();
@@ -197,35 +241,59 @@ void ABFPoolableSoundActor::SetCurfew(float SecondsUntilReturn, bool bShouldWait
 	bWaitForSoundFinishBeforeCurfew = bShouldWaitForSoundFinishBeforeCurfew;
 	
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer( CurfewTimerHandle, this, &ABFPoolableSoundActor::OnCurfewExpired, SecondsUntilReturn, false );
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolableSoundActor::OnCurfewExpired));
 }
 
 
 void ABFPoolableSoundActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
 void ABFPoolableSoundActor::OnSoundFinished()
 {
 	bHasSoundFinished = true;
-	ActivationInfo.OnSoundFinishedDelegate.ExecuteIfBound();
+	GetActivationInfo().OnSoundFinishedDelegate.ExecuteIfBound();
 
 	// When fading out and using a curfew its implied we should return when the sound finishes, this is helpful because inside OnCurfewExpired
 	// if using the fade out we starting fading and return which relies on this OnSoundFinished callback to now let us know to return. Tiny offset just in case.
 	// Takes only Pause time into account not real time.
-	if(GetAutoReturnOnSoundFinished() || (ActivationInfo.ActorCurfew > 0 && GetWorld()->GetTimeSeconds() > StartTime + ActivationInfo.ActorCurfew - 0.05))
+	if(GetAutoReturnOnSoundFinished() || (GetActivationInfo().ActorCurfew > 0 && GetWorld()->GetTimeSeconds() > StartTime + GetActivationInfo().ActorCurfew - 0.05))
 		ReturnToPool();
 }
 
 
+bool ABFPoolableSoundActor::WouldSoundBeAudible(const UObject* WorldContextObject, const FBFPoolableSoundActorDescription& Description, const FVector& Location)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	const FAudioDeviceHandle AudioDevice = World ? World->GetAudioDevice() : FAudioDeviceHandle();
+	if(!AudioDevice.IsValid())
+		return false;
+
+	// Not loaded yet means activation would load it, let that path deal with it.
+	const USoundBase* Sound = Description.Sound.Get();
+	if(!Sound || Sound->IsLooping())
+		return true;
+
+	// Every voice the device is playing, not just ours. Read without syncing with the audio thread so it can be a frame behind, close enough for a budget check.
+	if(AudioDevice->GetNumActiveSources() >= AudioDevice->GetMaxChannels())
+		return false;
+
+	// The actor always applies the descriptions attenuation as an override, so that is what decides the range.
+	const FSoundAttenuationSettings& Attenuation = Description.AttenuationSettings;
+	if(Description.bUISound || !Attenuation.bAttenuate)
+		return true;
+	
+	const float MaxDistance = Attenuation.GetMaxDimension() * FMath::Max(BF::OP::CVarSoundAudibleDistanceScale.GetValueOnGameThread(), 0.f);
+	return AudioDevice->LocationIsAudible(Location, MaxDistance);
+}
+
+
 USoundBase* ABFPoolableSoundActor::GetSound() const
 {
-	return ActivationInfo.Sound;
+	return GetActivationInfo().Sound.Get();
 }
 
 
@@ -260,9 +328,10 @@ void ABFPoolableSoundActor::OnCurfewExpired()
 {
 	if(AudioComponent->IsPlaying())
 	{
-		if(ActivationInfo.FadeOutTime > 0.f)
+		const FBFPoolableSoundActorDescription& Info = GetActivationInfo();
+		if(Info.FadeOutTime > 0.f)
 		{
-			AudioComponent->FadeOut(ActivationInfo.FadeOutTime, 0.f, (EAudioFaderCurve)ActivationInfo.FadeInCurve);
+			AudioComponent->FadeOut(Info.FadeOutTime, 0.f, (EAudioFaderCurve)Info.FadeInCurve);
 			return;
 		}
 
@@ -271,9 +340,7 @@ void ABFPoolableSoundActor::OnCurfewExpired()
 			float RemainingDuration = GetWorld()->GetTimeSeconds() - StartTime + AudioComponent->GetSound()->GetDuration();
 			if(RemainingDuration > 0.05)
 			{
-				FTimerDelegate TimerDelegate;
-				TimerDelegate.BindUObject(this, &ABFPoolableSoundActor::OnCurfewExpired);
-				GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, TimerDelegate, RemainingDuration, false);
+				SetCurfew(RemainingDuration, true);
 				return;	
 			}
 		}
@@ -8,6 +8,7 @@
 #include "Components/AudioComponent.h"
 #include "GameFramework/Actor.h"
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "BFPoolableSoundActor.generated.h"
 
 
@@ -53,6 +54,11 @@ public:
 		const FBFPoolableSoundActorDescription& ActivationParams, const FTransform& ActorTransform);
 
 
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and asset setup is skipped when this actor last activated with the same preset. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolableSoundActorPreset* Preset, const FTransform& ActorTransform);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableSoundActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableSoundActorPreset* Preset, const FTransform& ActorTransform);
 
 	
 	/** Used when manually controlling this pooled actor, otherwise you should use FireAndForget. This is typically handed to the pooled actor because you are now ready to let the pooled actor handle its own
@@ -68,6 +74,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor")
 	virtual void SetPoolableActorParams(const FBFPoolableSoundActorDescription& ActivationParams);
 
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolableSoundActorPreset* Preset);
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolableSoundActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
+
 	/*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	 *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
 	UFUNCTION(BlueprintCallable, Category="BF|Poolable Sound Actor")
@@ -92,11 +105,11 @@ public:
 	virtual void RestartSound();
 
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor")
-	void SetAutoReturnOnSoundFinished(bool bShouldAutoReturnOnSoundFinish) { ActivationInfo.bAutoReturnOnSoundFinish = bShouldAutoReturnOnSoundFinish; }
+	void SetAutoReturnOnSoundFinished(bool bShouldAutoReturnOnSoundFinish) { GetMutableActivationInfo().bAutoReturnOnSoundFinish = bShouldAutoReturnOnSoundFinish; }
 
 	// Is this system set to automatically return to the pool when the system finishes.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor")
-	bool GetAutoReturnOnSoundFinished() const { return ActivationInfo.bAutoReturnOnSoundFinish; }
+	bool GetAutoReturnOnSoundFinished() const { return GetActivationInfo().bAutoReturnOnSoundFinish; }
 
 	// Returns true if we have finished playing the sound, note if you delay the playing this still will be false until that time elapses and the sound finishes.
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor")
@@ -128,6 +141,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor")
 	float GetStartTime() const { return StartTime; }
 
+	/** Cheap game thread guess at whether a one shot would be heard at Location, used by bSkipIfInaudible before paying for an un-pool and activation.
+	 * False without an audio device (dedicated servers, -nosound), when outside the descriptions attenuation range (scaled by BF.OP.Sound.AudibleDistanceScale) of every listener,
+	 * or when the devices active sources already fill its max channels. Concurrency is resolved on the audio thread and isn't predicted, unloaded and looping sounds count as audible. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Sound Actor", meta=(WorldContext="WorldContextObject"))
+	static bool WouldSoundBeAudible(const UObject* WorldContextObject, const FBFPoolableSoundActorDescription& Description, const FVector& Location);
+
 protected:
 	UFUNCTION()
 	virtual void OnSoundFinished();
@@ -135,6 +154,15 @@ protected:
 	
 	// Called just prior to being activated in the world.
 	virtual void SetupObjectState(); 
+
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
+
+	// True when the active preset is the one we last set our assets up with, so only per activation state needs applying.
+	bool IsPresetAlreadyApplied() const { return ActivePreset && ActivePreset == LastAppliedPreset; }
+
+	// Copy on write access for setters, a preset is never modified so the first write copies it into our own ActivationInfo and drops the preset.
+	FBFPoolableSoundActorDescription& GetMutableActivationInfo();
 protected:
 	/* BP pools store UObject handles for convenience and I cant template member functions (:
 	 * So I have decided for everyone that we non ThreadSafe for performance benefits, you are using Multithreading with BP typically. You can always implement your own classes anyway.  */
@@ -148,6 +176,13 @@ protected:
 	FTimerHandle DelayedActivationTimerHandle;
 	FTimerHandle CurfewTimerHandle;
 
+	// Presets are referenced, not copied. LastAppliedPreset survives being pooled so the next activation with the same preset can skip asset setup.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableSoundActorPreset> ActivePreset = nullptr;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableSoundActorPreset> LastAppliedPreset = nullptr;
+
 	// Used to work out how long we have left.
 	float StartTime = 0.0;
 	
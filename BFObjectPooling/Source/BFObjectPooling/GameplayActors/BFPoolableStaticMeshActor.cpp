@@ -29,15 +29,7 @@ void ABFPoolableStaticMeshActor::FireAndForgetBP(FBFPooledObjectHandleBP& Handle
 	
 	SetPoolHandleBP(Handle);
 	SetPoolableActorParams(ActivationParams);
-	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
-
-	SetActorHiddenInGame(false);
-	SetActorEnableCollision(true);
-	
-	SetActorTransform(ActorTransform, false, nullptr, ETeleportType::ResetPhysics);
-	ActivatePoolableActor(ActivationInfo.bSimulatePhysics);
+	FireAndForget_Internal(ActorTransform);
 }
 
 
@@ -48,24 +40,58 @@ void ABFPoolableStaticMeshActor::FireAndForget(TBFPooledObjectHandlePtr<ABFPoola
 	
 	SetPoolHandle(Handle);
 	SetPoolableActorParams(ActivationParams);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableStaticMeshActor::FireAndForgetWithPresetBP(FBFPooledObjectHandleBP& Handle, const UBFPoolableStaticMeshActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid()); // You must have a valid handle.
+	
+	SetPoolHandleBP(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableStaticMeshActor::FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableStaticMeshActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableStaticMeshActorPreset* Preset, const FTransform& ActorTransform)
+{
+	bfEnsure(Handle.IsValid() && Handle->IsHandleValid()); // You must have a valid handle.
 	
-	if(ActivationInfo.ActorCurfew > 0)
-		SetCurfew(ActivationInfo.ActorCurfew);
+	SetPoolHandle(Handle);
+	SetPoolableActorPreset(Preset);
+	FireAndForget_Internal(ActorTransform);
+}
+
+
+void ABFPoolableStaticMeshActor::FireAndForget_Internal(const FTransform& ActorTransform)
+{
+	const FBFPoolableStaticMeshActorDescription& Info = GetActivationInfo();
+	if(Info.ActorCurfew > 0)
+		SetCurfew(Info.ActorCurfew);
 
 	SetActorHiddenInGame(false);
 	SetActorEnableCollision(true);
 	
 	SetActorTransform(ActorTransform, false, nullptr, ETeleportType::ResetPhysics);
-	ActivatePoolableActor(ActivationInfo.bSimulatePhysics);
+	ActivatePoolableActor(Info.bSimulatePhysics);
 }
 
 
 void ABFPoolableStaticMeshActor::SetPoolableActorParams( const FBFPoolableStaticMeshActorDescription& ActivationParams)
 {
+	ActivePreset = nullptr;
 	ActivationInfo = ActivationParams;
 }
 
 
+void ABFPoolableStaticMeshActor::SetPoolableActorPreset(const UBFPoolableStaticMeshActorPreset* Preset)
+{
+	bfEnsure(Preset); // Fall back to whatever ActivationInfo holds (defaults when fresh from the pool).
+	ActivePreset = Preset;
+}
+
+
 void ABFPoolableStaticMeshActor::ActivatePoolableActor(bool bSimulatePhysics)
 {
 	SetupObjectState(bSimulatePhysics);
@@ -74,24 +100,31 @@ void ABFPoolableStaticMeshActor::ActivatePoolableActor(bool bSimulatePhysics)
 
 void ABFPoolableStaticMeshActor::SetupObjectState(bool bSimulatePhysics)
 {
-	bfValid(ActivationInfo.Mesh); // you must set the mesh
-	StaticMeshComponent->SetStaticMesh(ActivationInfo.Mesh);
+	const FBFPoolableStaticMeshActorDescription& Info = GetActivationInfo();
+	bfEnsure(!Info.Mesh.IsNull()); // you must set the mesh
+
+	// Same preset as last time means the component already has these assets.
+	if(!IsPresetAlreadyApplied())
+	{
+		StaticMeshComponent->SetStaticMesh(BF::OP::ResolveSoftAsset(Info.Mesh));
 
-	for(const auto& [Material, Slot] : ActivationInfo.Materials)
-		StaticMeshComponent->SetMaterial(Slot, Material);
+		for(const auto& [Material, Slot] : Info.Materials)
+			StaticMeshComponent->SetMaterial(Slot, BF::OP::ResolveSoftAsset(Material));
+	}
 
 	StaticMeshComponent->AttachToComponent(RootComponent, FAttachmentTransformRules::SnapToTargetIncludingScale);
-	StaticMeshComponent->SetRelativeTransform(ActivationInfo.RelativeTransform);
+	StaticMeshComponent->SetRelativeTransform(Info.RelativeTransform);
 	
 	// I've noticed issues with un-pooling and activating a simulating mesh sometimes causes the BodyInstance to not update its transform (even though our actor and mesh scene comp transform does update),
 	// not sure why but I suspect visibility has something to do with it when we return to the pool, anyway this just ensures they are in sync.
 	if(bSimulatePhysics && bWasSimulating)
 		StaticMeshComponent->BodyInstance.SetBodyTransform(StaticMeshComponent->GetComponentTransform(), ETeleportType::ResetPhysics, bSimulatePhysics);
 	
-	StaticMeshComponent->SetCollisionProfileName(ActivationInfo.CollisionProfile.Name);
-	StaticMeshComponent->SetCollisionEnabled(ActivationInfo.CollisionEnabled);
+	StaticMeshComponent->SetCollisionProfileName(Info.CollisionProfile.Name);
+	StaticMeshComponent->SetCollisionEnabled(Info.CollisionEnabled);
 
 	StaticMeshComponent->SetSimulatePhysics(bSimulatePhysics);
+	LastAppliedPreset = ActivePreset;
 }
 
 
@@ -123,7 +156,10 @@ void ABFPoolableStaticMeshActor::OnObjectPooled_Implementation()
 	ObjectHandle = nullptr;
 	BPObjectHandle = nullptr;
 
-	ActivationInfo = {};
+	if(ActivePreset)
+		ActivePreset = nullptr; // Keep LastAppliedPreset, the components still hold its assets.
+	else
+		ActivationInfo = {};
 }
 
 
@@ -168,16 +204,14 @@ void ABFPoolableStaticMeshActor::SetCurfew(float SecondsUntilReturn)
 {
 	bfEnsure(SecondsUntilReturn > 0);
 	RemoveCurfew();
-	GetWorld()->GetTimerManager().SetTimer(CurfewTimerHandle, this, &ABFPoolableStaticMeshActor::OnCurfewExpired, SecondsUntilReturn, false);
+	BF::OP::SetPoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle, SecondsUntilReturn,
+		FSimpleDelegate::CreateUObject(this, &ABFPoolableStaticMeshActor::OnCurfewExpired));
 }
 
 
 void ABFPoolableStaticMeshActor::RemoveCurfew()
 {
-	if(GetWorld()->GetTimerManager().IsTimerActive(CurfewTimerHandle))
-		GetWorld()->GetTimerManager().ClearTimer(CurfewTimerHandle);
-	
-	CurfewTimerHandle.Invalidate();
+	BF::OP::RemovePoolableActorCurfew(this, ObjectHandle, BPObjectHandle, bIsUsingBPHandle, CurfewTimerHandle);
 }
 
 
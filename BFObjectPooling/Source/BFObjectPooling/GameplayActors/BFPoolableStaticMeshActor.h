@@ -7,6 +7,7 @@
 #include "BFObjectPooling/Pool/BFPooledObjectHandle.h"
 #include "GameFramework/Actor.h"
 #include "BFPoolableActorHelpers.h"
+#include "BFPoolableActorPresets.h"
 #include "BFPoolableStaticMeshActor.generated.h"
 
  
@@ -46,7 +47,13 @@ public:
 	// For easy fire and forget usage, will invalidate the Handle as the PoolActor now takes responsibility for returning based on our poolable actor params.
 	virtual void FireAndForget(TBFPooledObjectHandlePtr<ABFPoolableStaticMeshActor, ESPMode::NotThreadSafe>& Handle, 
 		const FBFPoolableStaticMeshActorDescription& ActivationParams, const FTransform& ActorTransform);
-	
+
+
+	/** Preset version of FireAndForget, the preset is referenced rather than copied and asset setup is skipped when this actor last activated with the same preset. */
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Static Mesh Actor", meta=(DisplayName="Fire And Forget With Preset"))
+	virtual void FireAndForgetWithPresetBP(UPARAM(ref)FBFPooledObjectHandleBP& Handle, const UBFPoolableStaticMeshActorPreset* Preset, const FTransform& ActorTransform);
+
+	virtual void FireAndForgetWithPreset(TBFPooledObjectHandlePtr<ABFPoolableStaticMeshActor, ESPMode::NotThreadSafe>& Handle, const UBFPoolableStaticMeshActorPreset* Preset, const FTransform& ActorTransform);
 
 	
 	/** Used when manually controlling this pooled actor, otherwise you should use FireAndForget. This is typically handed to the pooled actor because you are now ready to let the pooled actor handle its own
@@ -62,6 +69,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BF| Poolable Static Mesh Actor")
 	virtual void SetPoolableActorParams(const FBFPoolableStaticMeshActorDescription& ActivationParams);
 
+	// Same as SetPoolableActorParams but references the immutable preset instead of copying a description, see UBFPoolableActorPreset.
+	UFUNCTION(BlueprintCallable, Category="BF| Poolable Static Mesh Actor")
+	virtual void SetPoolableActorPreset(const UBFPoolableStaticMeshActorPreset* Preset);
+
+	// The description currently driving this actor, either the active preset's or our own copy.
+	const FBFPoolableStaticMeshActorDescription& GetActivationInfo() const { return ActivePreset ? ActivePreset->Description : ActivationInfo; }
+
 	/*	Activates the pooled actor, requires you to have already set the pooled actors ActivationInfo, ideally you would have set
 	 *	everything for the actors state before calling this function such as its transforms and everything else needed. */ 
 	UFUNCTION(BlueprintCallable, Category="BF|Poolable Static Mesh Actor")
@@ -95,6 +109,12 @@ protected:
 	
 	// Called just prior to being activated in the world.
 	virtual void SetupObjectState(bool bSimulatePhysics); 
+
+	// Shared tail of the FireAndForget variants once the handle and params are set.
+	virtual void FireAndForget_Internal(const FTransform& ActorTransform);
+
+	// True when the active preset is the one we last set our assets up with, so only per activation state needs applying.
+	bool IsPresetAlreadyApplied() const { return ActivePreset && ActivePreset == LastAppliedPreset; }
 protected:
 	/* BP pools store UObject handles for convenience and I cant template member functions (:
 	 * So I have decided for everyone that we non ThreadSafe for performance benefits, you are using Multithreading with BP typically. You can always implement your own classes anyway.  */
@@ -107,6 +127,13 @@ protected:
 	FBFPoolableStaticMeshActorDescription ActivationInfo;
 	FTimerHandle CurfewTimerHandle;
 
+	// Presets are referenced, not copied. LastAppliedPreset survives being pooled so the next activation with the same preset can skip asset setup.
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableStaticMeshActorPreset> ActivePreset = nullptr;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<const UBFPoolableStaticMeshActorPreset> LastAppliedPreset = nullptr;
+
 	UPROPERTY(Transient)
 	uint32 bIsUsingBPHandle:1 = false;
 	uint32 bWasSimulating:1 = false;
@@ -0,0 +1,297 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFProjectileSimulationSubsystem.h"
+#include "BFPoolableProjectileActor.h"
+#include "BFObjectPooling/Module/BFObjectPooling.h"
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+
+
+UBFProjectileSimulationSubsystem* UBFProjectileSimulationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBFProjectileSimulationSubsystem>() : nullptr;
+}
+
+
+bool UBFProjectileSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+void UBFProjectileSimulationSubsystem::RegisterProjectile(ABFPoolableProjectileActor* Projectile, const FBFProjectileSimulationParams& Params)
+{
+	bfValid(Projectile);
+	int32 Index = Projectile->BatchedSimulationIndex;
+	if(Index == INDEX_NONE)
+	{
+		Index = Projectiles.Add(Projectile);
+		Positions.AddUninitialized();
+		Velocities.AddUninitialized();
+		Rotations.AddUninitialized();
+		HomingTargetLocations.AddZeroed();
+		HomingTargets.AddDefaulted();
+		MaxSpeeds.AddUninitialized();
+		GravityScales.AddUninitialized();
+		Bouncinesses.AddUninitialized();
+		Frictions.AddUninitialized();
+		HomingAccelerations.AddUninitialized();
+		BounceStopSpeeds.AddUninitialized();
+		Flags.AddUninitialized();
+		Shapes.AddDefaulted();
+		Channels.AddUninitialized();
+		ResponseParams.AddDefaulted();
+		Projectile->BatchedSimulationIndex = Index;
+	}
+
+	Positions[Index] = Projectile->GetActorLocation();
+	Rotations[Index] = Projectile->GetActorQuat();
+	Velocities[Index] = Params.Velocity;
+	HomingTargets[Index] = Params.HomingTarget;
+	MaxSpeeds[Index] = Params.MaxSpeed;
+	GravityScales[Index] = Params.GravityScale;
+	Bouncinesses[Index] = Params.Bounciness;
+	Frictions[Index] = Params.Friction;
+	HomingAccelerations[Index] = Params.HomingAcceleration;
+	BounceStopSpeeds[Index] = Params.BounceStopSpeed;
+	
+	uint8 NewFlags = 0;
+	NewFlags |= Params.bShouldBounce ? Flag_Bounce : 0;
+	NewFlags |= Params.bSweepCollision ? Flag_Sweep : 0;
+	NewFlags |= Params.bRotationFollowsVelocity ? Flag_RotationFollowsVelocity : 0;
+	NewFlags |= Params.bRotationRemainsVertical ? Flag_RotationRemainsVertical : 0;
+	NewFlags |= Params.bBounceAngleAffectsFriction ? Flag_BounceAngleAffectsFriction : 0;
+	NewFlags |= Params.HomingTarget.IsValid() ? Flag_Homing : 0;
+	Flags[Index] = NewFlags;
+
+	// The shape and its responses only change between activations, the projectile re-registers on every one.
+	if(const UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent()))
+	{
+		Shapes[Index] = Root->GetCollisionShape();
+		Channels[Index] = Root->GetCollisionObjectType();
+		ResponseParams[Index] = FCollisionResponseParams(Root->GetCollisionResponseToChannels());
+	}
+	else
+		Flags[Index] &= ~Flag_Sweep;
+}
+
+
+void UBFProjectileSimulationSubsystem::UnregisterProjectile(ABFPoolableProjectileActor* Projectile)
+{
+	if(!Projectile || Projectile->BatchedSimulationIndex == INDEX_NONE)
+		return;
+
+	const int32 Index = Projectile->BatchedSimulationIndex;
+	bfEnsure(Projectiles.IsValidIndex(Index) && Projectiles[Index] == Projectile);
+	Projectile->GetProjectileMovementComponent()->Velocity = Velocities[Index];
+	Slots.Remove(Projectiles, &ABFPoolableProjectileActor::BatchedSimulationIndex, Index, [this](int32 Slot) { RemoveAttributesAtSwap(Slot); });
+}
+
+
+void UBFProjectileSimulationSubsystem::Tick(float DeltaTime)
+{
+	SCOPED_NAMED_EVENT(UBFProjectileSimulationSubsystem_Tick, FColor::Green);
+	const int32 NumSimulating = Projectiles.Num();
+	if(NumSimulating == 0 || DeltaTime <= 0.f)
+		return;
+
+	const UWorld* World = GetWorld();
+	const float GravityZ = World->GetGravityZ();
+
+	// Everything that touches other UObjects is read here on the game thread so the parallel pass only reads and writes our own arrays (and the physics scene).
+	for(int32 Index = 0; Index < NumSimulating; ++Index)
+	{
+		const ABFPoolableProjectileActor* Projectile = Projectiles[Index];
+		if(!IsValid(Projectile))
+		{
+			// Destroyed without being returned, nothing to write back to.
+			Slots.MarkPendingRemoval(Projectiles, Index);
+			continue;
+		}
+
+		uint8& ProjectileFlags = Flags[Index];
+		if(ProjectileFlags & Flag_Homing)
+		{
+			if(const USceneComponent* Target = HomingTargets[Index].Get())
+				HomingTargetLocations[Index] = Target->GetComponentLocation();
+			else
+				ProjectileFlags &= ~Flag_Homing;
+		}
+
+		const UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+		const bool bSweep = (ProjectileFlags & Flag_Sweep) && Root && Root->IsQueryCollisionEnabled();
+		ProjectileFlags = bSweep ? ProjectileFlags | Flag_SweepThisFrame : ProjectileFlags & ~Flag_SweepThisFrame;
+	}
+
+	if(Hits.Num() < NumSimulating)
+		Hits.SetNum(NumSimulating);
+	const bool bParallelSweeps = BF::OP::CVarProjectileSimulationParallelSweeps.GetValueOnGameThread();
+	
+	auto Sweep = [this, World](int32 Index, const FVector& Start, FVector& End)
+	{
+		const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BFProjectileSimulation), false, Projectiles[Index]);
+		if(World->SweepSingleByChannel(Hits[Index], Start, End, Rotations[Index], Channels[Index], Shapes[Index], QueryParams, ResponseParams[Index]))
+			End = Hits[Index].Location;
+	};
+
+	// Same integration as UProjectileMovementComponent::ComputeVelocity/ComputeMoveDelta, gravity and homing acceleration with velocity clamped to the max speed.
+	TArray<FVector, TInlineAllocator<1>> SweepStarts;
+	if(!bParallelSweeps)
+		SweepStarts.SetNumUninitialized(NumSimulating);
+	
+	ParallelFor(NumSimulating, [&](int32 Index)
+	{
+		Hits[Index].Reset(1.f, false);
+		// Written before any early out, the serial sweep pass reads it for every index. Equal to the end position means nothing to sweep.
+		if(!bParallelSweeps)
+			SweepStarts[Index] = Positions[Index];
+		if(!Projectiles[Index])
+			return;
+
+		const uint8 ProjectileFlags = Flags[Index];
+		FVector Acceleration(0.f, 0.f, GravityZ * GravityScales[Index]);
+		if(ProjectileFlags & Flag_Homing)
+			Acceleration += (HomingTargetLocations[Index] - Positions[Index]).GetSafeNormal() * HomingAccelerations[Index];
+
+		const FVector OldVelocity = Velocities[Index];
+		FVector NewVelocity = OldVelocity + Acceleration * DeltaTime;
+		if(MaxSpeeds[Index] > 0.f)
+			NewVelocity = NewVelocity.GetClampedToMaxSize(MaxSpeeds[Index]);
+		Velocities[Index] = NewVelocity;
+
+		if((ProjectileFlags & Flag_RotationFollowsVelocity) && !NewVelocity.IsNearlyZero())
+		{
+			FRotator Rotation = NewVelocity.Rotation();
+			if(ProjectileFlags & Flag_RotationRemainsVertical)
+			{
+				Rotation.Pitch = 0.f;
+				Rotation.Roll = 0.f;
+			}
+			Rotations[Index] = Rotation.Quaternion();
+		}
+
+		const FVector Start = Positions[Index];
+		FVector End = Start + OldVelocity * DeltaTime + (NewVelocity - OldVelocity) * (0.5f * DeltaTime);
+		if(bParallelSweeps && (ProjectileFlags & Flag_SweepThisFrame) && End != Start)
+			Sweep(Index, Start, End);
+		Positions[Index] = End;
+	}, NumSimulating < BF::OP::CVarProjectileSimulationMinParallelBatch.GetValueOnGameThread() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	if(!bParallelSweeps)
+	{
+		for(int32 Index = 0; Index < NumSimulating; ++Index)
+		{
+			if(Projectiles[Index] && (Flags[Index] & Flag_SweepThisFrame) && Positions[Index] != SweepStarts[Index])
+				Sweep(Index, SweepStarts[Index], Positions[Index]);
+		}
+	}
+
+	// Write back and dispatch in order, handlers are free to return, re-fire or destroy any projectile so everything is looked up by index again after each call.
+	Slots.bDeferRemoval = true;
+	for(int32 Index = 0; Index < NumSimulating; ++Index)
+	{
+		ABFPoolableProjectileActor* Projectile = Projectiles[Index];
+		if(!Projectile)
+			continue;
+
+		// Not swept, the sweep already happened. Overlaps are still updated by the move like they are for the movement component.
+		Projectile->SetActorLocationAndRotation(Positions[Index], Rotations[Index], false, nullptr, ETeleportType::None);
+		if(Projectiles[Index] == Projectile && Hits[Index].bBlockingHit)
+			HandleImpact(Index, Hits[Index]);
+	}
+	Slots.bDeferRemoval = false;
+
+	Slots.Compact(Projectiles, &ABFPoolableProjectileActor::BatchedSimulationIndex, [this](int32 Slot) { RemoveAttributesAtSwap(Slot); });
+}
+
+
+void UBFProjectileSimulationSubsystem::HandleImpact(int32 Index, const FHitResult& Hit)
+{
+	ABFPoolableProjectileActor* Projectile = Projectiles[Index];
+	UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+	if(!Root)
+		return;
+
+	// Same path MoveComponent takes for a blocking sweep, fires the actors NotifyHit, OnComponentHit (our OnProjectileActorHit) and the other sides events.
+	Root->DispatchBlockingHit(*Projectile, Hit);
+	if(Projectiles[Index] != Projectile)
+		return; // Returned to the pool (or re-registered) by the hit.
+
+	if(!(Flags[Index] & Flag_Bounce))
+	{
+		StopProjectile(Index, Hit);
+		return;
+	}
+
+	// UProjectileMovementComponent::ComputeBounceDelta, strip the normal part of the velocity, apply friction and add the normal back scaled by the bounciness.
+	FVector& Velocity = Velocities[Index];
+	const float VDotNormal = Velocity | Hit.Normal;
+	if(VDotNormal <= 0.f)
+	{
+		const FVector ProjectedNormal = Hit.Normal * -VDotNormal;
+		const float Speed = Velocity.Size();
+		Velocity += ProjectedNormal;
+		
+		const float ScaledFriction = (Flags[Index] & Flag_BounceAngleAffectsFriction) && Speed > UE_KINDA_SMALL_NUMBER ?
+			FMath::Clamp(-VDotNormal / Speed, 0.f, 1.f) * Frictions[Index] : Frictions[Index];
+		Velocity *= FMath::Clamp(1.f - ScaledFriction, 0.f, 1.f);
+		Velocity += ProjectedNormal * FMath::Max(Bouncinesses[Index], 0.f);
+	}
+
+	if(Velocity.SizeSquared() < FMath::Square(BounceStopSpeeds[Index]))
+	{
+		StopProjectile(Index, Hit);
+		return;
+	}
+	
+	Projectile->GetProjectileMovementComponent()->OnProjectileBounce.Broadcast(Hit, Velocity);
+}
+
+
+void UBFProjectileSimulationSubsystem::StopProjectile(int32 Index, const FHitResult& Hit)
+{
+	ABFPoolableProjectileActor* Projectile = Projectiles[Index];
+	Velocities[Index] = FVector::ZeroVector;
+	UnregisterProjectile(Projectile);
+	
+	// The actor binds OnProjectileStopped to this, anyone else listening on the component hears the stop too.
+	Projectile->GetProjectileMovementComponent()->OnProjectileStop.Broadcast(Hit);
+}
+
+
+void UBFProjectileSimulationSubsystem::RemoveAttributesAtSwap(int32 Index)
+{
+	Positions.RemoveAtSwap(Index);
+	Velocities.RemoveAtSwap(Index);
+	Rotations.RemoveAtSwap(Index);
+	HomingTargetLocations.RemoveAtSwap(Index);
+	HomingTargets.RemoveAtSwap(Index);
+	MaxSpeeds.RemoveAtSwap(Index);
+	GravityScales.RemoveAtSwap(Index);
+	Bouncinesses.RemoveAtSwap(Index);
+	Frictions.RemoveAtSwap(Index);
+	HomingAccelerations.RemoveAtSwap(Index);
+	BounceStopSpeeds.RemoveAtSwap(Index);
+	Flags.RemoveAtSwap(Index);
+	Shapes.RemoveAtSwap(Index);
+	Channels.RemoveAtSwap(Index);
+	ResponseParams.RemoveAtSwap(Index);
+}
+
+
+TStatId UBFProjectileSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBFProjectileSimulationSubsystem, STATGROUP_Tickables);
+}
+
+
+void UBFProjectileSimulationSubsystem::Deinitialize()
+{
+	Slots.Reset(Projectiles, &ABFPoolableProjectileActor::BatchedSimulationIndex, [this](int32 Slot) { RemoveAttributesAtSwap(Slot); });
+	Super::Deinitialize();
+}
@@ -0,0 +1,106 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionShape.h"
+#include "CollisionQueryParams.h"
+#include "Engine/HitResult.h"
+#include "BFBatchedSlots.h"
+#include "BFProjectileSimulationSubsystem.generated.h"
+
+
+class ABFPoolableProjectileActor;
+class USceneComponent;
+
+
+// Resolved per shot movement settings for a batched projectile, the same values SetupObjectState would otherwise hand to the projectile movement component.
+struct FBFProjectileSimulationParams
+{
+	FVector Velocity = FVector::ZeroVector;
+	TWeakObjectPtr<USceneComponent> HomingTarget;
+	float MaxSpeed = 0.f; // 0 for no limit, same as the movement component.
+	float GravityScale = 1.f;
+	float Bounciness = 0.5f;
+	float Friction = 0.2f;
+	float HomingAcceleration = 0.f;
+	float BounceStopSpeed = 5.f; // Bouncing below this speed stops the projectile.
+	uint8 bShouldBounce:1 = true;
+	uint8 bSweepCollision:1 = true;
+	uint8 bRotationFollowsVelocity:1 = true;
+	uint8 bRotationRemainsVertical:1 = false;
+	uint8 bBounceAngleAffectsFriction:1 = false;
+};
+
+
+/** Moves every ABFPoolableProjectileActor fired with bUseBatchedSimulation instead of each one ticking its own UProjectileMovementComponent.
+ * State lives in parallel arrays indexed by the projectiles simulation index, each tick gathers homing targets on the game thread, integrates and sweeps everything
+ * in a ParallelFor (see BF.OP.ProjectileSimulation.*) and then writes transforms back and dispatches hits/bounces/stops on the game thread in registration order.
+ * Hits go through the roots DispatchBlockingHit and stops through the movement components OnProjectileStop, so the projectiles delegates behave as they do unbatched.
+ * Projectiles are unregistered when they stop or are returned to the pool, removal while dispatching only nulls the slot and the arrays are compacted after. */
+UCLASS()
+class BFOBJECTPOOLING_API UBFProjectileSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	static UBFProjectileSimulationSubsystem* Get(const UObject* WorldContextObject);
+
+	// Starts simulating from the projectiles current transform, its movement component should not be ticking. Re-registering just replaces the params.
+	void RegisterProjectile(ABFPoolableProjectileActor* Projectile, const FBFProjectileSimulationParams& Params);
+	// Writes the simulated velocity back to the movement component and stops simulating. Does nothing if the projectile isn't registered.
+	void UnregisterProjectile(ABFPoolableProjectileActor* Projectile);
+	int32 GetNumSimulatedProjectiles() const { return Slots.GetNumLive(Projectiles); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Bounces or stops the projectile after its hit has been dispatched.
+	void HandleImpact(int32 Index, const FHitResult& Hit);
+	void StopProjectile(int32 Index, const FHitResult& Hit);
+	// Everything but Projectiles, see BF::OP::FBFBatchedSlots.
+	void RemoveAttributesAtSwap(int32 Index);
+
+	enum EFlags : uint8
+	{
+		Flag_Bounce = 1 << 0,
+		Flag_Sweep = 1 << 1,
+		Flag_RotationFollowsVelocity = 1 << 2,
+		Flag_RotationRemainsVertical = 1 << 3,
+		Flag_BounceAngleAffectsFriction = 1 << 4,
+		Flag_Homing = 1 << 5,
+		Flag_SweepThisFrame = 1 << 6, // Sweep and the root still has query collision, re-evaluated every tick since impact handlers may disable it.
+	};
+
+protected:
+	// Null while pending removal.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABFPoolableProjectileActor>> Projectiles;
+
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FQuat> Rotations;
+	TArray<FVector> HomingTargetLocations;
+	TArray<TWeakObjectPtr<USceneComponent>> HomingTargets;
+	TArray<float> MaxSpeeds;
+	TArray<float> GravityScales;
+	TArray<float> Bouncinesses;
+	TArray<float> Frictions;
+	TArray<float> HomingAccelerations;
+	TArray<float> BounceStopSpeeds;
+	TArray<uint8> Flags;
+
+	// Captured from the root primitive at registration.
+	TArray<FCollisionShape> Shapes;
+	TArray<TEnumAsByte<ECollisionChannel>> Channels;
+	TArray<FCollisionResponseParams> ResponseParams;
+
+	// Per tick scratch, only the first NumSimulating entries are meaningful.
+	TArray<FHitResult> Hits;
+	
+	// Removal is deferred while hits are being dispatched.
+	BF::OP::FBFBatchedSlots Slots;
+};
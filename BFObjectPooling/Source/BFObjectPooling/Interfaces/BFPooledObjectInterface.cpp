@@ -3,3 +3,41 @@
 
 #include "BFPooledObjectInterface.h"
 
+
+FBFPooledObjectInterfaceDispatch FBFPooledObjectInterfaceDispatch::Resolve(const UClass* Class)
+{
+	FBFPooledObjectInterfaceDispatch Dispatch;
+	if(!Class || !Class->ImplementsInterface(UBFPooledObjectInterface::StaticClass()))
+		return Dispatch;
+
+	Dispatch.bImplementsInterface = true;
+
+	// A c++ implementer anywhere up the hierarchy means every object of this class can be called natively, BP implementers have no native address.
+	for(const UClass* Current = Class; Current && Dispatch.NativeOffset == INDEX_NONE; Current = Current->GetSuperClass())
+	{
+		for(const FImplementedInterface& Implemented : Current->Interfaces)
+		{
+			if(!Implemented.bImplementedByK2 && Implemented.Class && Implemented.Class->IsChildOf(UBFPooledObjectInterface::StaticClass()))
+			{
+				Dispatch.NativeOffset = Implemented.PointerOffset;
+				break;
+			}
+		}
+	}
+
+	auto ResolveEvent = [Class, bNative = Dispatch.NativeOffset != INDEX_NONE](FName EventName)
+	{
+		// Only BP classes own a (script) function for an event they override, otherwise we find the interfaces own native declaration or nothing.
+		const UFunction* Func = Class->FindFunctionByName(EventName);
+		if(Func && !Func->GetOwnerClass()->HasAnyClassFlags(CLASS_Native))
+			return EBFPooledObjectEventDispatch::Script;
+		return bNative ? EBFPooledObjectEventDispatch::Native : EBFPooledObjectEventDispatch::None;
+	};
+
+	Dispatch.Created = ResolveEvent(GET_FUNCTION_NAME_CHECKED(IBFPooledObjectInterface, OnObjectCreated));
+	Dispatch.Destroyed = ResolveEvent(GET_FUNCTION_NAME_CHECKED(IBFPooledObjectInterface, OnObjectDestroyed));
+	Dispatch.Pooled = ResolveEvent(GET_FUNCTION_NAME_CHECKED(IBFPooledObjectInterface, OnObjectPooled));
+	Dispatch.UnPooled = ResolveEvent(GET_FUNCTION_NAME_CHECKED(IBFPooledObjectInterface, OnObjectUnPooled));
+	Dispatch.GameplayTag = ResolveEvent(GET_FUNCTION_NAME_CHECKED(IBFPooledObjectInterface, GetObjectGameplayTag));
+	return Dispatch;
+}
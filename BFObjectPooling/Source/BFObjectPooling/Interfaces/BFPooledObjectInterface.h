@@ -6,6 +6,8 @@
 #include "UObject/Interface.h"
 #include "BFPooledObjectInterface.generated.h"
 
+struct FBFPooledObjectInterfaceDispatch;
+
 
 UINTERFACE()
 class BFOBJECTPOOLING_API UBFPooledObjectInterface : public UInterface
@@ -18,6 +20,7 @@ class BFOBJECTPOOLING_API UBFPooledObjectInterface : public UInterface
 class BFOBJECTPOOLING_API IBFPooledObjectInterface
 {
 	GENERATED_BODY()
+	friend FBFPooledObjectInterfaceDispatch;
 
 protected:
 	// Called upon creation of the object, should not be used for any kind of activation logic, only for setting up the object, see OnObjectUnpooled for that.
@@ -43,14 +46,72 @@ protected:
 };
 
 
+enum class EBFPooledObjectEventDispatch : uint8
+{
+	None, // Not implemented, or implemented in BP without overriding this event, skipped entirely.
+	Native, // Implemented in c++ and not overridden in BP, a virtual call through the cached interface offset.
+	Script, // Overridden in BP, goes through the Execute_ thunk (ProcessEvent).
+};
 
 
+/* How each interface event is called for objects of a single class, resolved once by TBFObjectPool::InitPool since a pools class is fixed.
+ * Saves the Implements<> class interface lookup and, for c++ implementers, the FindFunction/ProcessEvent the Execute_ thunks would do on every un-pool and return. */
+struct BFOBJECTPOOLING_API FBFPooledObjectInterfaceDispatch
+{
+	static FBFPooledObjectInterfaceDispatch Resolve(const UClass* Class);
 
-
-
-
-
-
-
-
-
+	bool ImplementsInterface() const { return bImplementsInterface; }
+	
+	void OnObjectCreated(UObject* Obj) const
+	{
+		if(Created == EBFPooledObjectEventDispatch::Native)
+			GetNative(Obj)->OnObjectCreated_Implementation();
+		else if(Created == EBFPooledObjectEventDispatch::Script)
+			IBFPooledObjectInterface::Execute_OnObjectCreated(Obj);
+	}
+
+	void OnObjectDestroyed(UObject* Obj) const
+	{
+		if(Destroyed == EBFPooledObjectEventDispatch::Native)
+			GetNative(Obj)->OnObjectDestroyed_Implementation();
+		else if(Destroyed == EBFPooledObjectEventDispatch::Script)
+			IBFPooledObjectInterface::Execute_OnObjectDestroyed(Obj);
+	}
+
+	void OnObjectPooled(UObject* Obj) const
+	{
+		if(Pooled == EBFPooledObjectEventDispatch::Native)
+			GetNative(Obj)->OnObjectPooled_Implementation();
+		else if(Pooled == EBFPooledObjectEventDispatch::Script)
+			IBFPooledObjectInterface::Execute_OnObjectPooled(Obj);
+	}
+
+	void OnObjectUnPooled(UObject* Obj) const
+	{
+		if(UnPooled == EBFPooledObjectEventDispatch::Native)
+			GetNative(Obj)->OnObjectUnPooled_Implementation();
+		else if(UnPooled == EBFPooledObjectEventDispatch::Script)
+			IBFPooledObjectInterface::Execute_OnObjectUnPooled(Obj);
+	}
+
+	FGameplayTag GetObjectGameplayTag(UObject* Obj) const
+	{
+		if(GameplayTag == EBFPooledObjectEventDispatch::Native)
+			return GetNative(Obj)->GetObjectGameplayTag_Implementation();
+		if(GameplayTag == EBFPooledObjectEventDispatch::Script)
+			return IBFPooledObjectInterface::Execute_GetObjectGameplayTag(Obj);
+		return FGameplayTag::EmptyTag;
+	}
+
+private:
+	// Only valid for objects of the resolved class (or a child of it), same offset UObject::GetNativeInterfaceAddress would look up.
+	IBFPooledObjectInterface* GetNative(UObject* Obj) const { return reinterpret_cast<IBFPooledObjectInterface*>(reinterpret_cast<uint8*>(Obj) + NativeOffset); }
+
+	EBFPooledObjectEventDispatch Created = EBFPooledObjectEventDispatch::None;
+	EBFPooledObjectEventDispatch Destroyed = EBFPooledObjectEventDispatch::None;
+	EBFPooledObjectEventDispatch Pooled = EBFPooledObjectEventDispatch::None;
+	EBFPooledObjectEventDispatch UnPooled = EBFPooledObjectEventDispatch::None;
+	EBFPooledObjectEventDispatch GameplayTag = EBFPooledObjectEventDispatch::None;
+	int32 NativeOffset = INDEX_NONE;
+	bool bImplementsInterface = false;
+};
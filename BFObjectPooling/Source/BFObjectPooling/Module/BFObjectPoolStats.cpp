@@ -0,0 +1,123 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolStats.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+
+DEFINE_STAT(STAT_BFObjectPool_UnpoolObject);
+DEFINE_STAT(STAT_BFObjectPool_ActivateObject);
+DEFINE_STAT(STAT_BFObjectPool_DeactivateObject);
+DEFINE_STAT(STAT_BFObjectPool_CreatePoolEntry);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Unpool Hits"), STAT_BFObjectPool_UnpoolHits, STATGROUP_BFObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Capacity Misses"), STAT_BFObjectPool_Misses, STATGROUP_BFObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Lazy Creations"), STAT_BFObjectPool_LazyCreations, STATGROUP_BFObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cooldown Rejections"), STAT_BFObjectPool_CooldownRejections, STATGROUP_BFObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Evictions"), STAT_BFObjectPool_Evictions, STATGROUP_BFObjectPool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Overflows"), STAT_BFObjectPool_Overflows, STATGROUP_BFObjectPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Objects"), STAT_BFObjectPool_ActiveObjects, STATGROUP_BFObjectPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Inactive Objects"), STAT_BFObjectPool_InactiveObjects, STATGROUP_BFObjectPool);
+
+CSV_DEFINE_CATEGORY_MODULE(BFOBJECTPOOLING_API, BFObjectPool, true);
+
+LLM_DEFINE_TAG(BFObjectPool);
+
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_UnpoolHits, TEXT("BFObjectPool/UnpoolHits"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_Misses, TEXT("BFObjectPool/CapacityMisses"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_LazyCreations, TEXT("BFObjectPool/LazyCreations"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_CooldownRejections, TEXT("BFObjectPool/CooldownRejections"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_Evictions, TEXT("BFObjectPool/Evictions"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_Overflows, TEXT("BFObjectPool/Overflows"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_ActiveObjects, TEXT("BFObjectPool/ActiveObjects"));
+TRACE_DECLARE_INT_COUNTER(BFObjectPool_InactiveObjects, TEXT("BFObjectPool/InactiveObjects"));
+
+
+namespace BF::OP::Stats
+{
+	static int32 FrameCounts[static_cast<int32>(EBFObjectPoolStat::Num)] = {};
+	static int32 NumPooledObjects = 0;
+	static int32 NumInactiveObjects = 0;
+	static FDelegateHandle EndFrameHandle;
+
+
+	void RecordGlobal(EBFObjectPoolStat Stat, int32 Num)
+	{
+		if(Stat == EBFObjectPoolStat::Num)
+			return;
+
+		FrameCounts[static_cast<int32>(Stat)] += Num;
+
+		// CSV and the stat counters already reset per frame so these go straight in, trace counters are set once at the end of the frame.
+		switch(Stat)
+		{
+			case EBFObjectPoolStat::UnpoolHit:
+				INC_DWORD_STAT_BY(STAT_BFObjectPool_UnpoolHits, Num);
+				CSV_CUSTOM_STAT(BFObjectPool, UnpoolHits, Num, ECsvCustomStatOp::Accumulate);
+				break;
+			case EBFObjectPoolStat::Miss:
+				INC_DWORD_STAT_BY(STAT_BFObjectPool_Misses, Num);
+				CSV_CUSTOM_STAT(BFObjectPool, CapacityMisses, Num, ECsvCustomStatOp::Accumulate);
+				break;
+			case EBFObjectPoolStat::LazyCreation:
+				INC_DWORD_STAT_BY(STAT_BFObjectPool_LazyCreations, Num);
+				CSV_CUSTOM_STAT(BFObjectPool, LazyCreations, Num, ECsvCustomStatOp::Accumulate);
+				break;
+			case EBFObjectPoolStat::CooldownRejection:
+				INC_DWORD_STAT_BY(STAT_BFObjectPool_CooldownRejections, Num);
+				CSV_CUSTOM_STAT(BFObjectPool, CooldownRejections, Num, ECsvCustomStatOp::Accumulate);
+				break;
+			case EBFObjectPoolStat::Eviction:
+				INC_DWORD_STAT_BY(STAT_BFObjectPool_Evictions, Num);
+				CSV_CUSTOM_STAT(BFObjectPool, Evictions, Num, ECsvCustomStatOp::Accumulate);
+				break;
+			case EBFObjectPoolStat::Overflow:
+				INC_DWORD_STAT_BY(STAT_BFObjectPool_Overflows, Num);
+				CSV_CUSTOM_STAT(BFObjectPool, Overflows, Num, ECsvCustomStatOp::Accumulate);
+				break;
+			case EBFObjectPoolStat::Num: break;
+		}
+	}
+
+
+	void AddObjectCounts(int32 NumPooled, int32 NumInactive)
+	{
+		NumPooledObjects += NumPooled;
+		NumInactiveObjects += NumInactive;
+	}
+
+
+	static void PublishFrame()
+	{
+		const int32 NumActiveObjects = NumPooledObjects - NumInactiveObjects;
+		SET_DWORD_STAT(STAT_BFObjectPool_ActiveObjects, NumActiveObjects);
+		SET_DWORD_STAT(STAT_BFObjectPool_InactiveObjects, NumInactiveObjects);
+		CSV_CUSTOM_STAT(BFObjectPool, ActiveObjects, NumActiveObjects, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(BFObjectPool, InactiveObjects, NumInactiveObjects, ECsvCustomStatOp::Set);
+
+		TRACE_COUNTER_SET(BFObjectPool_ActiveObjects, NumActiveObjects);
+		TRACE_COUNTER_SET(BFObjectPool_InactiveObjects, NumInactiveObjects);
+		TRACE_COUNTER_SET(BFObjectPool_UnpoolHits, FrameCounts[static_cast<int32>(EBFObjectPoolStat::UnpoolHit)]);
+		TRACE_COUNTER_SET(BFObjectPool_Misses, FrameCounts[static_cast<int32>(EBFObjectPoolStat::Miss)]);
+		TRACE_COUNTER_SET(BFObjectPool_LazyCreations, FrameCounts[static_cast<int32>(EBFObjectPoolStat::LazyCreation)]);
+		TRACE_COUNTER_SET(BFObjectPool_CooldownRejections, FrameCounts[static_cast<int32>(EBFObjectPoolStat::CooldownRejection)]);
+		TRACE_COUNTER_SET(BFObjectPool_Evictions, FrameCounts[static_cast<int32>(EBFObjectPoolStat::Eviction)]);
+		TRACE_COUNTER_SET(BFObjectPool_Overflows, FrameCounts[static_cast<int32>(EBFObjectPoolStat::Overflow)]);
+
+		FMemory::Memzero(FrameCounts);
+	}
+
+
+	void Startup()
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&PublishFrame);
+	}
+
+
+	void Shutdown()
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+}
@@ -0,0 +1,85 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+
+/* Always available pool telemetry, `stat BFObjectPool` in game, the BFObjectPool CSV category (csvprofile start) and BFObjectPool/ counters in Unreal Insights.
+ * Events are counted per frame across every pool, active/inactive are totals across every pool. TBFObjectPool::GetPoolStats() has the same counters for a single pool. */
+DECLARE_STATS_GROUP(TEXT("BFObjectPool"), STATGROUP_BFObjectPool, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Unpool Object"), STAT_BFObjectPool_UnpoolObject, STATGROUP_BFObjectPool, BFOBJECTPOOLING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Activate Object"), STAT_BFObjectPool_ActivateObject, STATGROUP_BFObjectPool, BFOBJECTPOOLING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deactivate Object"), STAT_BFObjectPool_DeactivateObject, STATGROUP_BFObjectPool, BFOBJECTPOOLING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Pool Entry"), STAT_BFObjectPool_CreatePoolEntry, STATGROUP_BFObjectPool, BFOBJECTPOOLING_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(BFOBJECTPOOLING_API, BFObjectPool);
+
+// `stat LLM` / `stat LLMFULL` and LLM csv/trace, covers pool containers and their slots, handles and every pooled object created (prewarmed or lazily).
+LLM_DECLARE_TAG_API(BFObjectPool, BFOBJECTPOOLING_API);
+
+
+enum class EBFObjectPoolStat : uint8
+{
+	UnpoolHit,
+	Miss, // Un-pool got nothing back because the pool was at capacity.
+	LazyCreation, // An object had to be created mid gameplay to satisfy an un-pool, rather than up front or by a prewarm.
+	CooldownRejection, // Inactive objects were there but none were off cooldown.
+	Eviction, // Inactive object destroyed by occupancy eviction, adaptive trimming, a shared pool budget or trimming temporary overflow objects.
+	Overflow, // Un-pool at capacity served by the pools EBFPoolOverflowPolicy (an active object recycled or a temporary object created) instead of missing.
+	Num
+};
+
+
+// Estimated bytes a pool holds, see TBFObjectPool::GetPoolMemoryFootprint and the BF.OP.DumpPoolMemory command.
+struct FBFObjectPoolMemoryFootprint
+{
+	int64 ActiveBytes = 0;
+	int64 InactiveBytes = 0; // What the pool holds idle, the most an eviction/trim could give back.
+	int32 NumActive = 0;
+	int32 NumInactive = 0;
+
+	int64 GetTotalBytes() const { return ActiveBytes + InactiveBytes; }
+};
+
+
+// Counters for a single pool, see TBFObjectPool::GetPoolStats.
+struct FBFObjectPoolStats
+{
+	uint32 NumUnpoolHits = 0;
+	uint32 NumMisses = 0;
+	uint32 NumLazyCreations = 0;
+	uint32 NumCooldownRejections = 0;
+	uint32 NumEvictions = 0;
+	uint32 NumOverflows = 0;
+
+	void Add(EBFObjectPoolStat Stat, int32 Num)
+	{
+		switch(Stat)
+		{
+			case EBFObjectPoolStat::UnpoolHit: NumUnpoolHits += Num; break;
+			case EBFObjectPoolStat::Miss: NumMisses += Num; break;
+			case EBFObjectPoolStat::LazyCreation: NumLazyCreations += Num; break;
+			case EBFObjectPoolStat::CooldownRejection: NumCooldownRejections += Num; break;
+			case EBFObjectPoolStat::Eviction: NumEvictions += Num; break;
+			case EBFObjectPoolStat::Overflow: NumOverflows += Num; break;
+			case EBFObjectPoolStat::Num: break;
+		}
+	}
+};
+
+
+namespace BF::OP::Stats
+{
+	// Adds to this frames global counters, game thread only. Kept out of line so the templated pools don't need the trace counters exported.
+	BFOBJECTPOOLING_API void RecordGlobal(EBFObjectPoolStat Stat, int32 Num);
+	// Pooled/inactive totals across every pool, kept up to date by UBFPoolContainer.
+	BFOBJECTPOOLING_API void AddObjectCounts(int32 NumPooled, int32 NumInactive);
+
+	// Registered by the module, publishes the frames counters and totals at the end of every frame.
+	void Startup();
+	void Shutdown();
+}
@@ -2,6 +2,13 @@
 // Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
 
 #include "BFObjectPooling.h"
+#include "BFObjectPoolStats.h"
+#include "BFObjectPooling/Pool/BFObjectPoolSizingProfiles.h"
+#include "BFObjectPooling/Pool/Private/BFPoolContainer.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/StructuredLog.h"
+#include "UObject/UObjectIterator.h"
 
 
 namespace BF::OP
@@ -15,6 +22,104 @@ namespace BF::OP
 		false,
 		TEXT("Good for catching some early warnings or knowing if you are hitting pool capacity."),
 		ECVF_Cheat);
+
+	TAutoConsoleVariable<int32> CVarObjectPoolGlobalObjectBudget(TEXT("BF.OP.GlobalObjectBudget"),
+		-1,
+		TEXT("Max pooled objects across every shared pool in a world (UBFObjectPoolSubsystem), inactive objects are evicted from the least recently used pools when over. Less than 0 for no budget."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarObjectPoolGlobalMemoryBudgetMB(TEXT("BF.OP.GlobalMemoryBudgetMB"),
+		-1.f,
+		TEXT("Estimated megabytes of pooled objects allowed across every shared pool in a world (UBFObjectPoolSubsystem), see BF.OP.GlobalObjectBudget. Less than 0 for no budget."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarProjectileSimulationMinParallelBatch(TEXT("BF.OP.ProjectileSimulation.MinParallelBatch"),
+		64,
+		TEXT("Batched projectile simulation (UBFProjectileSimulationSubsystem) runs single threaded below this many projectiles, the ParallelFor overhead isn't worth it for a handful."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<bool> CVarProjectileSimulationParallelSweeps(TEXT("BF.OP.ProjectileSimulation.ParallelSweeps"),
+		true,
+		TEXT("If enabled the batched projectile simulation sweeps inside its ParallelFor (scene queries only take the physics read lock), otherwise the sweeps run on the game thread after integrating."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarObjectPoolCurfewResolution(TEXT("BF.OP.CurfewResolution"),
+		0.02f,
+		TEXT("Seconds per bucket of a pools curfew wheel, curfews expire up to this late and every curfew in a bucket is handled together. Picked up the next time a pools wheel is empty."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarWidgetAnimationCurveSamples(TEXT("BF.OP.WidgetAnimation.CurveSamples"),
+		64,
+		TEXT("Samples baked per UCurveVector4 driving pooled 3D widget animations (lerped between at runtime), below 2 evaluates the curves directly every frame instead."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarSoundAudibleDistanceScale(TEXT("BF.OP.Sound.AudibleDistanceScale"),
+		1.1f,
+		TEXT("Scales the attenuation range ABFPoolableSoundActor::WouldSoundBeAudible (bSkipIfInaudible) tests listeners against, above 1 leaves room for listeners moving in while a short sound plays."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarObjectPoolGCClusterRebuildDelay(TEXT("BF.OP.GCClusterRebuildDelay"),
+		2.f,
+		TEXT("Seconds a bGCCluster pools membership has to stay unchanged (no objects created, evicted or stolen) before its GC cluster is rebuilt, so eviction/growth churn doesn't rebuild every frame."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<bool> CVarObjectPoolRecordSizingProfiles(TEXT("BF.OP.RecordSizingProfiles"),
+		false,
+		TEXT("Pools initialized while enabled record their peak active count, misses and time to peak, saved into UBFObjectPoolSizingProfiles when their world is cleaned up (or with BF.OP.SaveSizingProfiles)."),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorld CmdObjectPoolSaveSizingProfiles(TEXT("BF.OP.SaveSizingProfiles"),
+		TEXT("Merges what every recording pool in this world has seen so far into the sizing profiles and saves them, without waiting for the world to be cleaned up."),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&UBFObjectPoolSizingProfiles::RecordWorld));
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdObjectPoolDumpPoolMemory(TEXT("BF.OP.DumpPoolMemory"),
+		TEXT("Logs the estimated memory of every pool in this world sorted by the bytes held idle (inactive objects), see TBFObjectPool::GetPoolMemoryFootprint. Args: [MinIdleKB=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const int64 MinIdleBytes = Args.Num() > 0 ? static_cast<int64>(FCString::Atof(*Args[0]) * 1024.0) : 0;
+
+			TArray<TPair<const UBFPoolContainer*, FBFObjectPoolMemoryFootprint>> Pools;
+			FBFObjectPoolMemoryFootprint Total;
+			for(TObjectIterator<UBFPoolContainer> It; It; ++It)
+			{
+				if(!IsValid(*It) || It->GetOwningWorld() != World || It->GetNumPooledObjects() == 0)
+					continue;
+
+				const FBFObjectPoolMemoryFootprint Footprint = It->GetMemoryFootprint();
+				Total.ActiveBytes += Footprint.ActiveBytes;
+				Total.InactiveBytes += Footprint.InactiveBytes;
+				Total.NumActive += Footprint.NumActive;
+				Total.NumInactive += Footprint.NumInactive;
+				if(Footprint.InactiveBytes >= MinIdleBytes)
+					Pools.Emplace(*It, Footprint);
+			}
+
+			Pools.Sort([](const auto& A, const auto& B) { return A.Value.InactiveBytes > B.Value.InactiveBytes; });
+			UE_LOGFMT(LogTemp, Display, "[BFObjectPool] {0} pools hold {1} KB idle across {2} inactive objects, {3} KB in {4} active objects.",
+				Pools.Num(), Total.InactiveBytes / 1024, Total.NumInactive, Total.ActiveBytes / 1024, Total.NumActive);
+			for(const auto& [Container, Footprint] : Pools)
+			{
+				UE_LOGFMT(LogTemp, Display, "[BFObjectPool]    {0} (owner {1}): idle {2} KB ({3} objects), active {4} KB ({5} objects).",
+					GetNameSafe(Container->TryGetPoolType()), GetNameSafe(Container->GetOuter()), Footprint.InactiveBytes / 1024, Footprint.NumInactive, Footprint.ActiveBytes / 1024, Footprint.NumActive);
+			}
+		}));
+}
+
+
+void FBFObjectPoolingModule::StartupModule()
+{
+	BF::OP::Stats::Startup();
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld* World, bool, bool)
+	{
+		UBFObjectPoolSizingProfiles::RecordWorld(World);
+	});
+}
+
+
+void FBFObjectPoolingModule::ShutdownModule()
+{
+	BF::OP::Stats::Shutdown();
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
 }
 
     
@@ -10,10 +10,24 @@ namespace BF::OP
 {
     BFOBJECTPOOLING_API extern TAutoConsoleVariable<bool> CVarObjectPoolPrintPoolOccupancy;    
     BFOBJECTPOOLING_API extern TAutoConsoleVariable<bool> CVarObjectPoolEnableLogging;    
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<int32> CVarObjectPoolGlobalObjectBudget;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<float> CVarObjectPoolGlobalMemoryBudgetMB;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<int32> CVarProjectileSimulationMinParallelBatch;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<bool> CVarProjectileSimulationParallelSweeps;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<float> CVarObjectPoolCurfewResolution;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<int32> CVarWidgetAnimationCurveSamples;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<float> CVarSoundAudibleDistanceScale;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<float> CVarObjectPoolGCClusterRebuildDelay;
+    BFOBJECTPOOLING_API extern TAutoConsoleVariable<bool> CVarObjectPoolRecordSizingProfiles;
 }
 
 
 class FBFObjectPoolingModule : public IModuleInterface
 {
-    
+public:
+    virtual void StartupModule() override;
+    virtual void ShutdownModule() override;
+
+private:
+    FDelegateHandle WorldCleanupHandle; // Saves recorded sizing profiles, see UBFObjectPoolSizingProfiles.
 };
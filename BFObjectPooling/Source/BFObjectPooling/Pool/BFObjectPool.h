@@ -4,12 +4,23 @@
 #pragma once
 #include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
 #include "BFObjectPooling/Pool/Private/BFPoolContainer.h"
+#include "BFObjectPooling/Pool/Private/BFConcurrentPoolState.h"
 #include "BFObjectPooling/Interfaces/BFPooledObjectInterface.h" 
 #include "BFObjectPooling/Module/BFObjectPooling.h"
+#include "BFObjectPooling/Module/BFObjectPoolStats.h"
 #include "BFPooledObjectHandle.h"
+#include "BFPooledObjectLiteHandle.h"
+#include "BFObjectPoolSizingProfiles.h"
 #include "GameplayTags.h"
 #include "Blueprint/UserWidget.h"
+#include "Components/InvalidationBox.h"
+#include "Components/PanelWidget.h"
+#include "Components/RetainerBox.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Async/Async.h"
 #include "BFObjectPool.generated.h"
 
 struct FBFPooledObjectInfo;
@@ -53,6 +64,7 @@ using TBFObjectPoolPtr = TSharedPtr<TBFObjectPool<T, Mode>, Mode>;
  * The pool is designed to be able to regularly query the inactive objects and remove them if they exceed the specified MaxObjectInactiveOccupancySeconds in the pool init function.
  * If you do not want this behaviour, you can leave ticking disabled on the pool. You also can optionally set the tick interval to a higher value to reduce the overhead of checking the pools occupancy.
  * NOTE: The pools debug console variables `BF.OP.PrintPoolOccupancy 1` and `BF.OP.EnableLogging 1` can help when debugging issues, the `PrintPoolOccupancy` requires your pool to enable ticking otherwise it will not log the pools occupancy.
+ * For always available telemetry (shipping included) use `stat BFObjectPool`, the BFObjectPool CSV category or the BFObjectPool/ trace counters in Insights, MyPool->GetPoolStats() for a single pool.
  *
  *
  * Increasing the object pool limit is possible, however, decreasing it is only possible if there are enough inactive objects to remove to reach the new limit.
@@ -102,10 +114,18 @@ using TBFObjectPoolPtr = TSharedPtr<TBFObjectPool<T, Mode>, Mode>;
  * MyPool->UnpoolObject(bAutoActivate); // Attempts to un-pool an object and return it via a shared handle ptr, the result will return a null pointer if unable to un-pool an object due to pool being at capacity and all objects in use.
  * MyPool->UnpoolObjectByTag(Tag, bAutoActivate); // Only super useful if you have a pool of specific objects you want to re access, for example you can have a UUserWidget pool and each widget be different and when wanting a specific widget
  *													 // you can query the pool for that tag, returns false if unable to locate within the inactive pool of objects.
+ * MyPool->UnpoolObjects(Num, OutHandles, bAutoActivate); // Batch un-pool for bursts, appends up to Num handles and returns how many it managed. One creation pass and one OnObjectsPooledBatch broadcast.
+ * MyPool->InitPoolAsync(Params); // Streams SoftPoolClass + AssetsToPreload in first, bind GetOnPoolReady() to know when the pool can be used.
+ * UBFObjectPoolSubsystem::Get(this)->GetSharedPool<AMyFoo>(Params); // One world wide pool per class (+ optional key) instead of one per owner, ticked and budgeted by the subsystem.
+ * Params.AdaptiveSizing.bEnabled = true; // Sizes the pool from measured demand (peak active + headroom, limit grows on misses up to MaxPoolLimit), MyPool->GetDemandStats() for the window.
+ * MyPool->Reserve(Num, DeadlineSeconds); // Time sliced creation so Num inactive objects are ready by the deadline, bTimeSlicedPrewarm in the init params does the same for InitialCount.
+ * MyThreadSafePool->UnpoolObjectConcurrent(bAutoActivate); // Any thread, ESPMode::ThreadSafe object pools with Params.ConcurrentReserve > 0. Returns a lite handle that can be returned from any thread too.
  *
  * 
  * MyPool->ReturnToPool(Handle); // Attempts to return the handle to the pool, can fail if the handle is stale but failing is perfectly valid and expected, especially if multiple handle copies exist.
  * Handle->ReturnToPool(); // Returns the object to the pool via the handle, (Typically for fire and forget pooled objects otherwise you would be holding onto the handle yourself).
+ * MyPool->ReturnToPool(MakeArrayView(Handles)); // Batch return, releases every handle and returns the number that were still valid.
+ * Params.bDeferReturns = true; // Returns only invalidate the handle and queue the object, deactivation happens in one batch on the next upkeep tick.
  *
  * 
  * MyPool->ClearInactiveObjectsPool(); // Clears the pool of all inactive objects. We do not clear in use ones.
@@ -126,6 +146,11 @@ using TBFObjectPoolPtr = TSharedPtr<TBFObjectPool<T, Mode>, Mode>;
  * Handle->GetObject(); // This returns the object that the handle is holding, this is what you'll want to use to get the object but do not store it.
  * Handle->ReturnToPool(); // This returns the object to the pool and invalidates the handle, if there are multiple handles to the same object they will all be invalidated.
  * Handle->StealObject(); // This simultaneously removes the pooled object from its owning pool, returns it and invalidates all handles to that object.
+ *
+ *
+ * For hot paths there is also an allocation free value handle, see BFPooledObjectLiteHandle.h. It is NOT returned automatically when copies go out of scope (unless wrapped in TBFUniquePooledObjectLiteHandle).
+ * TBFPooledObjectLiteHandle<AMyFoo> LiteHandle = MyPool->UnpoolObjectLite(bAutoActivate);
+ * LiteHandle.ReturnToPool(); // or MyPool->ReturnToPool(LiteHandle);
  */
 
 
@@ -146,6 +171,56 @@ enum class EBFPoolType : uint8
 };
 
 
+// Instance backends for UBFInstancedStaticMeshPool, where the pooled "objects" are instances in a per mesh component instead of actors.
+UENUM(BlueprintType)
+enum class EBFInstancedPoolType : uint8
+{
+	// One UInstancedStaticMeshComponent per mesh, cheapest to update which suits debris that is moved/recycled a lot.
+	InstancedStaticMesh,
+	// One UHierarchicalInstancedStaticMeshComponent per mesh, adds per cluster culling and LOD at the cost of rebuilding its tree as instances change.
+	HierarchicalInstancedStaticMesh
+};
+
+
+// How much of an inactive actor/components engine state is torn down while it sits in the pool, see FBFObjectPoolInitParams::Dormancy.
+UENUM(BlueprintType)
+enum class EBFPoolDormancy : uint8
+{
+	// Default behaviour, hidden with tick and collision disabled but everything stays registered. Un-pooling is as cheap as it gets.
+	Awake,
+	// Also destroys the physics state (bodies, overlaps) of every component, rebuilt on un-pool. Components keep their scene proxies and stay registered.
+	Physics,
+	// Unregisters every component, no scene proxies, physics bodies, component ticks or transform updates while inactive. Re-registering on un-pool is the most expensive option.
+	Unregistered
+};
+
+
+// What an un-pool does when every object is checked out and the pool is at PoolLimit, see FBFObjectPoolInitParams::OverflowPolicy.
+UENUM(BlueprintType)
+enum class EBFPoolOverflowPolicy : uint8
+{
+	// Default behaviour, the un-pool returns an invalid handle and records a capacity miss.
+	Fail,
+	// Force returns the object that has been checked out the longest and hands it out again, its handles are invalidated like any other return.
+	RecycleOldest,
+	// Force returns the active object with the lowest recycle priority (see SetRecyclePriority on the handles), the oldest checkout wins ties.
+	RecycleLowestPriority,
+	// Creates an object past PoolLimit (up to MaxTemporaryObjects), the pool trims back down to its limit as those objects are returned.
+	GrowTemporarily
+};
+
+
+// What a virtualized widget pool wraps each widget in, see FBFObjectPoolInitParams::bVirtualizeWidgets.
+UENUM(BlueprintType)
+enum class EBFPooledWidgetWrapper : uint8
+{
+	None,
+	// Caches the widgets draw elements while nothing inside it is invalidated, cheap for HUD elements that rarely change once shown.
+	InvalidationBox,
+	// Renders the widget to a render target (optionally at a reduced phase/rate), for elements that change often but don't need updating every frame.
+	RetainerBox
+};
+
 
 // Each pool can optionally tick, defines params related to that.
 USTRUCT(Blueprintable)
@@ -162,6 +237,19 @@ public:
 	UPROPERTY(Transient, BlueprintReadWrite)
 	float MaxObjectInactiveOccupancySeconds = -1.f;
 
+	/* Destroying lots of expired objects at once is a hitch, each tick only destroys up to this many and the rest carry on over the following frames.
+	 * Less than or equal to 0 for no count limit. */
+	UPROPERTY(Transient, BlueprintReadWrite)
+	int32 MaxEvictionsPerTick = -1;
+
+	// Same as MaxEvictionsPerTick but as wall clock milliseconds spent destroying per frame, at least one object is always destroyed. Less than or equal to 0 for no time limit.
+	UPROPERTY(Transient, BlueprintReadWrite)
+	float EvictionBudgetMs = 0.5f;
+
+	// Tick group of the every frame upkeep tick (time sliced prewarm/eviction, deferred returns). Shared pools always run theirs in the subsystems tick.
+	UPROPERTY(Transient, BlueprintReadWrite)
+	TEnumAsByte<ETickingGroup> UpkeepTickGroup = TG_PrePhysics;
+
 	// If you aren't wanting periodic clearing of inactive objects, you can just leave it disabled.
 	UPROPERTY(Transient, BlueprintReadWrite)
 	bool bEnableTicking = false;
@@ -169,6 +257,48 @@ public:
 
 
 
+// Optional demand driven sizing, the pool measures its demand over a sliding window and sizes itself around it. See TBFObjectPool::EvaluateAdaptiveSizing.
+USTRUCT(BlueprintType)
+struct FBFObjectPoolAdaptiveSizingParams
+{
+	GENERATED_BODY()
+public:
+	/* If enabled the pool ticks (at PoolTickInfo.TickInterval, ticking is forced on) keeping Headroom extra objects ready on top of the windows peak active count,
+	 * creating them time sliced ahead of demand and trimming back down after sustained low use. Never shrinks below InitialCount. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bEnabled : 1 = false;
+
+	// Hard ceiling, capacity misses (un-pooling at the limit) raise PoolLimit up to this. At or below PoolLimit means the limit never grows.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bEnabled"))
+	int32 MaxPoolLimit = 0;
+
+	// Length of the sliding window demand is measured over.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bEnabled", ClampMin="0.1"))
+	float WindowSeconds = 10.f;
+
+	// Fraction of the windows peak active count kept inactive and ready, with 0.25 a peak of 40 active objects sizes the pool to 50.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bEnabled", ClampMin="0.0"))
+	float Headroom = 0.25f;
+
+	// How long the pool has to be bigger than demand needs before it starts trimming.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bEnabled", ClampMin="0.0"))
+	float ShrinkDelaySeconds = 30.f;
+
+	// Max inactive objects destroyed per evaluation while shrinking, keeps trimming gradual and hitch free.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bEnabled", ClampMin="1"))
+	int32 MaxShrinkPerEvaluation = 2;
+};
+
+
+// Demand seen by a pool over its adaptive sizing window (or one slice of it).
+struct FBFObjectPoolDemandStats
+{
+	int32 NumUnpools = 0;
+	int32 NumMisses = 0; // Un-pool requests that got nothing back because the pool was at capacity.
+	int32 PeakActive = 0;
+};
+
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FActivatePooledObjectOverride, UObject*, Obj);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FDeactivatePooledObjectOverride, UObject*, Obj);
 // Every pool must be initialized with this struct, it contains all the necessary information to create and manage the pool.
@@ -183,12 +313,35 @@ public:
 		DeactivateObjectOverride.Clear();
 		Owner = nullptr;
 		PoolClass = nullptr;
+		SoftPoolClass.Reset();
+		AssetsToPreload.Reset();
 		PoolType = EBFPoolType::Invalid;
 		PoolLimit = 50;
 		InitialCount = 0;
 		CooldownTimeSeconds = -1.f;
+		OverflowPolicy = EBFPoolOverflowPolicy::Fail;
+		MaxTemporaryObjects = 0;
 		PoolTickInfo = FBFObjectPoolInitTickParams();
 		bDisableActivationDeactivationLogic = false;
+		bTimeSlicedPrewarm = false;
+		bNetworked = false;
+		bVirtualizeWidgets = false;
+		bGCCluster = false;
+		bUseSizingProfile = false;
+		bPersistAcrossTravel = false;
+		bWarmupAssets = false;
+		bWarmupActivation = false;
+		bDeferReturns = false;
+		PrewarmBudgetMs = 1.f;
+		AdaptiveSizing = FBFObjectPoolAdaptiveSizingParams();
+		Dormancy = EBFPoolDormancy::Awake;
+		DormancyDelaySeconds = 2.f;
+		DormancyAwakeReserve = 0;
+		DormancyBudgetMs = 0.5f;
+		WidgetParent.Reset();
+		WidgetZOrder = 0;
+		WidgetWrapper = EBFPooledWidgetWrapper::None;
+		ConcurrentReserve = 0;
 		ObjectFlags = RF_NoFlags;
 	}
 	
@@ -216,6 +369,16 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	UClass* PoolClass = nullptr;
 
+	/* Soft alternative to PoolClass so declaring the pool doesn't force load the class, only used when PoolClass is not set.
+	 * InitPoolAsync streams it in before creating the pool, InitPool loads it synchronously. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	TSoftClassPtr<UObject> SoftPoolClass;
+
+	/* Content the pooled objects will use (meshes, systems, sounds, presets...), InitPoolAsync streams these in alongside SoftPoolClass and InitPool loads them synchronously,
+	 * either way the pool keeps them loaded for as long as it lives. The built in descriptions and presets can fill this via their AppendAssetsToPreload. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	TArray<TSoftObjectPtr<UObject>> AssetsToPreload;
+
 	/* Pool type defines Activation/Deactivation logic as well as how new objects are created. This is important to not mix up, for example if you used a PoolableSoundActor it would be easy
 	 * to accidentally set it to a component because its main use is the USoundComponent, same with a poolable Niagara actor and its UNiagaraComponent but that would result in the wrong behaviour since
 	 * the pool type defines how the objects are created as well as how they are treated when activating and deactivating.
@@ -235,6 +398,15 @@ public:
 	 * (I've noticed ribbon VFX if being pooled and reused too quickly can cause the ribbon trail to span from its last position, it's just a nice option to have.)*/
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	float CooldownTimeSeconds = -1.f;
+
+	/* What to do when an un-pool finds every object in use and the pool at PoolLimit. The recycling policies keep checked out objects in checkout order so picking the
+	 * oldest is O(1), the lowest priority pick walks the active objects from the oldest and stops at the first priority 0 one. Not supported on pools used from worker threads. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	EBFPoolOverflowPolicy OverflowPolicy = EBFPoolOverflowPolicy::Fail;
+
+	// GrowTemporarily only, how many objects the pool may create past PoolLimit. Less than or equal to 0 for no limit.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="OverflowPolicy == EBFPoolOverflowPolicy::GrowTemporarily"))
+	int32 MaxTemporaryObjects = 0;
 	
 	/* Defines the tick behaviour of the pool, ticking can ignored and it will be disabled by default.
 	 * If disabled you lose the ability to clear out inactive objects that exceed the MaxObjectInactiveOccupancySeconds,
@@ -247,6 +419,103 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	uint8 bDisableActivationDeactivationLogic : 1 = false;
 
+	/* If true the InitialCount objects are not created inside InitPool but spread over the following frames (see TBFObjectPool::Reserve), this avoids the
+	 * BeginPlay hitch of large pools. Un-pooling before the prewarm finishes is still fine, a starved pool just creates an object synchronously like it always has. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bTimeSlicedPrewarm : 1 = false;
+
+	/* Actor pools of replicated actors, server side. Inactive actors are put into net dormancy (DORM_DormantAll) once their hidden state has gone out so they stop
+	 * being considered for replication at all, un-pooling wakes them and forces a net update so the activation goes out in the same frame. Recycled actors keep their
+	 * dormant channel and NetGUID on every client, so clients don't need a pool of their own, their copy of each actor is hidden/shown by the replicated state.
+	 * Occupancy eviction and adaptive shrinking never destroy objects of networked pools since that would close their channels, RemoveInactive* still does if asked. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bNetworked : 1 = false;
+
+	/* UserWidget pools only, instead of adding every widget to the viewport and collapsing it while inactive, inactive widgets are detached from any parent so idle widgets
+	 * cost no prepass or invalidation traversal. Un-pooling attaches the widget (or its WidgetWrapper) to the panel given to UnpoolWidget, else WidgetParent, else the viewport
+	 * at WidgetZOrder, attaching/detaching happens even with bAutoActivate false or bDisableActivationDeactivationLogic. The pool keeps each widgets Slate widget alive
+	 * while detached so attaching again reuses it instead of rebuilding it. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="PoolType == EBFPoolType::UserWidget"))
+	uint8 bVirtualizeWidgets : 1 = false;
+
+	/* Puts the pooled objects, and their subobjects where possible, into a GC cluster rooted at the pools container so reachability marks the pool as one instead of
+	 * traversing every object, only classes that allow it (CanBeInCluster) join. GC doesn't see references a clustered object picks up later, so only use this for
+	 * objects that don't hold the last reference to anything they are given at runtime (AssetsToPreload are kept loaded by the pool). Rebuilt once membership settles.
+	 * Object pools only, ignored for actor/component/widget pools: the engine keeps actors out of clusters unless they opt in and their components and widgets are
+	 * owned by outers the pool doesn't control, so a cluster would hold little more than the container. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bGCCluster : 1 = false;
+
+	/* If a sizing profile was recorded for this owner class + pool class on the current map (see UBFObjectPoolSizingProfiles), InitialCount becomes its peak active count
+	 * and PoolLimit grows to cover its misses, the values set here are the fallback for maps without one. Time sliced prewarms also aim to finish before the recorded peak. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bUseSizingProfile : 1 = false;
+
+	/* Actor and object shared pools (UBFObjectPoolSubsystem::GetSharedPool) only, instead of dying with the world the pool is parked on the game instance and handed to
+	 * the next world that asks for it, keeping every object that survived the travel and only rebuilding the rest (see TBFObjectPool::MigrateToOwner). Plain objects always
+	 * survive, actors only with seamless travel and UBFObjectPoolSubsystem::AddSeamlessTravelActors in your game modes GetSeamlessTravelActorList. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bPersistAcrossTravel : 1 = false;
+
+	/* If true the loaded AssetsToPreload (Niagara systems, meshes and materials) have their PSOs precached during the prewarm, before any objects are created, so the first
+	 * real activation that assigns them doesn't hitch on a PSO/shader compile. Time sliced within PrewarmBudgetMs when bTimeSlicedPrewarm is set, otherwise done inside InitPool. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bWarmupAssets : 1 = false;
+
+	// bWarmupAssets only, also activates each Niagara system once on a hidden component (destroyed the frame after) so its renderers and GPU simulation are created up front.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bWarmupAssets"))
+	uint8 bWarmupActivation : 1 = false;
+
+	/* If true returning an object (including the last handle going out of scope) only invalidates its handles and queues it, deactivation, re-insertion and delegates
+	 * happen for every queued object in one batch on the next upkeep tick (PoolTickInfo.UpkeepTickGroup) followed by a single OnObjectsPooledBatch broadcast.
+	 * Handy when handles are dropped inside physics/hit callbacks, queued objects can't be un-pooled again until they are processed.
+	 * ESPMode::ThreadSafe pools with this set can drop/return handles from any thread, like ConcurrentReserve that reserves the slot array at init so PoolLimit can't grow
+	 * past its initial value (or AdaptiveSizing.MaxPoolLimit). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	uint8 bDeferReturns : 1 = false;
+
+	// Wall clock milliseconds per frame the pool may spend creating objects for a prewarm/Reserve. At least one object is always created per frame.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(ClampMin="0.0"))
+	float PrewarmBudgetMs = 1.f;
+
+	// Lets the pool grow and shrink itself from measured demand instead of relying on InitialCount/PoolLimit guesses.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	FBFObjectPoolAdaptiveSizingParams AdaptiveSizing;
+
+	/* Actor and Component pools only, trades un-pool latency for idle cost. Objects go dormant on the upkeep tick within DormancyBudgetMs once they have been
+	 * inactive for DormancyDelaySeconds and are woken synchronously when un-pooled, unless they are part of the DormancyAwakeReserve which is kept awake ahead of time. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
+	EBFPoolDormancy Dormancy = EBFPoolDormancy::Awake;
+
+	// Seconds an object has to sit inactive before going dormant, objects recycled quicker than this never pay for sleeping/waking.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="Dormancy != EBFPoolDormancy::Awake", ClampMin="0.0"))
+	float DormancyDelaySeconds = 2.f;
+
+	/* How many of the newest inactive objects (the ones UnpoolObject hands out first without a cooldown) are kept awake. Un-pooling into the reserve wakes
+	 * dormant objects behind it on the following upkeep ticks, so steady un-pooling rarely has to wake anything itself. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="Dormancy != EBFPoolDormancy::Awake", ClampMin="0"))
+	int32 DormancyAwakeReserve = 0;
+
+	// Wall clock milliseconds per frame spent putting objects to sleep or waking the reserve. At least one object is always processed per frame.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="Dormancy != EBFPoolDormancy::Awake", ClampMin="0.0"))
+	float DormancyBudgetMs = 0.5f;
+
+	// bVirtualizeWidgets only, where un-pooled widgets are attached when UnpoolWidget isn't given a panel. Left unset they go to the viewport.
+	UPROPERTY(BlueprintReadWrite, meta=(EditCondition="bVirtualizeWidgets"))
+	TWeakObjectPtr<UPanelWidget> WidgetParent;
+
+	// bVirtualizeWidgets only, viewport Z order of widgets attached to the viewport.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bVirtualizeWidgets"))
+	int32 WidgetZOrder = 0;
+
+	// bVirtualizeWidgets only, each widget is created inside one of these and the wrapper is what gets attached.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, meta=(EditCondition="bVirtualizeWidgets"))
+	EBFPooledWidgetWrapper WidgetWrapper = EBFPooledWidgetWrapper::None;
+
+	/* ESPMode::ThreadSafe Object pools only, how many inactive objects the game thread keeps handed over for worker threads to un-pool via UnpoolObjectConcurrent.
+	 * Left at 0 the pool is game thread only like any other, see TBFObjectPool::UnpoolObjectConcurrent. */
+	int32 ConcurrentReserve = 0;
+
 	/* Flags for each new spawned object in the pool, If left to default then we will apply the flag RF_Transient and remove the default flag of RF_Transactional
 	 * (which makes spawning a lot cheaper and pooled objects should be transient anyway)
 	 * otherwise just add your own flags and no default flags will be applied.  */
@@ -254,12 +523,57 @@ public:
 };
 
 
+// Type erased view of a pool so non templated code (UBFObjectPoolSubsystem) can tick, measure and trim pools of any type.
+struct FBFObjectPoolBase
+{
+	virtual ~FBFObjectPoolBase() = default;
+	
+	virtual int32 GetPoolSize() const = 0;
+	virtual int32 GetInactivePoolSize() const = 0;
+	virtual const FBFObjectPoolInitParams& GetPoolInitInfo() const = 0;
+	virtual bool RemoveInactiveNumFromPool(int64 NumToRemove) = 0;
+	virtual bool ClearInactiveObjectsPool() = 0;
+	// Rough size of one pooled object (see UBFPoolContainer::GetObjectMemoryBytes, actors include their components), 0 if there is nothing to sample yet.
+	virtual int64 EstimateObjectSizeBytes() = 0;
+	// Measures every pooled object rather than sampling one, split by active/inactive. Not meant for every frame.
+	virtual FBFObjectPoolMemoryFootprint GetPoolMemoryFootprint() const = 0;
+	// Only for externally ticked pools, runs the upkeep and interval tick the containers own tick functions would have.
+	virtual void TickExternal(float Dt) = 0;
+	// See TBFObjectPool::MigrateToOwner and ParkUnder.
+	virtual int32 MigrateToOwner(UObject* NewOwner) = 0;
+	virtual void ParkUnder(UObject* NewOwner) = 0;
+	virtual void AppendInactiveObjects(TArray<UObject*>& OutObjects) const = 0;
+	
+	// Bumped on every checkout, lets whoever manages the pool tell if it was used since it last looked without the pool reading the clock.
+	uint32 GetNumCheckouts() const { return NumCheckouts; }
+	bool IsExternallyTicked() const { return bExternallyTicked; }
+
+	// Counters since the pool was created (or ResetPoolStats), every event recorded here also feeds the global `stat BFObjectPool`, CSV and trace counters.
+	const FBFObjectPoolStats& GetPoolStats() const { return PoolStats; }
+	void ResetPoolStats() { PoolStats = FBFObjectPoolStats(); }
+	void RecordPoolStat(EBFObjectPoolStat Stat, int32 Num = 1)
+	{
+		PoolStats.Add(Stat, Num);
+		BF::OP::Stats::RecordGlobal(Stat, Num);
+	}
+	
+protected:
+	FBFObjectPoolStats PoolStats;
+	uint32 NumCheckouts = 0;
+	uint8 bExternallyTicked : 1 = false;
+};
+
+
 template<typename T, ESPMode Mode = ESPMode::NotThreadSafe> requires BF::OP::CIs_UObject<T>
-struct TBFObjectPool : public TSharedFromThis<TBFObjectPool<T, Mode>, Mode> , FGCObject
+struct TBFObjectPool : public TSharedFromThis<TBFObjectPool<T, Mode>, Mode> , FGCObject, FBFObjectPoolBase
 {
 	using FOnObjectPooled = TMulticastDelegate<void(bool bEnteredPool, int64 ID, int32 CheckoutID)>;
 	using FOnObjectAddedToPool = TMulticastDelegate<void(int64 ID, int32 CheckoutID, UObject* Object)>;
 	using FOnObjectRemovedFromPool = TMulticastDelegate<void(int64 ID, int32 CheckoutID)>;
+	using FOnObjectsPooledBatch = TMulticastDelegate<void(bool bEnteredPool, TConstArrayView<int64> IDs, TConstArrayView<int32> CheckoutIDs)>;
+	using FOnPrewarmProgress = TMulticastDelegate<void(int32 NumCreated, int32 NumRequested)>;
+	using FOnPrewarmComplete = TMulticastDelegate<void()>;
+	using FOnPoolReady = TMulticastDelegate<void(bool bSuccess)>;
 	
 protected:
 	template <typename ObjectType, ESPMode PtrMode>
@@ -291,20 +605,72 @@ public:
 	UObject* GetOwner() const { return PoolInitInfo.Owner.Get(); }
 	
 	// The pool MUST be instantiated via this Create method only.
-	static TBFObjectPoolPtr<T,  Mode> CreatePool() { return MakeShared<TBFObjectPool, Mode>(); }
+	static TBFObjectPoolPtr<T,  Mode> CreatePool()
+	{
+		LLM_SCOPE_BYTAG(BFObjectPool);
+		return MakeShared<TBFObjectPool, Mode>();
+	}
 
 	// Crucial function that every pool needs called in order to function properly.
 	virtual void InitPool(const FBFObjectPoolInitParams& Info);
 
+	/* Must be called before InitPool, the container won't register its own tick functions and TickExternal has to be called every frame instead.
+	 * This is how UBFObjectPoolSubsystem runs every shared pool from a single tick, you shouldn't need it otherwise. */
+	void SetExternallyTicked() { bfEnsure(!IsValid(PoolContainer)); bExternallyTicked = true; }
+	virtual void TickExternal(float Dt) override { if(IsValid(PoolContainer)) PoolContainer->ExternalTick(Dt); }
+
+	/* Async alternative to InitPool, streams SoftPoolClass and AssetsToPreload in through the streamable manager and then inits the pool (which prewarms time sliced if
+	 * bTimeSlicedPrewarm is set). OnPoolReady is broadcast once loading and prewarming are both done, or with false if the class failed to load. Don't use the pool before then. */
+	virtual void InitPoolAsync(const FBFObjectPoolInitParams& Info, TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
 	/* Returns a valid pooled object unless at capacity. Should always Check return for IsValid/Pointer validity in case the pool was all used and at capacity to make more,
 	 * IsHandleValid will always be true at this stage if the returned ptr was valid so need to check for that.
 	 * If bAutoActivate is false, the user is responsible for activating the object.
 	 * Check the ActivateObject() for a general idea. */
 	virtual TBFPooledObjectHandlePtr<T, Mode> UnpoolObject(bool bAutoActivate);
 
-	/* Iterates the inactive object pool searching all objects calling the interface function GetObjectGameplayTag(), this requires you to have implemented
-	 * the function on the object otherwise you won't get anything back. Useful if you pool is of specific objects and not generic reusable ones. */
-	virtual TBFPooledObjectHandlePtr<T, Mode> UnpoolObjectByTag(FGameplayTag Tag, bool bAutoActivate);
+	/* Same as UnpoolObject but returns an allocation free value handle instead of a shared handle, check IsHandleValid() on the result.
+	 * You are responsible for returning it, dropping every copy of a lite handle does not return the object. */
+	virtual TBFPooledObjectLiteHandle<T> UnpoolObjectLite(bool bAutoActivate);
+
+	// bVirtualizeWidgets pools, UnpoolObject that attaches the widget to Parent instead of the pools WidgetParent/the viewport.
+	TBFPooledObjectHandlePtr<T, Mode> UnpoolWidget(UPanelWidget* Parent, bool bAutoActivate)
+	{
+		bfEnsure(PoolInitInfo.bVirtualizeWidgets); // Non virtualized widgets always live in the viewport.
+		PendingWidgetParent = Parent;
+		TBFPooledObjectHandlePtr<T, Mode> Handle = UnpoolObject(bAutoActivate);
+		PendingWidgetParent.Reset();
+		return Handle;
+	}
+
+	/* Un-pools an inactive object whose interface function GetObjectGameplayTag() matches the tag, this requires you to have implemented
+	 * the function on the object otherwise you won't get anything back. Useful if you pool is of specific objects and not generic reusable ones.
+	 * Tags are cached when the object is created and every time it is returned so this is a bucket lookup, not a scan. If bExactMatch is false then objects
+	 * tagged with a child of the tag also match (an object tagged "UI.Popup.Reward" matches "UI.Popup"). */
+	virtual TBFPooledObjectHandlePtr<T, Mode> UnpoolObjectByTag(FGameplayTag Tag, bool bAutoActivate, bool bExactMatch = true);
+
+	// Same as UnpoolObjectByTag but un-pools the first inactive object matching any of the tags.
+	virtual TBFPooledObjectHandlePtr<T, Mode> UnpoolObjectByTags(const FGameplayTagContainer& Tags, bool bAutoActivate, bool bExactMatch = true);
+
+	/* Batch version of UnpoolObject for bursts (shotgun pellets, debris, damage numbers), appends up to Num handles to OutHandles and returns how many were un-pooled.
+	 * Missing entries are created in a single pass with the slot array reserved once, the world time is read once and a single OnObjectsPooledBatch notification
+	 * is fired instead of an OnObjectPooled broadcast per object. Returns less than Num if the pool hits capacity (or nothing else is off cooldown). */
+	virtual int32 UnpoolObjects(int32 Num, TArray<TBFPooledObjectHandlePtr<T, Mode>>& OutHandles, bool bAutoActivate);
+	virtual int32 UnpoolObjectsLite(int32 Num, TArray<TBFPooledObjectLiteHandle<T>>& OutHandles, bool bAutoActivate);
+
+	/* ESPMode::ThreadSafe object pools initialized with a ConcurrentReserve only, safe to call from any thread (UE::Tasks workers etc.).
+	 * Pops one of the ConcurrentReserve objects the game thread keeps ready off a lock free stack, nothing is created off the game thread so this returns an invalid handle
+	 * (and records a miss) if they have all been taken. ActivateObject and OnObjectPooled run on the game thread during the next upkeep tick, in the same order as
+	 * the checkouts/returns happened, so don't rely on the object having been activated yet. The handle (or a shared handle from the game thread) can be returned
+	 * from any thread, the checkout ID is swapped atomically so exactly one return wins and deactivation is queued the same way.
+	 * Stealing, tag queries and everything else stays game thread only. Objects sitting in the ready stack are staged, they count as neither active nor inactive
+	 * until the checkout is replayed. */
+	TBFPooledObjectLiteHandle<T> UnpoolObjectConcurrent(bool bAutoActivate);
+	int32 GetNumConcurrentReady() const { return ConcurrentState.IsValid() ? ConcurrentState->ReadySlots.GetNum() : 0; }
+	int32 GetNumConcurrentStaged() const { return NumConcurrentStaged; }
+	/* Game thread only, replays every queued worker checkout and return right now instead of on the next upkeep tick. The upkeep tick and this are the only places
+	 * they are replayed, so activation/deactivation callbacks never run in the middle of another pool call. */
+	void FlushConcurrentOps();
 
 	/* When a pooled object is being used, you have the ability to keep it and steal it from the pool,
 	 * this will invalidate any handles and return the object ready to be managed by you. */
@@ -312,24 +678,59 @@ public:
 
 	// Returns the object to the pool for later use. MyPool->ReturnToPool(Handle); alternatively Handle->ReturnToPool(); if the handle is still valid.
 	virtual bool ReturnToPool(TBFPooledObjectHandlePtr<T, Mode>& Handle);
+	virtual bool ReturnToPool(TBFPooledObjectLiteHandle<T>& Handle) { return Handle.ReturnToPool(); }
+
+	// Batch return, every handle is released/invalidated and a single OnObjectsPooledBatch notification is fired for the ones that were returned. Returns the number returned.
+	virtual int32 ReturnToPool(TArrayView<TBFPooledObjectHandlePtr<T, Mode>> Handles);
+	virtual int32 ReturnToPool(TArrayView<TBFPooledObjectLiteHandle<T>> Handles);
 
 	// Removes a specific object from the pool only if it is inactive, if you want to remove active objects then you might be after StealObject().
 	virtual bool RemoveInactiveObjectFromPool(int64 PoolID, int32 ObjectCheckoutID);
 
 	// Attempts to remove the specified amount of inactive objects from the pool, will not remove any if the pool is already empty or if we can't remove the specified amount.
-	virtual bool RemoveInactiveNumFromPool(int64 NumToRemove);
+	virtual bool RemoveInactiveNumFromPool(int64 NumToRemove) override;
 
 	// Clears all inactive objects from the pool if there are any.
-	virtual bool ClearInactiveObjectsPool();
+	virtual bool ClearInactiveObjectsPool() override;
+
+	/* Re-homes the pool under NewOwner (and its world), e.g. to carry it across travel or a streaming level swap. The container and plain objects are renamed into NewOwner,
+	 * actors/components/widgets are kept only if they still exist in NewOwners world (seamless travel actors, see UBFObjectPoolSubsystem::AddSeamlessTravelActors), the rest are
+	 * dropped from the pool without being destroyed and as many inactive objects as were dropped are recreated in the new world (time sliced if bTimeSlicedPrewarm).
+	 * Remaining curfews are expired, cooldowns and eviction timers restart on the new worlds clock. Returns the number of objects being rebuilt. */
+	virtual int32 MigrateToOwner(UObject* NewOwner) override;
+	/* Only renames the container and plain objects under NewOwner (and expires curfews) so nothing references the old world while it is torn down, nothing is dropped
+	 * or rebuilt and the pool shouldn't be used until MigrateToOwner is called with its next owner. This is how UBFObjectPoolTravelSubsystem holds pools between worlds. */
+	virtual void ParkUnder(UObject* NewOwner) override;
+	virtual void AppendInactiveObjects(TArray<UObject*>& OutObjects) const override;
+
+	/* Asks the pool to have Num inactive objects ready, creation is time sliced over the containers upkeep tick within PrewarmBudgetMs per frame.
+	 * If DeadlineSeconds is above 0 the budget is exceeded as needed to be done that many seconds from now (use ahead of an anticipated burst), 0 creates them right away
+	 * and below 0 only ever uses the budget. Clamped to the pool limit, returns how many new objects were queued. */
+	virtual int32 Reserve(int32 Num, float DeadlineSeconds = -1.f);
+	// Synchronously creates everything still queued by Reserve/the time sliced prewarm, for when you need the pool ready right now.
+	virtual void FlushPrewarm();
+	bool IsPrewarming() const { return NumPendingPrewarm > 0 || (IsValid(PoolContainer) && PoolContainer->GetNumPendingAssetWarmups() > 0); }
+	bool IsLoadingAssets() const { return bIsLoadingAssets; }
+	// Initialized, done loading and done prewarming.
+	bool IsPoolReady() const { return IsValid(PoolContainer) && !IsLoadingAssets() && !IsPrewarming(); }
 	
 	// Checks not only if the pools contains an Object with the given ID, but also if our specific handles checkout ID is the same as the pooled objects current checkout ID.
 	virtual bool IsObjectIDValid(int64 PoolID, int32 ObjectCheckoutID) const;
 	// Checks if the given object is inactive in the pool and not currently in use, also returns false if we can't find the object.
 	virtual bool IsObjectInactive(int64 PoolID, int32 ObjectCheckoutID) const;
-
-	int32 GetPoolSize() const { return PoolContainer->ObjectPool.Num(); }
-	int32 GetActivePoolSize() const { return GetPoolSize() - GetInactivePoolSize(); }
-	int32 GetInactivePoolSize() const { return PoolContainer->InactiveObjectIDPool.Num(); }
+	// RecycleLowestPriority overflow only, the lowest priority checkout is recycled first. Reset to 0 on every checkout, returns false if the checkout is stale.
+	bool SetRecyclePriority(int64 PoolID, int32 ObjectCheckoutID, uint8 Priority) { return PoolContainer->SetRecyclePriority(BF::OP::GetPoolIDSlotIndex(PoolID), ObjectCheckoutID, Priority); }
+
+	/* Returns the checkout to the pool after Seconds of game time, or calls OnExpired instead if bound, replacing any curfew it already has. Cleared when the object is returned
+	 * any other way, returns false if the checkout is stale. Game thread only, see UBFPoolContainer::SetCurfew. */
+	bool SetCurfew(int64 PoolID, int32 ObjectCheckoutID, float Seconds, FSimpleDelegate OnExpired = {}) { return PoolContainer->SetCurfew(BF::OP::GetPoolIDSlotIndex(PoolID), ObjectCheckoutID, Seconds, MoveTemp(OnExpired)); }
+	bool ClearCurfew(int64 PoolID, int32 ObjectCheckoutID) { return PoolContainer->ClearCurfew(BF::OP::GetPoolIDSlotIndex(PoolID), ObjectCheckoutID); }
+
+	virtual int32 GetPoolSize() const override { return PoolContainer->GetNumPooledObjects(); }
+	int32 GetActivePoolSize() const { return GetPoolSize() - GetInactivePoolSize() - NumConcurrentStaged; }
+	virtual int32 GetInactivePoolSize() const override { return PoolContainer->GetNumInactive(); }
+	virtual int64 EstimateObjectSizeBytes() override;
+	virtual FBFObjectPoolMemoryFootprint GetPoolMemoryFootprint() const override { return IsValid(PoolContainer) ? PoolContainer->GetMemoryFootprint() : FBFObjectPoolMemoryFootprint(); }
 	int32 GetPoolLimit() const { return PoolInitInfo.PoolLimit; }
 	bool IsFull() const { return GetPoolSize() >= PoolInitInfo.PoolLimit; }
 	EBFPoolType GetPoolType() const { return PoolInitInfo.PoolType; }
@@ -343,6 +744,13 @@ public:
 	FOnObjectRemovedFromPool& GetOnObjectRemovedFromPool() { return OnObjectRemovedFromPool; }
 	// Called when an object is being used or returned from the pool.
 	FOnObjectPooled& GetOnObjectPooled() { return OnObjectPooled; }
+	// Called once per batch un-pool/return (UnpoolObjects, ReturnToPool(TArrayView)) with every affected object, batch calls do not broadcast OnObjectPooled.
+	FOnObjectsPooledBatch& GetOnObjectsPooledBatch() { return OnObjectsPooledBatch; }
+	// Called once per frame a time sliced prewarm/Reserve made progress, and once when everything queued has been created.
+	FOnPrewarmProgress& GetOnPrewarmProgress() { return OnPrewarmProgress; }
+	FOnPrewarmComplete& GetOnPrewarmComplete() { return OnPrewarmComplete; }
+	// Called once an InitPoolAsync pool has loaded and prewarmed.
+	FOnPoolReady& GetOnPoolReady() { return OnPoolReady; }
 	
 	
 	// Can only decrease pool limit if we are able to remove enough inactive objects, we do not remove active one.
@@ -350,8 +758,16 @@ public:
 	// How long object may remain inactive before removed(Requires Tick enabled). Less than 0 for indefinite occupancy.
 	virtual void SetMaxObjectInactiveOccupancySeconds(float MaxObjectInactiveOccupancySeconds);
 
-	// Can be manually called to evaluate the pool occupancy and remove inactive objects if they exceed the MaxObjectInactiveOccupancySeconds.
+	/* Can be manually called to evaluate the pool occupancy and remove inactive objects if they exceed the MaxObjectInactiveOccupancySeconds.
+	 * Only the expired prefix of the time ordered inactive list is walked and destroys are capped by MaxEvictionsPerTick/EvictionBudgetMs, anything left over
+	 * is evicted over the next frames by the upkeep tick instead of waiting for the next pool tick. */
 	virtual bool EvaluatePoolOccupancy();
+
+	/* Runs every tick when AdaptiveSizing is enabled. Rolls the demand window, raises PoolLimit towards MaxPoolLimit after capacity misses, reserves (time sliced)
+	 * up to the windows peak active count plus Headroom and after ShrinkDelaySeconds of the pool being bigger than that trims a few inactive objects per call. */
+	virtual void EvaluateAdaptiveSizing();
+	// Demand summed over the adaptive sizing window, only tracked when adaptive sizing is enabled.
+	FBFObjectPoolDemandStats GetDemandStats() const;
 	
 	/* When tick is disabled, there is no clearing out of inactive objects. If you want tick you also can
 	* optionally set its Interval for better performance since clearing inactive pool objects isn't really that important.*/
@@ -360,14 +776,111 @@ public:
 	virtual void SetTickInterval(float InTickInterval);
 	float GetTickInterval() const {return PoolInitInfo.PoolTickInfo.TickInterval;}
 	bool GetTickEnabled()const {return PoolContainer->GetTickEnabled();}
-	const FBFObjectPoolInitParams& GetPoolInitInfo() const {return PoolInitInfo;}
+	virtual const FBFObjectPoolInitParams& GetPoolInitInfo() const override {return PoolInitInfo;}
 	
 protected:
-	virtual FBFPooledObjectInfo* CreateNewPoolEntry();
+	// Tail of InitPoolAsync once the streamable manager is done.
+	virtual void FinishInitPoolAsync(const FBFObjectPoolInitParams& Info);
+	// bIgnorePoolLimit is only for the GrowTemporarily overflow policy, ObjectClass defaults to PoolClass and is only ever set by pool groups.
+	virtual FBFPooledObjectInfo* CreateNewPoolEntry(bool bIgnorePoolLimit = false, UClass* ObjectClass = nullptr);
+	// Single class pools never get past the first check.
+	const FBFPooledObjectInterfaceDispatch& GetInterfaceDispatch(const UObject* Obj) const
+	{
+		if(ClassDispatches.IsEmpty() || !Obj || Obj->GetClass() == PoolInitInfo.PoolClass)
+			return InterfaceDispatch;
+		const FBFPooledObjectInterfaceDispatch* Dispatch = ClassDispatches.Find(Obj->GetClass());
+		return Dispatch ? *Dispatch : InterfaceDispatch;
+	}
+	// Picks the inactive object UnpoolObject would hand out (creating one if needed and allowed), -1 if at capacity or nothing is off cooldown.
+	virtual int64 GetNextUnpoolID();
+	/* Applies the OverflowPolicy once the pool is at capacity, returns an inactive object to check out or -1 if the policy is Fail or can't produce one.
+	 * MaxRecyclable caps how many of the oldest active objects may be recycled, batches use it so they never recycle their own checkouts. Doesn't record misses. */
+	virtual int64 GetOverflowUnpoolID(int32 MaxRecyclable = MAX_int32);
+	// GrowTemporarily, destroys inactive objects (oldest first) until the pool is back within PoolLimit. Runs from the upkeep tick.
+	void TrimTemporaryObjects();
+	// Unlinks the inactive object, marks it as checked out, activates it and returns its new handle.
+	virtual TBFPooledObjectHandlePtr<T, Mode> CheckoutObject(int64 PoolID, bool bAutoActivate);
+	virtual TBFPooledObjectLiteHandle<T> CheckoutObjectLite(int64 PoolID, bool bAutoActivate);
+	// Shared by both checkout paths, BeginCheckout returns the new checkout ID and handles must be built before FinishCheckout since activation may reallocate the slot array.
+	virtual int32 BeginCheckout(int64 PoolID);
+	virtual void FinishCheckout(int64 PoolID, int32 CheckoutID, bool bAutoActivate);
+	// Batch equivalents, BeginCheckoutBatch picks/creates and checks out up to Num objects and FinishCheckoutBatch activates them all and broadcasts once.
+	virtual void BeginCheckoutBatch(int32 Num, TArray<int64, TInlineAllocator<32>>& OutIDs, TArray<int32, TInlineAllocator<32>>& OutCheckoutIDs);
+	virtual void FinishCheckoutBatch(TConstArrayView<int64> IDs, TConstArrayView<int32> CheckoutIDs, bool bAutoActivate);
+	// Deactivates and re-inserts a checked out object without broadcasting, returns the new checkout ID or -1 if the checkout is stale.
+	virtual int32 ReturnEntry(int64 PoolID, int32 ObjectCheckoutID, float SecondsNow);
+	// The two halves of ReturnEntry, BeginReturn invalidates the checkout (returning the new checkout ID or -1) and FinishReturn deactivates and re-inserts the object.
+	virtual int32 BeginReturn(int64 PoolID, int32 ObjectCheckoutID);
+	virtual void FinishReturn(int64 PoolID, float SecondsNow);
+	// bDeferReturns, begins the return now and queues the rest for ProcessDeferredReturns. Same result as ReturnEntry.
+	int32 DeferReturn(int64 PoolID, int32 ObjectCheckoutID);
+	// Finishes every queued return and broadcasts them as one batch, runs from the upkeep tick.
+	void ProcessDeferredReturns();
+	// Shared by MigrateToOwner/ParkUnder, NewWorld is null when parking.
+	void RehomeUnder(UObject* NewOwner, UWorld* NewWorld);
+	// Runs the IF/destroy logic for the inactive object and releases its slot (which also unlinks it from the inactive list).
+	virtual void DestroyPoolEntry(int64 PoolID);
+	// Queries and caches the objects tag so tag lookups don't need to call into the IF, must be called before the object is added to the inactive list.
+	virtual void CacheObjectGameplayTag(int64 PoolID);
 	virtual void ActivateObject(T* Obj, bool bAutoActivate);
 	virtual void DeactivateObject(T* Obj);
+	// bVirtualizeWidgets only, the widget or its wrapper and attaching/detaching it.
+	UWidget* GetPooledWidgetRoot(UUserWidget* Widget) const;
+	void AttachPooledWidget(UUserWidget* Widget);
+	void DetachPooledWidget(UUserWidget* Widget);
+	// bNetworked only, no-op for actors we don't have authority over or that don't replicate.
+	void SetPooledActorNetDormant(AActor* Actor, bool bDormant) const;
 	virtual void Reset();
 	virtual void Tick(UWorld* World, float Dt);
+	// Every frame tick that only runs while there is time sliced work to do, return true to keep ticking.
+	virtual bool Upkeep(float Dt);
+	// Creates queued objects within the frame budget (or faster if a deadline requires it), returns true while objects are still queued.
+	virtual bool TickPrewarm(float Dt);
+	/* Puts inactive objects past the dormancy delay to sleep and wakes dormant ones into the awake reserve, within DormancyBudgetMs. Re-flags itself for the next
+	 * upkeep if it ran out of budget or objects are still waiting out the delay. */
+	virtual void EvaluateDormancy();
+	// Applies (or undoes) the pools Dormancy level to the object.
+	virtual void SetObjectDormant(T* Obj, bool bDormant);
+	// Called before activating every checkout, wakes the object if it is dormant so un-pooled objects are always fully registered.
+	void WakeDormantObject(int64 PoolID);
+	// Schedules EvaluateDormancy on the first upkeep tick at or after AtTime (game world seconds).
+	void RequestDormancyEvaluation(float AtTime);
+	// Thread safe pools only, the worker half of a return. Wins the checkout ID exchange and queues the deactivation for the game thread.
+	bool ReturnToPoolConcurrent(int64 PoolID, int32 ObjectCheckoutID);
+	// Game thread, true for a worker checkout whose activation is still queued.
+	bool IsConcurrentCheckoutPending(int64 PoolID) const
+	{
+		const FBFPooledObjectInfo* Info = ConcurrentState.IsValid() ? PoolContainer->FindPooledObject(PoolID) : nullptr;
+		return Info && Info->bConcurrentStaged;
+	}
+	// Game thread half of UnpoolObjectConcurrent/ReturnToPoolConcurrent, replays every queued checkout and return. Returns false if nothing was queued.
+	bool DrainConcurrentOps();
+	// Tops the ready stack back up to ConcurrentReserve from the inactive list, creating objects if needed. Returns true if it was below the reserve and staged anything.
+	bool RestockConcurrent();
+	// Any thread, enables the upkeep tick on the game thread for the queued op (or empty ready stack), only the first request until the next drain posts a task.
+	void WakeConcurrentUpkeep();
+	/* Game thread, replays queued ops then takes every slot back off the ready stack as a plain inactive object so nothing staged is left for a release to orphan.
+	 * Workers miss until the next upkeep restocks. */
+	void ReclaimConcurrentSlots();
+	void RecordMisses(int32 NumMissed)
+	{
+		RecordPoolStat(EBFObjectPoolStat::Miss, NumMissed);
+		PoolContainer->RecordSizingMisses(NumMissed);
+		if(!bAdaptiveSizing)
+			return;
+		DemandSlices[CurrentDemandSlice].NumMisses += NumMissed;
+		NumMissesSinceEvaluation += NumMissed;
+	}
+	// The overflow policy served the un-pool, adaptive sizing still counts it as a miss since the limit couldn't cover the demand.
+	void RecordOverflow()
+	{
+		RecordPoolStat(EBFObjectPoolStat::Overflow);
+		PoolContainer->RecordSizingMisses(1);
+		if(!bAdaptiveSizing)
+			return;
+		++DemandSlices[CurrentDemandSlice].NumMisses;
+		++NumMissesSinceEvaluation;
+	}
 	
 protected:
 	// Called upon a new object being created or deleted from the pool.
@@ -376,16 +889,57 @@ protected:
 	
 	// Called when an object is being used or returned from the pool
 	FOnObjectPooled OnObjectPooled;
+	FOnObjectsPooledBatch OnObjectsPooledBatch;
+	FOnPrewarmProgress OnPrewarmProgress;
+	FOnPrewarmComplete OnPrewarmComplete;
+	FOnPoolReady OnPoolReady;
 
 	TObjectPtr<UBFPoolContainer> PoolContainer = nullptr;
 	FBFObjectPoolInitParams PoolInitInfo;
-
-	// Ever incrementing ID that is statically assigned to each new object.
-	int64 CurrentPoolIDIndex = -1;
+	// Resolved from PoolClass in InitPool, every interface event goes through this.
+	FBFPooledObjectInterfaceDispatch InterfaceDispatch;
+	// Pool groups (TBFObjectPoolGroup) also hold subclasses of PoolClass, which can implement the IF differently, each one resolved when the group first sees it.
+	TMap<const UClass*, FBFPooledObjectInterfaceDispatch> ClassDispatches;
+
+	// Time sliced creation state, NumPrewarmRequested is the total queued since the pool was last fully prewarmed (for progress reporting).
+	int32 NumPendingPrewarm = 0;
+	int32 NumPrewarmRequested = 0;
+	float PrewarmDeadline = -1.f;
+
+	// Adaptive sizing demand window, a ring of slices each covering WindowSeconds / NumDemandSlices. Checkouts and misses are recorded into the current slice.
+	static constexpr int32 NumDemandSlices = 8;
+	TStaticArray<FBFObjectPoolDemandStats, NumDemandSlices> DemandSlices;
+	int32 CurrentDemandSlice = 0;
+	int32 NumMissesSinceEvaluation = 0;
+	float DemandSliceStartTime = 0.f;
+	float OversizedSinceTime = -1.f;
+
+	float NextDormancyTime = 0.f;
+
+	// Set for the duration of UnpoolWidget.
+	TWeakObjectPtr<UPanelWidget> PendingWidgetParent;
+
+	// Only allocated when the pool is usable from worker threads (ESPMode::ThreadSafe with a ConcurrentReserve or bDeferReturns).
+	TUniquePtr<BF::OP::FConcurrentPoolState> ConcurrentState;
+	// Objects in the ready stack or checked out by a worker with the checkout not replayed yet, game thread only.
+	int32 NumConcurrentStaged = 0;
+
+	// Returns queued by bDeferReturns waiting on the next upkeep tick, their checkout IDs have already been bumped.
+	TArray<int64> DeferredReturnIDs;
+	TArray<int32> DeferredReturnCheckoutIDs;
+
+	// Keeps SoftPoolClass and AssetsToPreload loaded for the lifetime of the pool.
+	TSharedPtr<FStreamableHandle> PreloadHandle;
 	
 	// Cheaper than IsBound() checks every pooling/un-pooling.
 	uint8 bIsActivateObjectOverridden : 1 = false;
 	uint8 bIsDeactivateObjectOverridden : 1 = false;
+	uint8 bAdaptiveSizing : 1 = false;
+	uint8 bPendingEviction : 1 = false; // EvaluatePoolOccupancy ran out of budget with expired objects left.
+	uint8 bPendingDormancy : 1 = false; // EvaluateDormancy is due at NextDormancyTime.
+	uint8 bPendingOverflowTrim : 1 = false; // A temporary object past PoolLimit was returned and is trimmed on the next upkeep.
+	uint8 bIsLoadingAssets : 1 = false;
+	uint8 bPendingPoolReady : 1 = false; // Set by InitPoolAsync, OnPoolReady fires once prewarming is done.
 };
 
 
@@ -399,9 +953,13 @@ TBFObjectPool<T, Mode>::TBFObjectPool(TBFObjectPool&& Rhs) noexcept
 	
 	PoolContainer = std::move(Rhs.PoolContainer);
 	PoolInitInfo = std::move(Rhs.PoolInitInfo);
-	CurrentPoolIDIndex = Rhs.CurrentPoolIDIndex;
 	bIsActivateObjectOverridden = Rhs.bIsActivateObjectOverridden;
 	bIsDeactivateObjectOverridden = Rhs.bIsDeactivateObjectOverridden;
+	InterfaceDispatch = Rhs.InterfaceDispatch;
+	ClassDispatches = MoveTemp(Rhs.ClassDispatches);
+	bExternallyTicked = Rhs.bExternallyTicked;
+	bAdaptiveSizing = Rhs.bAdaptiveSizing;
+	ConcurrentState = MoveTemp(Rhs.ConcurrentState);
 	Rhs.Reset();
 }
 
@@ -418,9 +976,13 @@ TBFObjectPool<T, Mode>& TBFObjectPool<T, Mode>::operator=(TBFObjectPool&& Rhs) n
 	
 	PoolContainer = std::move(Rhs.PoolContainer);
 	PoolInitInfo = std::move(Rhs.PoolInitInfo);
-	CurrentPoolIDIndex = Rhs.CurrentPoolIDIndex;
 	bIsActivateObjectOverridden = Rhs.bIsActivateObjectOverridden;
 	bIsDeactivateObjectOverridden = Rhs.bIsDeactivateObjectOverridden;
+	InterfaceDispatch = Rhs.InterfaceDispatch;
+	ClassDispatches = MoveTemp(Rhs.ClassDispatches);
+	bExternallyTicked = Rhs.bExternallyTicked;
+	bAdaptiveSizing = Rhs.bAdaptiveSizing;
+	ConcurrentState = MoveTemp(Rhs.ConcurrentState);
 	Rhs.Reset();
 	
 	return *this;
@@ -430,211 +992,780 @@ template<typename T, ESPMode Mode>
 requires BF::OP::CIs_UObject<T>
 void TBFObjectPool<T, Mode>::InitPool(const FBFObjectPoolInitParams& Info)
 {
+	LLM_SCOPE_BYTAG(BFObjectPool);
 	bfEnsure(Info.InitialCount >= 0 && Info.PoolLimit >= 0); // Please use positive values, unreal forces int over uint.
 	bfEnsure(Info.PoolType != EBFPoolType::Invalid); // Must set the pool type. 
 	bfEnsure(Info.InitialCount <= Info.PoolLimit); // Self explanatory.
 	bfValid(Info.Owner);
 	bfEnsure(Info.PoolType != EBFPoolType::UserWidget || CastChecked<APlayerController>(Info.Owner)); // If using a widget pool, you must have a player controller set as the owner.
 	bfValid(Info.Owner->GetWorld()); // The owner must implement get world.
-	bfEnsure(!IsValid(PoolContainer) || PoolContainer->ObjectPool.Num() == 0); // You can't re-init a pool, you must clear it first or just make a new pool.
+	bfEnsure(!IsValid(PoolContainer) || PoolContainer->GetNumPooledObjects() == 0); // You can't re-init a pool, you must clear it first or just make a new pool.
+	bfEnsure(Info.ConcurrentReserve <= 0 || (Mode == ESPMode::ThreadSafe && Info.PoolType == EBFPoolType::Object)); // Worker thread un-pooling needs a thread safe pool of plain objects.
+	bfEnsure(Info.Dormancy == EBFPoolDormancy::Awake || Info.PoolType == EBFPoolType::Actor || Info.PoolType == EBFPoolType::Component); // Only actors and components have state to put to sleep.
+	bfEnsure(!Info.bNetworked || Info.PoolType == EBFPoolType::Actor); // Only actors have net channels to keep.
+	bfEnsure(!Info.bVirtualizeWidgets || Info.PoolType == EBFPoolType::UserWidget); // Only widgets have a parent to detach from.
+	bfEnsure(!Info.bPersistAcrossTravel || Info.PoolType == EBFPoolType::Actor || Info.PoolType == EBFPoolType::Object); // Components and widgets are tied to their owner.
+	bfEnsure(Info.OverflowPolicy == EBFPoolOverflowPolicy::Fail || Mode == ESPMode::NotThreadSafe || (Info.ConcurrentReserve <= 0 && !Info.bDeferReturns)); // Pools used from worker threads can't force returns or grow past their reserved slots.
 	
 	if(!Info.Owner || Info.PoolType == EBFPoolType::Invalid ||
-		(IsValid(PoolContainer) && PoolContainer->ObjectPool.Num() > 0))
+		(IsValid(PoolContainer) && PoolContainer->GetNumPooledObjects() > 0))
 		return;
 
 	
 	PoolInitInfo = Info;
 	bIsActivateObjectOverridden = PoolInitInfo.ActivateObjectOverride.IsBound();
 	bIsDeactivateObjectOverridden = PoolInitInfo.DeactivateObjectOverride.IsBound();
+	bAdaptiveSizing = PoolInitInfo.AdaptiveSizing.bEnabled;
+	if(PoolInitInfo.PoolType != EBFPoolType::Actor && PoolInitInfo.PoolType != EBFPoolType::Component)
+		PoolInitInfo.Dormancy = EBFPoolDormancy::Awake;
+	if(PoolInitInfo.PoolType != EBFPoolType::Actor)
+		PoolInitInfo.bNetworked = false;
+
+	// Before anything sizes itself off the limit (the concurrent reserve, slot reservation).
+	float ProfileTimeToPeak = 0.f;
+	if(PoolInitInfo.bUseSizingProfile)
+		GetDefault<UBFObjectPoolSizingProfiles>()->ApplyProfile(GetWorld(), PoolInitInfo, T::StaticClass(), ProfileTimeToPeak);
 
 	if(!IsValid(PoolContainer)) // Reuse if we are re-initializing the pool.
 	{
 		PoolContainer = NewObject<UBFPoolContainer>(Info.Owner.Get());
 	}
 
+	PoolContainer->SetUpkeepTickGroup(PoolInitInfo.PoolTickInfo.UpkeepTickGroup);
+	PoolContainer->SetClusterObjects(PoolInitInfo.bGCCluster && PoolInitInfo.PoolType == EBFPoolType::Object);
 	PoolContainer->Init([WeakThis = this->AsWeak()](UWorld* World, float Dt)
 	{
 		if(WeakThis.IsValid())
 			WeakThis.Pin()->Tick(World, Dt);
-	},  GetWorld(), PoolInitInfo.PoolTickInfo.TickInterval);
+	},  GetWorld(), PoolInitInfo.PoolTickInfo.TickInterval, bExternallyTicked);
 
-	PoolContainer->SetTickEnabled(PoolInitInfo.PoolTickInfo.bEnableTicking);
+	PoolContainer->SetOwningPoolHandleFuncs([WeakThis = this->AsWeak()](int64 PoolID, int32 CheckoutID)
+	{
+		auto Pool = WeakThis.Pin();
+		return Pool.IsValid() && Pool->ReturnToPool_Internal(PoolID, CheckoutID);
+	},
+	[WeakThis = this->AsWeak()](int64 PoolID, int32 CheckoutID) -> UObject*
+	{
+		auto Pool = WeakThis.Pin();
+		return Pool.IsValid() ? Pool->StealObject(PoolID, CheckoutID) : nullptr;
+	});
 
-	if(!PoolInitInfo.PoolClass) // Only applies to c++ land, in BP we ensure before this is even called if the class is not set since its templated on UObject.
-		PoolInitInfo.PoolClass = T::StaticClass();
+	PoolContainer->SetUpkeepFunc([WeakThis = this->AsWeak()](float Dt)
+	{
+		auto Pool = WeakThis.Pin();
+		return Pool.IsValid() && Pool->Upkeep(Dt);
+	});
 
-	int32 Count = Info.InitialCount;
-	while(Count--)
+	PoolContainer->SetTickEnabled(PoolInitInfo.PoolTickInfo.bEnableTicking || bAdaptiveSizing);
+	DemandSliceStartTime = GetWorld()->GetTimeSeconds();
+
+	PoolContainer->SetConcurrentCapacity(INDEX_NONE);
+	if constexpr (Mode == ESPMode::ThreadSafe)
 	{
-		CreateNewPoolEntry();
+		// Deferred returns also route returns made off the game thread through the concurrent queue, so handles can be dropped anywhere.
+		if((PoolInitInfo.ConcurrentReserve > 0 && PoolInitInfo.PoolType == EBFPoolType::Object) || PoolInitInfo.bDeferReturns)
+		{
+			// Workers index the slot array directly, reserving for the largest the pool can ever get means it never reallocates under them.
+			PoolContainer->SetConcurrentCapacity(FMath::Max(PoolInitInfo.PoolLimit, bAdaptiveSizing ? PoolInitInfo.AdaptiveSizing.MaxPoolLimit : 0));
+			ConcurrentState = MakeUnique<BF::OP::FConcurrentPoolState>(PoolContainer->GetConcurrentCapacity());
+			PoolContainer->RequestUpkeep(); // Fills the ready stack next frame.
+			PoolInitInfo.OverflowPolicy = EBFPoolOverflowPolicy::Fail;
+		}
 	}
-}
 
+	const bool bRecycles = PoolInitInfo.OverflowPolicy == EBFPoolOverflowPolicy::RecycleOldest || PoolInitInfo.OverflowPolicy == EBFPoolOverflowPolicy::RecycleLowestPriority;
+	PoolContainer->SetTrackActiveOrder(bRecycles);
+
+	// InitPoolAsync has already streamed these in and holds the handle, otherwise this is the (hitchy) synchronous path.
+	if(!PreloadHandle.IsValid())
+	{
+		TArray<FSoftObjectPath> Paths;
+		if(!PoolInitInfo.PoolClass && !PoolInitInfo.SoftPoolClass.IsNull())
+			Paths.Add(PoolInitInfo.SoftPoolClass.ToSoftObjectPath());
+		for(const TSoftObjectPtr<UObject>& Asset : PoolInitInfo.AssetsToPreload)
+		{
+			if(!Asset.IsNull())
+				Paths.AddUnique(Asset.ToSoftObjectPath());
+		}
 
+		if(Paths.Num() > 0)
+			PreloadHandle = UAssetManager::GetStreamableManager().RequestSyncLoad(Paths);
+	}
 
-template <typename T, ESPMode Mode> 
-requires BF::OP::CIs_UObject<T>
-void TBFObjectPool<T,  Mode>::Tick(UWorld* World, float Dt)
-{
+	if(!PoolInitInfo.PoolClass)
+		PoolInitInfo.PoolClass = PoolInitInfo.SoftPoolClass.Get();
 	
-#if !UE_BUILD_SHIPPING
-	// We register tick through our Init function so we can never NOT be sure the owner and pool class is valid because we ensure/early out there 
-	if(BF::OP::CVarObjectPoolPrintPoolOccupancy.GetValueOnGameThread())
-	{
-		bfEnsure(IsValid(PoolContainer));
-		FString FormatString = FString::Format(TEXT("Object Pool {0} {1} \n- Total Size:{2}/{3}\n- Active Objects: {4}\n- Inactive Objects: {5}\n- Max Inactive Occupancy: {6}\n- Cooldown Time: {7}"),
-			{ GetNameSafe(PoolInitInfo.PoolClass), GetNameSafe(PoolInitInfo.Owner), PoolContainer->ObjectPool.Num(), PoolInitInfo.PoolLimit ,PoolContainer->ObjectPool.Num() - PoolContainer->InactiveObjectIDPool.Num(),
-				PoolContainer->InactiveObjectIDPool.Num(), GetMaxObjectInactiveOccupancySeconds(), PoolInitInfo.CooldownTimeSeconds });
+	if(!PoolInitInfo.PoolClass) // Only applies to c++ land, in BP we ensure before this is even called if the class is not set since its templated on UObject.
+		PoolInitInfo.PoolClass = T::StaticClass();
 
-		// Each log is based on the pools unique memory address and the GPlayInEditorID to ensure we can differentiate between pools even in the same PIE session.
-#if UE_VERSION_OLDER_THAN(5, 5, 0)
-		uint64 UniqueKey = GetTypeHash(reinterpret_cast<uint64>(this)) + GPlayInEditorID;
-#else
-		uint64 UniqueKey = GetTypeHash(reinterpret_cast<uint64>(this)) + UE::GetPlayInEditorID();
-#endif
+	if(BF::OP::CVarObjectPoolRecordSizingProfiles.GetValueOnGameThread())
+		PoolContainer->BeginSizingRecording(PoolInitInfo.PoolClass);
 
-		if(World->GetNetMode() == NM_DedicatedServer || !GEngine)
-			UE_LOGFMT(LogTemp, Warning, "{0}", FormatString);
-		else
-			GEngine->AddOnScreenDebugMessage(UniqueKey, 8.f, FColor::Green, FormatString);
+	InterfaceDispatch = FBFPooledObjectInterfaceDispatch::Resolve(PoolInitInfo.PoolClass);
+	PoolContainer->ReserveSlots(PoolInitInfo.InitialCount);
+
+	if(PoolInitInfo.bWarmupAssets)
+	{
+		PoolContainer->QueueAssetWarmup(PoolInitInfo.AssetsToPreload, PoolInitInfo.bWarmupActivation);
+		if(!PoolInitInfo.bTimeSlicedPrewarm)
+			PoolContainer->TickAssetWarmup(DBL_MAX);
+		else if(PoolContainer->GetNumPendingAssetWarmups() > 0)
+			PoolContainer->RequestUpkeep(); // Even if InitialCount is 0.
+	}
+
+	if(PoolInitInfo.bTimeSlicedPrewarm)
+	{
+		Reserve(PoolInitInfo.InitialCount, ProfileTimeToPeak > 0.f ? ProfileTimeToPeak : -1.f);
+		return;
 	}
-#endif
 	
-	EvaluatePoolOccupancy();
+	int32 Count = PoolInitInfo.InitialCount;
+	while(Count--)
+	{
+		if(!CreateNewPoolEntry()) // Creation failing once will fail for the rest too.
+			break;
+	}
 }
 
 
 template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
-bool TBFObjectPool<T, Mode>::EvaluatePoolOccupancy()
+void TBFObjectPool<T, Mode>::InitPoolAsync(const FBFObjectPoolInitParams& Info, TAsyncLoadPriority Priority)
 {
-	if(GetMaxObjectInactiveOccupancySeconds() < 0.f)
-		return false;
-	
-	float SecondsNow = GetWorld()->GetTimeSeconds();
+	bfEnsure(!IsLoadingAssets()); // Already streaming in for a previous InitPoolAsync call.
+	bfValid(Info.Owner);
+	if(IsLoadingAssets() || !Info.Owner)
+		return;
 	
-	int NumRemoved = 0;
-	for(int32 j = PoolContainer->InactiveObjectIDPool.Num() - 1; j >= 0; --j)
+	TArray<FSoftObjectPath> Paths;
+	if(!Info.PoolClass && !Info.SoftPoolClass.IsNull())
+		Paths.Add(Info.SoftPoolClass.ToSoftObjectPath());
+	for(const TSoftObjectPtr<UObject>& Asset : Info.AssetsToPreload)
 	{
-		FBFPooledObjectInfo& Info = PoolContainer->ObjectPool.FindChecked(PoolContainer->InactiveObjectIDPool[j]);
-		float Delta = SecondsNow - Info.LastTimeActive;
-		if(Delta >= GetMaxObjectInactiveOccupancySeconds())
-		{
-			RemoveInactiveObjectFromPool(Info.ObjectPoolID, Info.ObjectCheckoutID);
-			++NumRemoved;
-		}
+		if(!Asset.IsNull())
+			Paths.AddUnique(Asset.ToSoftObjectPath());
 	}
 
-#if !UE_BUILD_SHIPPING
-	if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
-		UE_LOGFMT(LogTemp, Warning, "Removed {0} objects from the pool due to exceeding the MaxObjectInactiveOccupancySeconds", NumRemoved);
-#endif
-
-	return NumRemoved > 0;
-}
-
+	bIsLoadingAssets = true;
+	bPendingPoolReady = true;
+	if(Paths.Num() > 0)
+	{
+		PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths, FStreamableDelegate::CreateLambda([WeakThis = this->AsWeak(), Info]()
+		{
+			if(auto Pool = WeakThis.Pin())
+				Pool->FinishInitPoolAsync(Info);
+		}), Priority);
+	}
 
-template <typename T, ESPMode Mode> 
-requires BF::OP::CIs_UObject<T>
-void TBFObjectPool<T, Mode>::Reset()
-{
-	OnObjectAddedToPool.Clear();
-	OnObjectRemovedFromPool.Clear();
-	PoolContainer = nullptr;
-	PoolInitInfo.Reset();
-	CurrentPoolIDIndex = -1;
-	bIsActivateObjectOverridden = false;
-	bIsDeactivateObjectOverridden = false;
+	// Nothing to stream in, or the request couldn't be made in which case InitPool falls back to loading synchronously.
+	if(!PreloadHandle.IsValid())
+		FinishInitPoolAsync(Info);
 }
 
 
-template <typename T, ESPMode Mode>
-requires BF::OP::CIs_UObject<T>
-bool TBFObjectPool<T, Mode>::SetPoolLimit(int32 PoolLimit)
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::FinishInitPoolAsync(const FBFObjectPoolInitParams& Info)
 {
-	if(PoolLimit == PoolInitInfo.PoolLimit)
-		return true;
-
-	if(PoolLimit > PoolInitInfo.PoolLimit)
+	bIsLoadingAssets = false;
+	if(!Info.PoolClass && !Info.SoftPoolClass.IsNull() && !Info.SoftPoolClass.Get())
 	{
-		PoolInitInfo.PoolLimit = PoolLimit;
-		return true;
+#if !UE_BUILD_SHIPPING
+		if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+			UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] InitPoolAsync failed to load pool class {0}.", Info.SoftPoolClass.ToString());
+#endif
+		bPendingPoolReady = false;
+		OnPoolReady.Broadcast(false);
+		return;
 	}
-
-	int32 CurrentPoolSize = GetPoolSize();
-	int32 InactivePoolSize = GetInactivePoolSize();
-
-	// If we don't have enough inactive objects to reach the new limit then we can't do anything
-	if(CurrentPoolSize - InactivePoolSize <= PoolLimit)
+	
+	InitPool(Info);
+	if(!IsValid(PoolContainer))
 	{
-		// Now check to see if we can fit without trimming some objects.
-		if(CurrentPoolSize <= PoolLimit)
-		{
-			PoolInitInfo.PoolLimit = PoolLimit;
-			return true;
-		}
-
-		RemoveInactiveNumFromPool(CurrentPoolSize - PoolLimit);
-		PoolInitInfo.PoolLimit = PoolLimit;
-		return true;
+		bPendingPoolReady = false;
+		OnPoolReady.Broadcast(false);
+		return;
 	}
 
-	return false;
+	// Otherwise TickPrewarm broadcasts once its done.
+	if(!IsPrewarming())
+	{
+		bPendingPoolReady = false;
+		OnPoolReady.Broadcast(true);
+	}
 }
 
 
 template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
-void TBFObjectPool<T, Mode>::SetMaxObjectInactiveOccupancySeconds(float MaxObjectInactiveOccupancySeconds)
+int32 TBFObjectPool<T, Mode>::Reserve(int32 Num, float DeadlineSeconds)
 {
 	// You must call Init on your pool before trying to use anything on it.
 	bfEnsure(IsValid(PoolContainer));
+
+	// Objects already queued count towards the request, so calling this every frame ahead of a burst doesn't keep queuing more.
+	const int32 NumToQueue = FMath::Min(Num - GetInactivePoolSize(), PoolInitInfo.PoolLimit - GetPoolSize()) - NumPendingPrewarm;
+	if(NumToQueue > 0)
+	{
+		NumPendingPrewarm += NumToQueue;
+		NumPrewarmRequested += NumToQueue;
+	}
+
+	if(!IsPrewarming())
+		return 0;
+
+	if(DeadlineSeconds == 0.f)
+	{
+		FlushPrewarm();
+		return FMath::Max(NumToQueue, 0);
+	}
 	
-	// Ensure that we are ticking if we have a value that's useful.
-	if(MaxObjectInactiveOccupancySeconds > 0.f)
-		PoolContainer->SetTickEnabled(true);
-	else
+	if(DeadlineSeconds > 0.f)
 	{
-		PoolContainer->SetTickEnabled(false);
-		MaxObjectInactiveOccupancySeconds = -1.f;
+		const float Deadline = GetWorld()->GetTimeSeconds() + DeadlineSeconds;
+		PrewarmDeadline = PrewarmDeadline < 0.f ? Deadline : FMath::Min(PrewarmDeadline, Deadline);
 	}
 
-	PoolInitInfo.PoolTickInfo.MaxObjectInactiveOccupancySeconds = MaxObjectInactiveOccupancySeconds;
+	PoolContainer->RequestUpkeep();
+	return FMath::Max(NumToQueue, 0);
 }
 
 
-template <typename T, ESPMode Mode> 
-requires BF::OP::CIs_UObject<T>
-void TBFObjectPool<T, Mode>::SetTickInterval(float InTickInterval)
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::FlushPrewarm()
 {
-	// You must call Init on your pool before trying to use anything on it.
-	bfEnsure(IsValid(PoolContainer));
-	PoolContainer->SetTickInterval(InTickInterval);
-	PoolInitInfo.PoolTickInfo.TickInterval = InTickInterval;
+	if(!IsPrewarming())
+		return;
+	
+	// A deadline of now means everything still queued is created in this call.
+	PrewarmDeadline = GetWorld()->GetTimeSeconds();
+	TickPrewarm(0.f);
 }
 
 
-template <typename T, ESPMode Mode> 
-requires BF::OP::CIs_UObject<T>
-void TBFObjectPool<T, Mode>::SetTickEnabled(bool bEnable)
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::Upkeep(float Dt)
 {
-	// You must call Init on your pool before trying to use anything on it.
-	bfEnsure(IsValid(PoolContainer));
-	PoolContainer->SetTickEnabled(bEnable);
-}
+	// Workers wake the upkeep through WakeConcurrentUpkeep, so it only keeps running while there was something queued or the ready stack is being topped up.
+	bool bConcurrentWork = false;
+	if constexpr (Mode == ESPMode::ThreadSafe)
+	{
+		if(ConcurrentState.IsValid())
+			bConcurrentWork = DrainConcurrentOps();
+	}
 
+	// Before prewarming and restocking so both can count the returned objects as inactive.
+	ProcessDeferredReturns();
+	
+	const bool bPrewarming = TickPrewarm(Dt);
+	
+	// Re-flags itself if it runs out of budget again.
+	if(bPendingEviction)
+		EvaluatePoolOccupancy();
 
-template<typename T, ESPMode Mode>
+	// After eviction so we never wake or sleep something that is about to be destroyed anyway.
+	if(bPendingDormancy && GetWorld()->GetTimeSeconds() >= NextDormancyTime)
+		EvaluateDormancy();
+
+	if(bPendingOverflowTrim)
+		TrimTemporaryObjects();
+
+	if constexpr (Mode == ESPMode::ThreadSafe)
+	{
+		if(ConcurrentState.IsValid())
+			bConcurrentWork |= RestockConcurrent();
+	}
+	
+	return bPrewarming || bPendingEviction || bPendingDormancy || bPendingOverflowTrim || bConcurrentWork || DeferredReturnIDs.Num() > 0;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::TickPrewarm(float Dt)
+{
+	if(!IsPrewarming())
+		return false;
+
+	SCOPED_NAMED_EVENT(TBFObjectPool_TickPrewarm, FColor::Green);
+	
+	// With a deadline spread what's left evenly over the remaining frames, the budget can only make us go faster than that, never slower.
+	int32 MinToCreate = 1;
+	if(PrewarmDeadline >= 0.f)
+	{
+		const float TimeLeft = PrewarmDeadline - GetWorld()->GetTimeSeconds();
+		MinToCreate = TimeLeft <= Dt ? NumPendingPrewarm : FMath::Max(1, FMath::CeilToInt32(NumPendingPrewarm * Dt / TimeLeft));
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + PoolInitInfo.PrewarmBudgetMs / 1000.0;
+	
+	// Assets before objects so nothing created after them activates with a cold PSO, a deadline that has arrived warms everything left right now.
+	if(PoolContainer->GetNumPendingAssetWarmups() > 0)
+	{
+		const bool bDeadlineReached = PrewarmDeadline >= 0.f && PrewarmDeadline - GetWorld()->GetTimeSeconds() <= Dt;
+		if(PoolContainer->TickAssetWarmup(bDeadlineReached ? DBL_MAX : EndTime))
+			return true;
+	}
+	
+	int32 NumCreated = 0;
+	while(NumPendingPrewarm > 0)
+	{
+		// Synchronous creation from a starved UnpoolObject can fill the pool up while we are prewarming, nothing left to do if so.
+		if(!CreateNewPoolEntry())
+		{
+			NumPendingPrewarm = 0;
+			break;
+		}
+		
+		--NumPendingPrewarm;
+		if(++NumCreated >= MinToCreate && FPlatformTime::Seconds() >= EndTime)
+			break;
+	}
+
+	OnPrewarmProgress.Broadcast(NumPrewarmRequested - NumPendingPrewarm, NumPrewarmRequested);
+	if(IsPrewarming())
+		return true;
+
+#if !UE_BUILD_SHIPPING
+	if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Finished prewarming {0} objects for pool {1}.", NumPrewarmRequested, PoolInitInfo.PoolClass->GetName());
+#endif
+	
+	NumPrewarmRequested = 0;
+	PrewarmDeadline = -1.f;
+	OnPrewarmComplete.Broadcast();
+	
+	if(bPendingPoolReady)
+	{
+		bPendingPoolReady = false;
+		OnPoolReady.Broadcast(true);
+	}
+	return false;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::EvaluateDormancy()
+{
+	bPendingDormancy = false;
+	if(PoolInitInfo.Dormancy == EBFPoolDormancy::Awake || !IsValid(PoolContainer))
+		return;
+
+	SCOPED_NAMED_EVENT(TBFObjectPool_EvaluateDormancy, FColor::Green);
+
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+	const int32 AwakeReserve = PoolInitInfo.DormancyAwakeReserve;
+	float NextEligibleTime = TNumericLimits<float>::Max();
+	int32 NumAwake = 0;
+
+	/* Newest first, the reserve is whatever UnpoolObject hands out next. Dormant objects past the reserve are where the previous evaluation got to
+	 * (everything older went to sleep before them) so the walk stops there, an idle pool only ever looks at its awake objects. */
+	TArray<int64, TInlineAllocator<32>> ToWake;
+	TArray<int64, TInlineAllocator<32>> ToSleep;
+	PoolContainer->ForEachInactiveNewestFirst([&](const FBFPooledObjectInfo& Info)
+	{
+		if(Info.bDormant)
+		{
+			if(NumAwake >= AwakeReserve)
+				return false;
+			
+			ToWake.Add(Info.ObjectPoolID);
+			++NumAwake;
+			return true;
+		}
+
+		if(++NumAwake <= AwakeReserve)
+			return true;
+
+		const float EligibleTime = Info.LastTimeActive + PoolInitInfo.DormancyDelaySeconds;
+		if(SecondsNow < EligibleTime)
+			NextEligibleTime = FMath::Min(NextEligibleTime, EligibleTime);
+		else
+			ToSleep.Add(Info.ObjectPoolID);
+		return true;
+	});
+	
+	const double EndTime = FPlatformTime::Seconds() + PoolInitInfo.DormancyBudgetMs / 1000.0;
+	int32 NumProcessed = 0;
+	bool bOutOfBudget = false;
+	auto CheckBudget = [&]() { bOutOfBudget = NumProcessed > 0 && FPlatformTime::Seconds() >= EndTime; return !bOutOfBudget; };
+
+	// Waking first, the reserve is what keeps un-pooling cheap. Component registration can run arbitrary code so every ID is looked up again.
+	for(int32 i = 0; i < ToWake.Num() && CheckBudget(); ++i)
+	{
+		WakeDormantObject(ToWake[i]);
+		++NumProcessed;
+	}
+
+	// Oldest first so if we run out of budget the objects least likely to be un-pooled soon are the ones already asleep.
+	for(int32 i = ToSleep.Num() - 1; i >= 0 && CheckBudget(); --i)
+	{
+		FBFPooledObjectInfo* Info = PoolContainer->FindPooledObject(ToSleep[i]);
+		if(!Info || Info->bActive || Info->bDormant)
+			continue;
+
+		Info->bDormant = true;
+		SetObjectDormant(CastChecked<T>(Info->PooledObject), true);
+		++NumProcessed;
+	}
+
+	if(bOutOfBudget)
+		RequestDormancyEvaluation(SecondsNow);
+	else if(NextEligibleTime < TNumericLimits<float>::Max())
+		RequestDormancyEvaluation(NextEligibleTime);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::SetObjectDormant(T* Obj, bool bDormant)
+{
+	bfValid(Obj);
+	const bool bUnregister = PoolInitInfo.Dormancy == EBFPoolDormancy::Unregistered;
+
+	auto ApplyToComponent = [bDormant, bUnregister](UActorComponent* Component)
+	{
+		if(bUnregister)
+		{
+			if(bDormant && Component->IsRegistered())
+				Component->UnregisterComponent();
+			else if(!bDormant && !Component->IsRegistered() && Component->GetOwner()) // Components of non actor owners were never registered.
+				Component->RegisterComponent();
+		}
+		else if(bDormant)
+		{
+			Component->DestroyPhysicsState();
+		}
+		else if(Component->IsRegistered())
+		{
+			Component->CreatePhysicsState(); // No-op for components that don't want physics state.
+		}
+	};
+	
+	switch (GetPoolType())
+	{
+		case EBFPoolType::Actor:
+		{
+			AActor* Actor = (AActor*)Obj;
+			if(!bUnregister)
+				Actor->ForEachComponent(false, ApplyToComponent);
+			else if(bDormant)
+				Actor->UnregisterAllComponents();
+			else
+				Actor->RegisterAllComponents();
+			break;
+		}
+		case EBFPoolType::Component: ApplyToComponent((UActorComponent*)Obj); break;
+		default: break; // InitPool forces other pool types to stay awake.
+	}
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::WakeDormantObject(int64 PoolID)
+{
+	if(PoolInitInfo.Dormancy == EBFPoolDormancy::Awake)
+		return;
+	
+	FBFPooledObjectInfo* Info = PoolContainer->FindPooledObject(PoolID);
+	if(!Info || !Info->bDormant)
+		return;
+
+	// Flag first, registering may add entries which can reallocate the slot array.
+	Info->bDormant = false;
+	SetObjectDormant(CastChecked<T>(Info->PooledObject), false);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::RequestDormancyEvaluation(float AtTime)
+{
+	if(PoolInitInfo.Dormancy == EBFPoolDormancy::Awake)
+		return;
+
+	NextDormancyTime = bPendingDormancy ? FMath::Min(NextDormancyTime, AtTime) : AtTime;
+	bPendingDormancy = true;
+	PoolContainer->RequestUpkeep();
+}
+
+
+template <typename T, ESPMode Mode> 
 requires BF::OP::CIs_UObject<T>
-FBFPooledObjectInfo* TBFObjectPool<T, Mode>::CreateNewPoolEntry()
+void TBFObjectPool<T,  Mode>::Tick(UWorld* World, float Dt)
+{
+	
+#if !UE_BUILD_SHIPPING
+	// We register tick through our Init function so we can never NOT be sure the owner and pool class is valid because we ensure/early out there 
+	if(BF::OP::CVarObjectPoolPrintPoolOccupancy.GetValueOnGameThread())
+	{
+		bfEnsure(IsValid(PoolContainer));
+		FString FormatString = FString::Format(TEXT("Object Pool {0} {1} \n- Total Size:{2}/{3}\n- Active Objects: {4}\n- Inactive Objects: {5}\n- Max Inactive Occupancy: {6}\n- Cooldown Time: {7}\n- Hits/Misses/Lazy Creations: {8}/{9}/{10}"),
+			{ GetNameSafe(PoolInitInfo.PoolClass), GetNameSafe(PoolInitInfo.Owner), GetPoolSize(), PoolInitInfo.PoolLimit, GetActivePoolSize(),
+				GetInactivePoolSize(), GetMaxObjectInactiveOccupancySeconds(), PoolInitInfo.CooldownTimeSeconds, PoolStats.NumUnpoolHits, PoolStats.NumMisses, PoolStats.NumLazyCreations });
+
+		// Each log is based on the pools unique memory address and the GPlayInEditorID to ensure we can differentiate between pools even in the same PIE session.
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+		uint64 UniqueKey = GetTypeHash(reinterpret_cast<uint64>(this)) + GPlayInEditorID;
+#else
+		uint64 UniqueKey = GetTypeHash(reinterpret_cast<uint64>(this)) + UE::GetPlayInEditorID();
+#endif
+
+		if(World->GetNetMode() == NM_DedicatedServer || !GEngine)
+			UE_LOGFMT(LogTemp, Warning, "{0}", FormatString);
+		else
+			GEngine->AddOnScreenDebugMessage(UniqueKey, 8.f, FColor::Green, FormatString);
+	}
+#endif
+	
+	EvaluatePoolOccupancy();
+	EvaluateAdaptiveSizing();
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::EvaluatePoolOccupancy()
+{
+	bPendingEviction = false;
+	if(GetMaxObjectInactiveOccupancySeconds() < 0.f || PoolInitInfo.bNetworked)
+		return false;
+	
+	float SecondsNow = GetWorld()->GetTimeSeconds();
+	const int32 MaxEvictions = PoolInitInfo.PoolTickInfo.MaxEvictionsPerTick;
+	const float BudgetMs = PoolInitInfo.PoolTickInfo.EvictionBudgetMs;
+	const double EndTime = BudgetMs > 0.f ? FPlatformTime::Seconds() + BudgetMs / 1000.0 : 0.0;
+	
+	// The inactive list is ordered oldest first so we only ever walk the expired prefix.
+	int NumRemoved = 0;
+	for(int64 ID = PoolContainer->GetOldestInactive(); ID != -1; ID = PoolContainer->GetOldestInactive())
+	{
+		float Delta = SecondsNow - PoolContainer->FindPooledObjectChecked(ID).LastTimeActive;
+		if(Delta < GetMaxObjectInactiveOccupancySeconds())
+			break;
+
+		if((MaxEvictions > 0 && NumRemoved >= MaxEvictions) || (EndTime > 0.0 && NumRemoved > 0 && FPlatformTime::Seconds() >= EndTime))
+		{
+			// Out of budget with expired objects left, carry on next frame rather than waiting a whole tick interval.
+			bPendingEviction = true;
+			PoolContainer->RequestUpkeep();
+			break;
+		}
+		
+		DestroyPoolEntry(ID);
+		++NumRemoved;
+	}
+
+	if(NumRemoved > 0)
+		RecordPoolStat(EBFObjectPoolStat::Eviction, NumRemoved);
+
+#if !UE_BUILD_SHIPPING
+	if(NumRemoved > 0 && BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+		UE_LOGFMT(LogTemp, Warning, "Removed {0} objects from the pool due to exceeding the MaxObjectInactiveOccupancySeconds", NumRemoved);
+#endif
+
+	return NumRemoved > 0;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::EvaluateAdaptiveSizing()
+{
+	if(!bAdaptiveSizing || !IsValid(PoolContainer))
+		return;
+
+	const FBFObjectPoolAdaptiveSizingParams& Params = PoolInitInfo.AdaptiveSizing;
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+
+	// Roll the window forward, reused slices start at the current active count since those objects are still out.
+	const float SliceSeconds = FMath::Max(Params.WindowSeconds, 0.1f) / NumDemandSlices;
+	const int32 NumToAdvance = FMath::FloorToInt32((SecondsNow - DemandSliceStartTime) / SliceSeconds);
+	for(int32 Count = 0; Count < FMath::Min(NumToAdvance, NumDemandSlices); ++Count)
+	{
+		CurrentDemandSlice = (CurrentDemandSlice + 1) % NumDemandSlices;
+		DemandSlices[CurrentDemandSlice] = FBFObjectPoolDemandStats();
+		DemandSlices[CurrentDemandSlice].PeakActive = GetActivePoolSize();
+	}
+	if(NumToAdvance > 0)
+		DemandSliceStartTime = NumToAdvance >= NumDemandSlices ? SecondsNow : DemandSliceStartTime + NumToAdvance * SliceSeconds;
+
+	// Misses mean the limit itself is too low, grow by at least a quarter so a sustained burst doesn't creep up one object per evaluation.
+	if(NumMissesSinceEvaluation > 0 && Params.MaxPoolLimit > PoolInitInfo.PoolLimit)
+	{
+		const int32 NewLimit = FMath::Min(Params.MaxPoolLimit, PoolInitInfo.PoolLimit + FMath::Max(NumMissesSinceEvaluation, PoolInitInfo.PoolLimit / 4));
+#if !UE_BUILD_SHIPPING
+		if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+			UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Pool {0} missed {1} un-pools, growing its limit from {2} to {3}.", GetNameSafe(PoolInitInfo.PoolClass), NumMissesSinceEvaluation, PoolInitInfo.PoolLimit, NewLimit);
+#endif
+		SetPoolLimit(NewLimit);
+	}
+	NumMissesSinceEvaluation = 0;
+
+	const FBFObjectPoolDemandStats Stats = GetDemandStats();
+	const int32 DesiredSize = FMath::Clamp(FMath::CeilToInt32(Stats.PeakActive * (1.f + Params.Headroom)), FMath::Min(PoolInitInfo.InitialCount, PoolInitInfo.PoolLimit), PoolInitInfo.PoolLimit);
+	if(GetPoolSize() <= DesiredSize)
+	{
+		OversizedSinceTime = -1.f;
+		if(GetPoolSize() < DesiredSize)
+			Reserve(DesiredSize - GetActivePoolSize());
+		return;
+	}
+
+	// Bigger than demand needs, wait it out in case it picks back up before trimming a few at a time. Never fight a prewarm/Reserve in progress.
+	if(OversizedSinceTime < 0.f)
+		OversizedSinceTime = SecondsNow;
+	if(IsPrewarming() || PoolInitInfo.bNetworked || SecondsNow - OversizedSinceTime < Params.ShrinkDelaySeconds)
+		return;
+
+	const int32 NumToRemove = FMath::Min3(GetPoolSize() - DesiredSize, GetInactivePoolSize(), FMath::Max(Params.MaxShrinkPerEvaluation, 1));
+	if(NumToRemove > 0 && RemoveInactiveNumFromPool(NumToRemove))
+		RecordPoolStat(EBFObjectPoolStat::Eviction, NumToRemove);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+FBFObjectPoolDemandStats TBFObjectPool<T, Mode>::GetDemandStats() const
+{
+	FBFObjectPoolDemandStats Stats;
+	for(const FBFObjectPoolDemandStats& Slice : DemandSlices)
+	{
+		Stats.NumUnpools += Slice.NumUnpools;
+		Stats.NumMisses += Slice.NumMisses;
+		Stats.PeakActive = FMath::Max(Stats.PeakActive, Slice.PeakActive);
+	}
+	return Stats;
+}
+
+
+template <typename T, ESPMode Mode> 
+requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::Reset()
+{
+	OnObjectAddedToPool.Clear();
+	OnObjectRemovedFromPool.Clear();
+	OnPrewarmProgress.Clear();
+	OnPrewarmComplete.Clear();
+	OnPoolReady.Clear();
+	PoolContainer = nullptr;
+	PreloadHandle.Reset();
+	bIsLoadingAssets = false;
+	bPendingPoolReady = false;
+	PoolInitInfo.Reset();
+	NumPendingPrewarm = 0;
+	NumPrewarmRequested = 0;
+	PrewarmDeadline = -1.f;
+	bPendingEviction = false;
+	bPendingDormancy = false;
+	bPendingOverflowTrim = false;
+	NextDormancyTime = 0.f;
+	DemandSlices = TStaticArray<FBFObjectPoolDemandStats, NumDemandSlices>();
+	CurrentDemandSlice = 0;
+	NumMissesSinceEvaluation = 0;
+	OversizedSinceTime = -1.f;
+	bIsActivateObjectOverridden = false;
+	bIsDeactivateObjectOverridden = false;
+	InterfaceDispatch = FBFPooledObjectInterfaceDispatch();
+	ClassDispatches.Reset();
+	bAdaptiveSizing = false;
+	ConcurrentState.Reset();
+	NumConcurrentStaged = 0;
+	DeferredReturnIDs.Reset();
+	DeferredReturnCheckoutIDs.Reset();
+}
+
+
+template <typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::SetPoolLimit(int32 PoolLimit)
+{
+	if(PoolLimit == PoolInitInfo.PoolLimit)
+		return true;
+
+	if(PoolLimit > PoolInitInfo.PoolLimit)
+	{
+		// The slot array workers index into was reserved at init and must never reallocate.
+		if(ConcurrentState.IsValid() && PoolLimit > ConcurrentState->ReadySlots.GetCapacity())
+		{
+#if !UE_BUILD_SHIPPING
+			if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+				UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Pool {0} is used from worker threads and can't grow past the {1} objects it reserved at init.", GetNameSafe(PoolInitInfo.PoolClass), ConcurrentState->ReadySlots.GetCapacity());
+#endif
+			return false;
+		}
+		PoolInitInfo.PoolLimit = PoolLimit;
+		return true;
+	}
+
+	int32 CurrentPoolSize = GetPoolSize();
+	int32 InactivePoolSize = GetInactivePoolSize();
+
+	// If we don't have enough inactive objects to reach the new limit then we can't do anything
+	if(CurrentPoolSize - InactivePoolSize <= PoolLimit)
+	{
+		// Now check to see if we can fit without trimming some objects.
+		if(CurrentPoolSize <= PoolLimit)
+		{
+			PoolInitInfo.PoolLimit = PoolLimit;
+			return true;
+		}
+
+		RemoveInactiveNumFromPool(CurrentPoolSize - PoolLimit);
+		PoolInitInfo.PoolLimit = PoolLimit;
+		return true;
+	}
+
+	return false;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::SetMaxObjectInactiveOccupancySeconds(float MaxObjectInactiveOccupancySeconds)
+{
+	// You must call Init on your pool before trying to use anything on it.
+	bfEnsure(IsValid(PoolContainer));
+	
+	// Ensure that we are ticking if we have a value that's useful.
+	if(MaxObjectInactiveOccupancySeconds > 0.f)
+		PoolContainer->SetTickEnabled(true);
+	else
+	{
+		PoolContainer->SetTickEnabled(bAdaptiveSizing); // Adaptive sizing still needs the tick.
+		MaxObjectInactiveOccupancySeconds = -1.f;
+	}
+
+	PoolInitInfo.PoolTickInfo.MaxObjectInactiveOccupancySeconds = MaxObjectInactiveOccupancySeconds;
+}
+
+
+template <typename T, ESPMode Mode> 
+requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::SetTickInterval(float InTickInterval)
+{
+	// You must call Init on your pool before trying to use anything on it.
+	bfEnsure(IsValid(PoolContainer));
+	PoolContainer->SetTickInterval(InTickInterval);
+	PoolInitInfo.PoolTickInfo.TickInterval = InTickInterval;
+}
+
+
+template <typename T, ESPMode Mode> 
+requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::SetTickEnabled(bool bEnable)
+{
+	// You must call Init on your pool before trying to use anything on it.
+	bfEnsure(IsValid(PoolContainer));
+	PoolContainer->SetTickEnabled(bEnable);
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+FBFPooledObjectInfo* TBFObjectPool<T, Mode>::CreateNewPoolEntry(bool bIgnorePoolLimit, UClass* ObjectClass)
 {
 	SCOPED_NAMED_EVENT(TBFObjectPool_CreateNewPoolEntry, FColor::Green);
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_CreatePoolEntry);
+	LLM_SCOPE_BYTAG(BFObjectPool);
 	// You must call Init on your pool before trying to use anything on it.
 	bfEnsure(IsValid(PoolContainer));
 	
-	if(GetPoolSize() >= PoolInitInfo.PoolLimit)
+	if(GetPoolSize() >= PoolInitInfo.PoolLimit && !bIgnorePoolLimit)
 		return nullptr;
 
 	EObjectFlags Flags = PoolInitInfo.ObjectFlags == RF_NoFlags ? RF_Transient : PoolInitInfo.ObjectFlags;
-	
+	UClass* Class = ObjectClass ? ObjectClass : PoolInitInfo.PoolClass;
 
 	UObject* Object = nullptr;
 	switch (GetPoolType())
@@ -646,10 +1777,17 @@ FBFPooledObjectInfo* TBFObjectPool<T, Mode>::CreateNewPoolEntry()
 			SpawnParams.Owner = Cast<AActor>(PoolInitInfo.Owner.Get()); // Perfectly valid if the pool isn't owned by an AActor
 			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 			SpawnParams.ObjectFlags = Flags;
-			NewPoolObject = PoolInitInfo.Owner->GetWorld()->SpawnActor<AActor>(PoolInitInfo.PoolClass, SpawnParams);
+			NewPoolObject = PoolInitInfo.Owner->GetWorld()->SpawnActor<AActor>(Class, SpawnParams);
+			if(!NewPoolObject) // The world refuses spawns while it is being torn down.
+				break;
+			
 			NewPoolObject->SetActorTickEnabled(false);
 			NewPoolObject->SetActorHiddenInGame(true);
 			NewPoolObject->SetActorEnableCollision(false);
+
+			// Opens the channel once (hidden) and lets it go dormant, so prewarming also prewarms the clients.
+			if(PoolInitInfo.bNetworked)
+				SetPooledActorNetDormant(NewPoolObject, true);
 				
 			Object = NewPoolObject;
 			break;
@@ -657,7 +1795,10 @@ FBFPooledObjectInfo* TBFObjectPool<T, Mode>::CreateNewPoolEntry()
 		case EBFPoolType::Component:
 		{
 			UActorComponent* NewPoolObject = nullptr;
-			NewPoolObject = NewObject<UActorComponent>(PoolInitInfo.Owner.Get(), PoolInitInfo.PoolClass, NAME_None, Flags);
+			NewPoolObject = NewObject<UActorComponent>(PoolInitInfo.Owner.Get(), Class, NAME_None, Flags);
+			if(!NewPoolObject)
+				break;
+			
 			NewPoolObject->bAutoActivate = false;
 
 			if(AActor* Actor = Cast<AActor>(PoolInitInfo.Owner))
@@ -674,237 +1815,1019 @@ FBFPooledObjectInfo* TBFObjectPool<T, Mode>::CreateNewPoolEntry()
 			UUserWidget* NewPoolObject = nullptr;
 
 			// Static assert inside forces me to compile time choose the owner, please use APlayerController when pooling widgets.
-			NewPoolObject = CreateWidget<UUserWidget>(CastChecked<APlayerController>(PoolInitInfo.Owner.Get()), PoolInitInfo.PoolClass);
-			NewPoolObject->AddToViewport();
-			NewPoolObject->SetVisibility(ESlateVisibility::Hidden); // Hide it by default until we un-pool the widget.
+			NewPoolObject = CreateWidget<UUserWidget>(CastChecked<APlayerController>(PoolInitInfo.Owner.Get()), Class);
+			if(!NewPoolObject) // Null for abstract/deprecated classes or an owning player without a game instance.
+				break;
+			
+			if(PoolInitInfo.bVirtualizeWidgets)
+			{
+				// Never attached until un-pooled, the wrapper (if any) is kept as the widgets parent for its whole life.
+				UContentWidget* Wrapper = nullptr;
+				if(PoolInitInfo.WidgetWrapper == EBFPooledWidgetWrapper::InvalidationBox)
+					Wrapper = NewObject<UInvalidationBox>(NewPoolObject, NAME_None, RF_Transient);
+				else if(PoolInitInfo.WidgetWrapper == EBFPooledWidgetWrapper::RetainerBox)
+					Wrapper = NewObject<URetainerBox>(NewPoolObject, NAME_None, RF_Transient);
+				if(Wrapper)
+					Wrapper->SetContent(NewPoolObject);
+				NewPoolObject->SetVisibility(ESlateVisibility::Collapsed);
+			}
+			else
+			{
+				NewPoolObject->AddToViewport();
+				NewPoolObject->SetVisibility(ESlateVisibility::Hidden); // Hide it by default until we un-pool the widget.
+			}
 				
 			Object = NewPoolObject;
 			break;
 		}
-		case EBFPoolType::Object: Object = NewObject<UObject>(PoolInitInfo.Owner.Get(), PoolInitInfo.PoolClass, NAME_None, Flags); break;
-		case EBFPoolType::Invalid: bfEnsure(false); return nullptr;
+		case EBFPoolType::Object: Object = NewObject<UObject>(PoolInitInfo.Owner.Get(), Class, NAME_None, Flags); break;
+		case EBFPoolType::Invalid: bfEnsure(false); return nullptr;
+	}
+	
+	// Nothing has touched the container yet, callers treat a null entry like being at the limit (a miss).
+	if(!IsValid(Object))
+	{
+#if !UE_BUILD_SHIPPING
+		if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+			UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Failed to create a {0} for pool owned by {1}, the world may be tearing down.", GetNameSafe(Class), GetNameSafe(PoolInitInfo.Owner.Get()));
+#endif
+		return nullptr;
+	}
+	
+	// Add a small initial offset to the LastActiveTime in the case when using a cooldown time, this ensures the first pooling doesn't block instant access.
+	float CooldownOffset = PoolInitInfo.CooldownTimeSeconds > 0 ? PoolInitInfo.CooldownTimeSeconds + KINDA_SMALL_NUMBER : 0.f;
+
+	// The container assigns the pool ID and checkout ID when claiming the slot.
+	FBFPooledObjectInfo& Info = PoolContainer->AddPooledObject(Object);
+	Info.CreationTime = GetWorld()->GetTimeSeconds();
+	Info.LastTimeActive = GetWorld()->GetTimeSeconds() - CooldownOffset;
+	
+	const int64 PoolID = Info.ObjectPoolID;
+	const int32 CheckoutID = Info.ObjectCheckoutID;
+	if(PoolInitInfo.bVirtualizeWidgets)
+		PoolContainer->RetainSlateWidget(BF::OP::GetPoolIDSlotIndex(PoolID), GetPooledWidgetRoot((UUserWidget*)Object)->TakeWidget());
+
+	GetInterfaceDispatch(Object).OnObjectCreated(Object);
+
+	CacheObjectGameplayTag(PoolID);
+	PoolContainer->AddInactive(PoolID);
+	RequestDormancyEvaluation(GetWorld()->GetTimeSeconds() + PoolInitInfo.DormancyDelaySeconds);
+	
+	OnObjectAddedToPool.Broadcast(PoolID, CheckoutID, Object);
+
+	// Look the entry up again rather than returning Info, the callbacks above are free to add entries which may have reallocated the slot array.
+	return PoolContainer->FindPooledObject(PoolID);
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+TBFPooledObjectHandlePtr<T, Mode> TBFObjectPool<T, Mode>::UnpoolObject(bool bAutoActivate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_UnpoolObject);
+	const int64 PoolID = GetNextUnpoolID();
+	return PoolID != -1 ? CheckoutObject(PoolID, bAutoActivate) : nullptr;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+TBFPooledObjectLiteHandle<T> TBFObjectPool<T, Mode>::UnpoolObjectLite(bool bAutoActivate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_UnpoolObject);
+	const int64 PoolID = GetNextUnpoolID();
+	return PoolID != -1 ? CheckoutObjectLite(PoolID, bAutoActivate) : TBFPooledObjectLiteHandle<T>();
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::UnpoolObjects(int32 Num, TArray<TBFPooledObjectHandlePtr<T, Mode>>& OutHandles, bool bAutoActivate)
+{
+	SCOPED_NAMED_EVENT(TBFObjectPool_UnpoolObjects, FColor::Green);
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_UnpoolObject);
+	TArray<int64, TInlineAllocator<32>> IDs;
+	TArray<int32, TInlineAllocator<32>> CheckoutIDs;
+	BeginCheckoutBatch(Num, IDs, CheckoutIDs);
+
+	// Handles are built before any activation for the same reason as CheckoutObject.
+	LLM_SCOPE_BYTAG(BFObjectPool);
+	const TWeakPtr<TBFObjectPool, Mode> WeakThis(this->AsWeak());
+	OutHandles.Reserve(OutHandles.Num() + IDs.Num());
+	for(const int64 PoolID : IDs)
+		OutHandles.Add(MakeShared<TBFPooledObjectHandle<T, Mode>, Mode>(&PoolContainer->FindPooledObjectChecked(PoolID), WeakThis));
+
+	FinishCheckoutBatch(IDs, CheckoutIDs, bAutoActivate);
+	return IDs.Num();
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::UnpoolObjectsLite(int32 Num, TArray<TBFPooledObjectLiteHandle<T>>& OutHandles, bool bAutoActivate)
+{
+	SCOPED_NAMED_EVENT(TBFObjectPool_UnpoolObjectsLite, FColor::Green);
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_UnpoolObject);
+	TArray<int64, TInlineAllocator<32>> IDs;
+	TArray<int32, TInlineAllocator<32>> CheckoutIDs;
+	BeginCheckoutBatch(Num, IDs, CheckoutIDs);
+
+	OutHandles.Reserve(OutHandles.Num() + IDs.Num());
+	for(int32 Index = 0; Index < IDs.Num(); ++Index)
+		OutHandles.Emplace(PoolContainer, BF::OP::GetPoolIDSlotIndex(IDs[Index]), CheckoutIDs[Index]);
+
+	FinishCheckoutBatch(IDs, CheckoutIDs, bAutoActivate);
+	return IDs.Num();
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int64 TBFObjectPool<T, Mode>::GetNextUnpoolID()
+{
+	bfEnsure(IsValid(PoolContainer) && IsValid(PoolInitInfo.Owner)); // have you initialized the pool?
+	// Might not have any free but we have space to make more.
+	if(GetInactivePoolSize() == 0)
+	{
+		if(GetPoolSize() < PoolInitInfo.PoolLimit)
+		{
+			if(!CreateNewPoolEntry())
+			{
+				RecordMisses(1);
+				return -1;
+			}
+			RecordPoolStat(EBFObjectPoolStat::LazyCreation);
+		}
+		else
+		{
+			const int64 OverflowID = GetOverflowUnpoolID();
+			if(OverflowID != -1)
+				return OverflowID;
+			
+#if !UE_BUILD_SHIPPING
+			if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+				UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Trying to get a pooled object for {0} but all current objects are active and pool {1} is at capacity.", GetOwner()->GetName(), PoolInitInfo.PoolClass->GetName());
+#endif
+			RecordMisses(1);
+			return -1;
+		}
+	}
+
+	// If we aren't using a cooldowns then we can speed up this by just taking the most recently returned object, it is the most likely to still be warm
+	// and it lets the oldest objects age out via the occupancy evaluation.
+	float Cooldown = PoolInitInfo.CooldownTimeSeconds;
+	if(Cooldown < KINDA_SMALL_NUMBER)
+		return PoolContainer->GetNewestInactive();
+
+	// The inactive list is ordered oldest to newest so only the head can have been inactive for longer than the cooldown time, if it hasn't then nothing has.
+	const int64 OldestID = PoolContainer->GetOldestInactive();
+	if(GetWorld()->GetTimeSeconds() - PoolContainer->FindPooledObjectChecked(OldestID).LastTimeActive >= Cooldown)
+		return OldestID;
+
+	// This means nothing in the inactive pool met our threshold, check one last time if we can make one.
+	RecordPoolStat(EBFObjectPoolStat::CooldownRejection);
+	if(GetPoolSize() < PoolInitInfo.PoolLimit)
+	{
+		// Spawning/NewObject can fail (world teardown etc.), the caller treats -1 as a miss.
+		const FBFPooledObjectInfo* Info = CreateNewPoolEntry();
+		if(!Info)
+		{
+			RecordMisses(1);
+			return -1;
+		}
+		RecordPoolStat(EBFObjectPoolStat::LazyCreation);
+		return Info->ObjectPoolID;
+	}
+
+	const int64 OverflowID = GetOverflowUnpoolID();
+	if(OverflowID != -1)
+		return OverflowID;
+	
+	RecordMisses(1);
+	return -1;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int64 TBFObjectPool<T, Mode>::GetOverflowUnpoolID(int32 MaxRecyclable)
+{
+	switch(PoolInitInfo.OverflowPolicy)
+	{
+		case EBFPoolOverflowPolicy::RecycleOldest:
+		case EBFPoolOverflowPolicy::RecycleLowestPriority:
+		{
+			// Anything still inactive is on cooldown, handing out an object returned this instant would defeat the point of it.
+			if(MaxRecyclable <= 0 || GetInactivePoolSize() > 0)
+				return -1;
+			
+			const int64 VictimID = PoolInitInfo.OverflowPolicy == EBFPoolOverflowPolicy::RecycleOldest ?
+				PoolContainer->GetOldestActive() : PoolContainer->FindLowestPriorityActive(MaxRecyclable);
+			const FBFPooledObjectInfo* Victim = PoolContainer->FindPooledObject(VictimID);
+			if(!Victim)
+				return -1;
+
+			// A regular return, the checkout ID is bumped so every handle to the old checkout (shared or lite) is invalidated.
+			const int32 NewCheckoutID = ReturnEntry(VictimID, Victim->ObjectCheckoutID, GetWorld()->GetTimeSeconds());
+			if(NewCheckoutID == -1)
+				return -1;
+			
+			OnObjectPooled.Broadcast(true, VictimID, NewCheckoutID);
+			RecordOverflow();
+
+			// Deactivation or a listener may have un-pooled/removed it again already.
+			const FBFPooledObjectInfo* Recycled = PoolContainer->FindPooledObject(VictimID);
+			return Recycled && !Recycled->bActive && Recycled->ObjectCheckoutID == NewCheckoutID ? VictimID : -1;
+		}
+		case EBFPoolOverflowPolicy::GrowTemporarily:
+		{
+			if(PoolInitInfo.MaxTemporaryObjects > 0 && GetPoolSize() >= PoolInitInfo.PoolLimit + PoolInitInfo.MaxTemporaryObjects)
+				return -1;
+
+			const FBFPooledObjectInfo* Info = CreateNewPoolEntry(true);
+			if(!Info)
+				return -1;
+			
+			RecordPoolStat(EBFObjectPoolStat::LazyCreation);
+			RecordOverflow();
+			return Info->ObjectPoolID;
+		}
+		default: return -1;
+	}
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::TrimTemporaryObjects()
+{
+	bPendingOverflowTrim = false;
+	
+	// Anything still checked out triggers another trim when it is returned.
+	int32 NumTrimmed = 0;
+	while(GetPoolSize() > PoolInitInfo.PoolLimit && GetInactivePoolSize() > 0)
+	{
+		DestroyPoolEntry(PoolContainer->GetOldestInactive());
+		++NumTrimmed;
+	}
+
+	if(NumTrimmed > 0)
+		RecordPoolStat(EBFObjectPoolStat::Eviction, NumTrimmed);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+TBFPooledObjectHandlePtr<T, Mode> TBFObjectPool<T, Mode>::CheckoutObject(int64 PoolID, bool bAutoActivate)
+{
+	LLM_SCOPE_BYTAG(BFObjectPool);
+	const int32 CheckoutID = BeginCheckout(PoolID);
+	TBFPooledObjectHandlePtr<T, Mode> Handle = MakeShared<TBFPooledObjectHandle<T, Mode>, Mode>(&PoolContainer->FindPooledObjectChecked(PoolID), TWeakPtr<TBFObjectPool, Mode>(this->AsWeak()));
+	FinishCheckout(PoolID, CheckoutID, bAutoActivate);
+	return Handle;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+TBFPooledObjectLiteHandle<T> TBFObjectPool<T, Mode>::CheckoutObjectLite(int64 PoolID, bool bAutoActivate)
+{
+	const int32 CheckoutID = BeginCheckout(PoolID);
+	TBFPooledObjectLiteHandle<T> Handle{PoolContainer, BF::OP::GetPoolIDSlotIndex(PoolID), CheckoutID};
+	FinishCheckout(PoolID, CheckoutID, bAutoActivate);
+	return Handle;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::BeginCheckout(int64 PoolID)
+{
+	PoolContainer->RemoveInactive(PoolID);
+	
+	FBFPooledObjectInfo& Info = PoolContainer->FindPooledObjectChecked(PoolID);
+	Info.ObjectCheckoutID = BF::OP::NextCheckoutID(Info.ObjectCheckoutID);
+	Info.bActive = true;
+	Info.RecyclePriority = 0;
+	PoolContainer->AddActive(PoolID);
+	PoolContainer->RecordSizingActive(GetActivePoolSize());
+	++NumCheckouts;
+	RecordPoolStat(EBFObjectPoolStat::UnpoolHit);
+
+	// The checkout may have come out of the awake reserve, wake the next dormant ones on the upkeep rather than when they are un-pooled.
+	if(PoolInitInfo.DormancyAwakeReserve > 0)
+		RequestDormancyEvaluation(GetWorld()->GetTimeSeconds());
+
+	if(bAdaptiveSizing)
+	{
+		FBFObjectPoolDemandStats& Slice = DemandSlices[CurrentDemandSlice];
+		++Slice.NumUnpools;
+		Slice.PeakActive = FMath::Max(Slice.PeakActive, GetActivePoolSize());
+	}
+	return Info.ObjectCheckoutID;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::FinishCheckout(int64 PoolID, int32 CheckoutID, bool bAutoActivate)
+{
+	// Activation and IF calls may add entries to the pool which can reallocate the slot array, so nothing from the slot is held across this.
+	WakeDormantObject(PoolID);
+	ActivateObject(CastChecked<T>(PoolContainer->FindPooledObjectChecked(PoolID).PooledObject), bAutoActivate);
+	OnObjectPooled.Broadcast(false, PoolID, CheckoutID);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::BeginCheckoutBatch(int32 Num, TArray<int64, TInlineAllocator<32>>& OutIDs, TArray<int32, TInlineAllocator<32>>& OutCheckoutIDs)
+{
+	bfEnsure(IsValid(PoolContainer) && IsValid(PoolInitInfo.Owner)); // have you initialized the pool?
+	if(Num <= 0)
+		return;
+
+	OutIDs.Reserve(Num);
+	OutCheckoutIDs.Reserve(Num);
+
+	// Same picking rules as GetNextUnpoolID, newest first without a cooldown, otherwise oldest first for as long as the head is off cooldown.
+	const float Cooldown = PoolInitInfo.CooldownTimeSeconds;
+	const bool bUseCooldown = Cooldown >= KINDA_SMALL_NUMBER;
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+	while(OutIDs.Num() < Num)
+	{
+		const int64 PoolID = bUseCooldown ? PoolContainer->GetOldestInactive() : PoolContainer->GetNewestInactive();
+		if(PoolID == -1)
+			break;
+		if(bUseCooldown && SecondsNow - PoolContainer->FindPooledObjectChecked(PoolID).LastTimeActive < Cooldown)
+		{
+			RecordPoolStat(EBFObjectPoolStat::CooldownRejection);
+			break;
+		}
+
+		OutIDs.Add(PoolID);
+		OutCheckoutIDs.Add(BeginCheckout(PoolID));
+	}
+
+	// Whatever the inactive objects couldn't cover is created in one go, reserving up front so the slot array grows at most once.
+	const int32 NumToCreate = FMath::Min(Num - OutIDs.Num(), PoolInitInfo.PoolLimit - GetPoolSize());
+	if(NumToCreate > 0)
+	{
+		PoolContainer->ReserveSlots(GetPoolSize() + NumToCreate);
+		for(int32 Count = 0; Count < NumToCreate; ++Count)
+		{
+			const FBFPooledObjectInfo* Info = CreateNewPoolEntry();
+			if(!Info)
+				break;
+
+			const int64 PoolID = Info->ObjectPoolID;
+			OutIDs.Add(PoolID);
+			OutCheckoutIDs.Add(BeginCheckout(PoolID));
+			RecordPoolStat(EBFObjectPoolStat::LazyCreation);
+		}
+	}
+
+	// Only the objects that were already out before this batch may be recycled, they are the oldest in the active list so the batches own checkouts sit behind them.
+	const int32 NumCheckedOut = OutIDs.Num();
+	int32 NumRecyclable = GetActivePoolSize() - NumCheckedOut;
+	while(OutIDs.Num() < Num && PoolInitInfo.OverflowPolicy != EBFPoolOverflowPolicy::Fail)
+	{
+		const int64 PoolID = GetOverflowUnpoolID(NumRecyclable--);
+		if(PoolID == -1)
+			break;
+		
+		OutIDs.Add(PoolID);
+		OutCheckoutIDs.Add(BeginCheckout(PoolID));
+	}
+	
+	if(OutIDs.Num() < Num)
+		RecordMisses(Num - OutIDs.Num());
+
+#if !UE_BUILD_SHIPPING
+	if(OutIDs.Num() < Num && BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Batch un-pool for {0} asked for {1} objects but only {2} were available, pool {3} is at capacity.", GetOwner()->GetName(), Num, OutIDs.Num(), PoolInitInfo.PoolClass->GetName());
+#endif
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::FinishCheckoutBatch(TConstArrayView<int64> IDs, TConstArrayView<int32> CheckoutIDs, bool bAutoActivate)
+{
+	for(const int64 PoolID : IDs)
+	{
+		// An earlier objects activation is free to return/steal a later one, so look each up rather than assuming it is still here.
+		WakeDormantObject(PoolID);
+		if(const FBFPooledObjectInfo* Info = PoolContainer->FindPooledObject(PoolID))
+			ActivateObject(CastChecked<T>(Info->PooledObject), bAutoActivate);
+	}
+
+	if(IDs.Num() > 0)
+		OnObjectsPooledBatch.Broadcast(false, IDs, CheckoutIDs);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+TBFPooledObjectHandlePtr<T, Mode> TBFObjectPool<T, Mode>::UnpoolObjectByTag(FGameplayTag Tag, bool bAutoActivate, bool bExactMatch)
+{
+	if(GetInactivePoolSize() == 0 || !Tag.IsValid())
+		return nullptr;
+
+	const int64 FoundID = PoolContainer->FindInactiveByTag(Tag, bExactMatch);
+	return FoundID != -1 ? CheckoutObject(FoundID, bAutoActivate) : nullptr;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+TBFPooledObjectHandlePtr<T, Mode> TBFObjectPool<T, Mode>::UnpoolObjectByTags(const FGameplayTagContainer& Tags, bool bAutoActivate, bool bExactMatch)
+{
+	if(GetInactivePoolSize() == 0 || Tags.IsEmpty())
+		return nullptr;
+
+	const int64 FoundID = PoolContainer->FindInactiveByTags(Tags, bExactMatch);
+	return FoundID != -1 ? CheckoutObject(FoundID, bAutoActivate) : nullptr;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::CacheObjectGameplayTag(int64 PoolID)
+{
+	FBFPooledObjectInfo& Info = PoolContainer->FindPooledObjectChecked(PoolID);
+	bfEnsure(Info.TagBucketIndex == INDEX_NONE); // Re-caching while bucketed would leave the bucket pointing at the old tag.
+	
+	Info.CachedGameplayTag = GetInterfaceDispatch(Info.PooledObject).GetObjectGameplayTag(Info.PooledObject);
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::ReturnToPool(TBFPooledObjectHandlePtr<T, Mode>& Handle)
+{
+	if(!Handle.IsValid() || !Handle->IsHandleValid())
+	{
+		Handle = nullptr;
+		return false;
+	}
+
+	// Returning bumps the checkout ID so every copy of this handle is invalidated, including the one we are about to release.
+	const bool bResult = ReturnToPool_Internal(Handle->GetPoolID(), Handle->GetCheckoutID());
+	Handle = nullptr;
+	return bResult;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::ReturnToPool(TArrayView<TBFPooledObjectHandlePtr<T, Mode>> Handles)
+{
+	SCOPED_NAMED_EVENT(TBFObjectPool_ReturnToPoolBatch, FColor::Green);
+	TArray<int64, TInlineAllocator<32>> IDs;
+	TArray<int32, TInlineAllocator<32>> CheckoutIDs;
+	IDs.Reserve(Handles.Num());
+	CheckoutIDs.Reserve(Handles.Num());
+	
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+	for(TBFPooledObjectHandlePtr<T, Mode>& Handle : Handles)
+	{
+		if(Handle.IsValid() && Handle->IsHandleValid())
+		{
+			const int64 PoolID = Handle->GetPoolID();
+			const int32 NewCheckoutID = PoolInitInfo.bDeferReturns ? DeferReturn(PoolID, Handle->GetCheckoutID()) : ReturnEntry(PoolID, Handle->GetCheckoutID(), SecondsNow);
+			if(NewCheckoutID != -1)
+			{
+				IDs.Add(PoolID);
+				CheckoutIDs.Add(NewCheckoutID);
+			}
+		}
+		Handle = nullptr;
+	}
+
+	// Deferred returns are broadcast together when they are processed.
+	if(IDs.Num() > 0 && !PoolInitInfo.bDeferReturns)
+		OnObjectsPooledBatch.Broadcast(true, IDs, CheckoutIDs);
+	return IDs.Num();
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::ReturnToPool(TArrayView<TBFPooledObjectLiteHandle<T>> Handles)
+{
+	SCOPED_NAMED_EVENT(TBFObjectPool_ReturnToPoolLiteBatch, FColor::Green);
+	TArray<int64, TInlineAllocator<32>> IDs;
+	TArray<int32, TInlineAllocator<32>> CheckoutIDs;
+	IDs.Reserve(Handles.Num());
+	CheckoutIDs.Reserve(Handles.Num());
+	
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+	for(TBFPooledObjectLiteHandle<T>& Handle : Handles)
+	{
+		// Lite handles from another pool still get returned, just through their own pool.
+		if(Handle.GetContainer() != PoolContainer)
+		{
+			Handle.ReturnToPool();
+			continue;
+		}
+		
+		const int64 PoolID = Handle.GetPoolID();
+		const int32 NewCheckoutID = PoolID == -1 ? -1 : PoolInitInfo.bDeferReturns ? DeferReturn(PoolID, Handle.GetCheckoutID()) : ReturnEntry(PoolID, Handle.GetCheckoutID(), SecondsNow);
+		if(NewCheckoutID != -1)
+		{
+			IDs.Add(PoolID);
+			CheckoutIDs.Add(NewCheckoutID);
+		}
+		Handle.Invalidate();
+	}
+
+	if(IDs.Num() > 0 && !PoolInitInfo.bDeferReturns)
+		OnObjectsPooledBatch.Broadcast(true, IDs, CheckoutIDs);
+	return IDs.Num();
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::ReturnToPool_Internal(int64 PoolID, int32 ObjectCheckoutID)
+{
+	if constexpr (Mode == ESPMode::ThreadSafe)
+	{
+		// A worker checkout that hasn't been replayed yet goes through the queue behind its checkout, so activation and deactivation stay paired.
+		if(!IsInGameThread() || IsConcurrentCheckoutPending(PoolID))
+			return ReturnToPoolConcurrent(PoolID, ObjectCheckoutID);
+	}
+
+	if(PoolInitInfo.bDeferReturns)
+		return DeferReturn(PoolID, ObjectCheckoutID) != -1;
+	
+	const int32 NewCheckoutID = ReturnEntry(PoolID, ObjectCheckoutID, GetWorld()->GetTimeSeconds());
+	if(NewCheckoutID == -1)
+		return false;
+	
+	OnObjectPooled.Broadcast(true, PoolID, NewCheckoutID);
+	return true;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::ReturnEntry(int64 PoolID, int32 ObjectCheckoutID, float SecondsNow)
+{
+	const int32 NewCheckoutID = BeginReturn(PoolID, ObjectCheckoutID);
+	if(NewCheckoutID != -1)
+		FinishReturn(PoolID, SecondsNow);
+	return NewCheckoutID;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::BeginReturn(int64 PoolID, int32 ObjectCheckoutID)
+{
+	FBFPooledObjectInfo* PooledObj = PoolContainer->FindPooledObject(PoolID);
+	if(!PooledObj || PooledObj->ObjectCheckoutID != ObjectCheckoutID)
+		return -1;
+
+	if constexpr (Mode == ESPMode::ThreadSafe)
+	{
+		// Batch returns of a worker checkout that hasn't been replayed yet, queued behind the checkout and reported by the drain instead of the caller.
+		if(PooledObj->bConcurrentStaged && ConcurrentState.IsValid())
+		{
+			ReturnToPoolConcurrent(PoolID, ObjectCheckoutID);
+			return -1;
+		}
 	}
 	
-	bfValid(Object); // Should be valid always, if not then something went wrong.
+	if(!PooledObj->bActive)
+		return -1;
 	
-	// Add a small initial offset to the LastActiveTime in the case when using a cooldown time, this ensures the first pooling doesn't block instant access.
-	float CooldownOffset = PoolInitInfo.CooldownTimeSeconds > 0 ? PoolInitInfo.CooldownTimeSeconds + KINDA_SMALL_NUMBER : 0.f;
-
-	FBFPooledObjectInfo Info;
-	Info.ObjectPoolID = ++CurrentPoolIDIndex; // -1 Is considered an invalid Index
-	Info.CreationTime = GetWorld()->GetTimeSeconds();
-	Info.LastTimeActive = GetWorld()->GetTimeSeconds() - CooldownOffset;
-	Info.PooledObject = Object;
-	++Info.ObjectCheckoutID; // Don't need to but just feel better starting above -1
+	// Ensure the ID differs in case the object IF does any checks/returns upon Deactivation.
+	const int32 NewCheckoutID = BF::OP::NextCheckoutID(ObjectCheckoutID);
+	if(ConcurrentState.IsValid())
+	{
+		// Workers may be returning a copy of the same handle, the exchange makes sure only one of us wins.
+		if(FPlatformAtomics::InterlockedCompareExchange(&PooledObj->ObjectCheckoutID, NewCheckoutID, ObjectCheckoutID) != ObjectCheckoutID)
+			return -1;
+	}
+	else
+		PooledObj->ObjectCheckoutID = NewCheckoutID;
+	
+	PoolContainer->RemoveActive(PoolID);
+	PoolContainer->ClearCurfew(BF::OP::GetPoolIDSlotIndex(PoolID));
+	return NewCheckoutID;
+}
 
-	FBFPooledObjectInfo* NewInfo = &PoolContainer->ObjectPool.Add(Info.ObjectPoolID, Info);
-	PoolContainer->InactiveObjectIDPool.Add(Info.ObjectPoolID);
 
-	if(Object->template Implements< UBFPooledObjectInterface>())
-		IBFPooledObjectInterface::Execute_OnObjectCreated(Object);
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::FinishReturn(int64 PoolID, float SecondsNow)
+{
+	FBFPooledObjectInfo& PooledObj = PoolContainer->FindPooledObjectChecked(PoolID);
+	PooledObj.bActive = false;
+	PooledObj.LastTimeActive = SecondsNow;
 
+	DeactivateObject(CastChecked<T>(PooledObj.PooledObject.Get()));
 	
-	OnObjectAddedToPool.Broadcast(Info.ObjectPoolID, Info.ObjectCheckoutID, Info.PooledObject);
-	return NewInfo;
+	// Cache the tag after deactivation so the object has reset itself, then make it available again.
+	CacheObjectGameplayTag(PoolID);
+	PoolContainer->AddInactive(PoolID);
+	RequestDormancyEvaluation(SecondsNow + PoolInitInfo.DormancyDelaySeconds);
+
+	// The ready stack may have run dry at the limit, this return can top it back up.
+	if(ConcurrentState.IsValid() && ConcurrentState->ReadySlots.GetNum() < PoolInitInfo.ConcurrentReserve)
+		PoolContainer->RequestUpkeep();
+
+	// Not trimmed right here since the caller may be in the middle of broadcasting/iterating the pool.
+	if(GetPoolSize() > PoolInitInfo.PoolLimit && PoolInitInfo.OverflowPolicy == EBFPoolOverflowPolicy::GrowTemporarily)
+	{
+		bPendingOverflowTrim = true;
+		PoolContainer->RequestUpkeep();
+	}
 }
 
 
-template<typename T, ESPMode Mode>
-requires BF::OP::CIs_UObject<T>
-TBFPooledObjectHandlePtr<T, Mode> TBFObjectPool<T, Mode>::UnpoolObject(bool bAutoActivate)
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::DeferReturn(int64 PoolID, int32 ObjectCheckoutID)
 {
-	bfEnsure(IsValid(PoolContainer) && IsValid(PoolInitInfo.Owner)); // have you initialized the pool?
-	// Might not have any free but we have space to make more.
-	if(PoolContainer->InactiveObjectIDPool.Num() == 0)
+	// Handles are invalidated right away, the object stays out of the inactive list (so it can't be handed out again) until it is processed.
+	const int32 NewCheckoutID = BeginReturn(PoolID, ObjectCheckoutID);
+	if(NewCheckoutID == -1)
+		return -1;
+
+	DeferredReturnIDs.Add(PoolID);
+	DeferredReturnCheckoutIDs.Add(NewCheckoutID);
+	PoolContainer->RequestUpkeep();
+	return NewCheckoutID;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::ProcessDeferredReturns()
+{
+	if(DeferredReturnIDs.Num() == 0)
+		return;
+
+	SCOPED_NAMED_EVENT(TBFObjectPool_ProcessDeferredReturns, FColor::Green);
+	// Copied out first, deactivating may drop more handles and those queue up for the next upkeep instead of growing the arrays under us.
+	const TArray<int64, TInlineAllocator<32>> IDs(DeferredReturnIDs);
+	const TArray<int32, TInlineAllocator<32>> CheckoutIDs(DeferredReturnCheckoutIDs);
+	DeferredReturnIDs.Reset();
+	DeferredReturnCheckoutIDs.Reset();
+
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+	for(const int64 PoolID : IDs)
+		FinishReturn(PoolID, SecondsNow);
+
+	OnObjectsPooledBatch.Broadcast(true, IDs, CheckoutIDs);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+TBFPooledObjectLiteHandle<T> TBFObjectPool<T, Mode>::UnpoolObjectConcurrent(bool bAutoActivate)
+{
+	static_assert(Mode == ESPMode::ThreadSafe, "Only ESPMode::ThreadSafe pools can be un-pooled from worker threads.");
+	bfEnsure(PoolInitInfo.ConcurrentReserve > 0 && ConcurrentState.IsValid()); // Init the pool with a ConcurrentReserve above 0.
+	if(!ConcurrentState.IsValid())
+		return TBFPooledObjectLiteHandle<T>();
+
+	const int32 SlotIndex = ConcurrentState->ReadySlots.Pop();
+	if(SlotIndex == INDEX_NONE)
 	{
-		if(GetPoolSize() < PoolInitInfo.PoolLimit)
-		{
-			CreateNewPoolEntry();
-		}
-		else
-		{
-#if !UE_BUILD_SHIPPING
-			if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
-				UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Trying to get a pooled object for {0} but all current objects are active and pool {1} is at capacity.", GetOwner()->GetName(), PoolInitInfo.PoolClass->GetName());
-#endif
-			return nullptr;
-		}
+		ConcurrentState->NumMisses.fetch_add(1, std::memory_order_relaxed);
+		WakeConcurrentUpkeep();
+		return TBFPooledObjectLiteHandle<T>();
 	}
 
-	// If we aren't using a cooldowns then we can speed up this by just popping from the inactive pool.
-	float Cooldown = PoolInitInfo.CooldownTimeSeconds;
-	if(Cooldown < KINDA_SMALL_NUMBER)
-	{ 
-		FBFPooledObjectInfo& Info = PoolContainer->ObjectPool[PoolContainer->InactiveObjectIDPool.Pop()];
-		++Info.ObjectCheckoutID;
-		ActivateObject(CastChecked<T>(Info.PooledObject), bAutoActivate);
-		Info.bActive = true;
-		Info.LastTimeActive = GetWorld()->GetTimeSeconds();
-		OnObjectPooled.Broadcast(false, Info.ObjectPoolID, Info.ObjectCheckoutID);
+	// Popping the slot hands this thread sole ownership of it, nothing else touches its checkout ID until the handle below exists.
+	FBFPooledObjectInfo& Info = *PoolContainer->GetSlotConcurrent(SlotIndex);
+	const int32 CheckoutID = BF::OP::NextCheckoutID(Info.ObjectCheckoutID);
+	FPlatformAtomics::AtomicStore(&Info.ObjectCheckoutID, CheckoutID);
+	ConcurrentState->PendingOps.Enqueue({Info.ObjectPoolID, CheckoutID, false, bAutoActivate});
+	WakeConcurrentUpkeep();
+	return TBFPooledObjectLiteHandle<T>{PoolContainer, SlotIndex, CheckoutID};
+}
 
-		return MakeShared<TBFPooledObjectHandle<T, Mode>, Mode>(&Info, TWeakPtr<TBFObjectPool, Mode>(this->AsWeak()));
-	}
 
-	// Iterate oldest to newest and find the first object that has been inactive for longer than the cooldown time.
-	float SecondsNow = GetWorld()->GetTimeSeconds();
-	for(auto ID : PoolContainer->InactiveObjectIDPool)
-	{
-		auto& Info = PoolContainer->ObjectPool.FindChecked(ID);
-		float Delta = SecondsNow - Info.LastTimeActive;
-		if(Delta < Cooldown)
-			continue;
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::ReturnToPoolConcurrent(int64 PoolID, int32 ObjectCheckoutID)
+{
+	bfEnsure(ConcurrentState.IsValid()); // Only pools initialized with a ConcurrentReserve or bDeferReturns can return objects off the game thread.
+	FBFPooledObjectInfo* Info = ConcurrentState.IsValid() && ObjectCheckoutID > -1 ? PoolContainer->GetSlotConcurrent(BF::OP::GetPoolIDSlotIndex(PoolID)) : nullptr;
+	if(!Info)
+		return false;
 
-		++Info.ObjectCheckoutID;
-		ActivateObject(CastChecked<T>(Info.PooledObject), bAutoActivate);
-		Info.bActive = true;
-		Info.LastTimeActive = GetWorld()->GetTimeSeconds();
-		PoolContainer->InactiveObjectIDPool.Remove(ID);
-		OnObjectPooled.Broadcast(false, Info.ObjectPoolID, Info.ObjectCheckoutID);
-		return MakeShared<TBFPooledObjectHandle<T, Mode>, Mode>(&Info, TWeakPtr<TBFObjectPool, Mode>(this->AsWeak()));
-	}
+	// Winning the exchange is what makes this the return for the checkout, every other copy of the handle (on any thread) fails from here on.
+	const int32 NewCheckoutID = BF::OP::NextCheckoutID(ObjectCheckoutID);
+	if(FPlatformAtomics::InterlockedCompareExchange(&Info->ObjectCheckoutID, NewCheckoutID, ObjectCheckoutID) != ObjectCheckoutID)
+		return false;
+
+	ConcurrentState->PendingOps.Enqueue({PoolID, NewCheckoutID, true, false});
+	WakeConcurrentUpkeep();
+	return true;
+}
 
-	// This means nothing in the inactive pool met our threshold, check one last time if we can make one.
-	if(GetPoolSize() < PoolInitInfo.PoolLimit)
-	{
-		FBFPooledObjectInfo& Entry = *CreateNewPoolEntry();
 
-		++Entry.ObjectCheckoutID;
-		ActivateObject(CastChecked<T>(Entry.PooledObject), bAutoActivate);
-		Entry.bActive = true;
-		Entry.LastTimeActive = GetWorld()->GetTimeSeconds();
-		PoolContainer->InactiveObjectIDPool.Remove(Entry.ObjectPoolID);
-		OnObjectPooled.Broadcast(false, Entry.ObjectPoolID, Entry.ObjectCheckoutID);
-		return MakeShared<TBFPooledObjectHandle<T, Mode>, Mode>(&Entry, TWeakPtr<TBFObjectPool, Mode>(this->AsWeak()));
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::WakeConcurrentUpkeep()
+{
+	if(ConcurrentState->bWakePending.exchange(true, std::memory_order_acq_rel))
+		return;
+
+	if(IsInGameThread())
+	{
+		PoolContainer->RequestUpkeep();
+		return;
 	}
 	
-	return nullptr;
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakPtr<TBFObjectPool, Mode>(this->AsWeak())]()
+	{
+		auto Pool = WeakThis.Pin();
+		if(Pool.IsValid() && IsValid(Pool->PoolContainer))
+			Pool->PoolContainer->RequestUpkeep();
+	});
 }
 
 
 template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
-TBFPooledObjectHandlePtr<T, Mode> TBFObjectPool<T, Mode>::UnpoolObjectByTag(FGameplayTag Tag, bool bAutoActivate)
+void TBFObjectPool<T, Mode>::FlushConcurrentOps()
 {
-	if(PoolContainer->InactiveObjectIDPool.Num() == 0 || !Tag.IsValid())
-		return nullptr;
+	check(IsInGameThread());
+	if(!ConcurrentState.IsValid())
+		return;
+	
+	DrainConcurrentOps();
+	RestockConcurrent();
+}
 
-	for(auto ID : PoolContainer->InactiveObjectIDPool)
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+bool TBFObjectPool<T, Mode>::DrainConcurrentOps()
+{
+	check(IsInGameThread());
+	// Cleared first, anything queued from here on posts a new wake.
+	ConcurrentState->bWakePending.store(false, std::memory_order_release);
+	
+	const float SecondsNow = GetWorld()->GetTimeSeconds();
+	BF::OP::FConcurrentPoolOp Op;
+	bool bDrainedAny = false;
+	
+	// One queue for both so a checkout and return of the same object made within a frame are always replayed activate first.
+	while(ConcurrentState.IsValid() && ConcurrentState->PendingOps.Dequeue(Op))
 	{
-		auto& Info = PoolContainer->ObjectPool.FindChecked(ID);
-		if(!Info.PooledObject->template Implements< UBFPooledObjectInterface>())
+		bDrainedAny = true;
+		FBFPooledObjectInfo* Info = PoolContainer->FindPooledObject(Op.PoolID);
+		if(!Info) // Stolen/removed by the game thread since.
 			continue;
-		
-		if(IBFPooledObjectInterface::Execute_GetObjectGameplayTag(Info.PooledObject) == Tag)
+
+		T* Object = CastChecked<T>(Info->PooledObject.Get());
+		if(!Op.bReturned)
+		{
+			// The rest of BeginCheckout, the worker already bumped the checkout ID when it popped the slot. Only now does it count as active.
+			bfEnsure(Info->bConcurrentStaged);
+			Info->bConcurrentStaged = false;
+			--NumConcurrentStaged;
+			Info->bActive = true;
+			Info->RecyclePriority = 0;
+			PoolContainer->AddActive(Op.PoolID);
+			PoolContainer->RecordSizingActive(GetActivePoolSize());
+			++NumCheckouts;
+			RecordPoolStat(EBFObjectPoolStat::UnpoolHit);
+			if(bAdaptiveSizing)
+			{
+				FBFObjectPoolDemandStats& Slice = DemandSlices[CurrentDemandSlice];
+				++Slice.NumUnpools;
+				Slice.PeakActive = FMath::Max(Slice.PeakActive, GetActivePoolSize());
+			}
+			ActivateObject(Object, Op.bAutoActivate);
+			OnObjectPooled.Broadcast(false, Op.PoolID, Op.CheckoutID);
+			continue;
+		}
+
+		// The worker already swapped the checkout ID when it won the return, this is the rest of BeginReturn and then FinishReturn (or DeferReturn).
+		PoolContainer->RemoveActive(Op.PoolID);
+		PoolContainer->ClearCurfew(BF::OP::GetPoolIDSlotIndex(Op.PoolID));
+		if(PoolInitInfo.bDeferReturns)
 		{
-			ActivateObject(CastChecked<T>(Info.PooledObject), bAutoActivate);
-			Info.bActive = true;
-			++Info.ObjectCheckoutID;
-			Info.LastTimeActive = GetWorld()->GetTimeSeconds();
-			PoolContainer->InactiveObjectIDPool.Remove(ID);
-			OnObjectPooled.Broadcast(false, Info.ObjectPoolID, Info.ObjectCheckoutID);
-			return MakeShared<TBFPooledObjectHandle<T, Mode>, Mode>(&Info, TSharedPtr<TBFObjectPool, Mode>(this->AsShared()));
+			DeferredReturnIDs.Add(Op.PoolID);
+			DeferredReturnCheckoutIDs.Add(Op.CheckoutID);
+			continue;
 		}
+		FinishReturn(Op.PoolID, SecondsNow);
+		OnObjectPooled.Broadcast(true, Op.PoolID, Op.CheckoutID);
 	}
-	return nullptr;
+
+	if(ConcurrentState.IsValid())
+	{
+		if(const int32 NumMissed = ConcurrentState->NumMisses.exchange(0, std::memory_order_relaxed); NumMissed > 0)
+			RecordMisses(NumMissed);
+	}
+	return bDrainedAny;
 }
 
 
-template<typename T, ESPMode Mode>
-requires BF::OP::CIs_UObject<T>
-bool TBFObjectPool<T, Mode>::ReturnToPool(TBFPooledObjectHandlePtr<T, Mode>& Handle)
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::ReclaimConcurrentSlots()
 {
-	if(!Handle.IsValid() && !Handle->IsHandleValid())
+	check(IsInGameThread());
+	DrainConcurrentOps();
+	
+	// Popping hands the slot back to us like it would to a worker, so nothing else can still be holding it.
+	for(int32 SlotIndex = ConcurrentState->ReadySlots.Pop(); SlotIndex != INDEX_NONE; SlotIndex = ConcurrentState->ReadySlots.Pop())
 	{
-		Handle = nullptr;
-		return false;
+		FBFPooledObjectInfo& Info = PoolContainer->ObjectPool[SlotIndex];
+		bfEnsure(Info.bConcurrentStaged);
+		Info.bConcurrentStaged = false;
+		--NumConcurrentStaged;
+		PoolContainer->AddInactive(Info.ObjectPoolID);
 	}
-
-	auto& ObjectInfo = PoolContainer->ObjectPool.FindChecked(Handle->GetPoolID());
-	++ObjectInfo.ObjectCheckoutID; 
-	DeactivateObject(Handle->GetObject());
-	PoolContainer->InactiveObjectIDPool.Add(ObjectInfo.ObjectPoolID);
-	ObjectInfo.bActive = false;
-	
-	OnObjectPooled.Broadcast(true, ObjectInfo.ObjectPoolID, ObjectInfo.ObjectCheckoutID);
-
-	Handle = nullptr;
-	return true;
+	PoolContainer->RequestUpkeep(); // Restocks next frame.
 }
 
 
 template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
-bool TBFObjectPool<T, Mode>::ReturnToPool_Internal(int64 PoolID, int32 ObjectCheckoutID)
+bool TBFObjectPool<T, Mode>::RestockConcurrent()
 {
-	if(FBFPooledObjectInfo* PooledObj = PoolContainer->ObjectPool.Find(PoolID))
+	BF::OP::FConcurrentSlotStack& ReadySlots = ConcurrentState->ReadySlots;
+	bool bStagedAny = false;
+	for(int32 NumReady = ReadySlots.GetNum(); NumReady < PoolInitInfo.ConcurrentReserve; ++NumReady)
 	{
-		if(PooledObj->ObjectCheckoutID == ObjectCheckoutID)
+		// Newest first like UnpoolObject, cooldowns don't apply to worker checkouts.
+		int64 PoolID = PoolContainer->GetNewestInactive();
+		if(PoolID == -1)
 		{
-			++PooledObj->ObjectCheckoutID; // Ensure the ID differs in case the object IF does any checks/returns upon Deactivation.
-			DeactivateObject(CastChecked<T>(PooledObj->PooledObject.Get()));
-			PoolContainer->InactiveObjectIDPool.Add(PoolID);
-			PooledObj->bActive = false;
-			
-			OnObjectPooled.Broadcast(true, PoolID, ObjectCheckoutID);
-			return true;
+			const FBFPooledObjectInfo* NewInfo = CreateNewPoolEntry();
+			if(!NewInfo) // At the limit, FinishReturn wakes the upkeep again as objects come home.
+				break;
+			PoolID = NewInfo->ObjectPoolID;
 		}
+
+		// Staged rather than active, it becomes active when the worker checkout is replayed by DrainConcurrentOps.
+		PoolContainer->RemoveInactive(PoolID);
+		PoolContainer->FindPooledObjectChecked(PoolID).bConcurrentStaged = true;
+		++NumConcurrentStaged;
+		ReadySlots.Push(BF::OP::GetPoolIDSlotIndex(PoolID));
+		bStagedAny = true;
 	}
-	return false;
+	return bStagedAny;
 }
 
 template <typename T, ESPMode Mode>
 requires BF::OP::CIs_UObject<T>
 bool TBFObjectPool<T,  Mode>::ClearInactiveObjectsPool()
 {
-	if(PoolContainer->InactiveObjectIDPool.Num() == 0)
+	if(GetInactivePoolSize() == 0)
 		return false;
 
-	auto& Pool = PoolContainer->InactiveObjectIDPool;
-	for(int j = Pool.Num() -1; j >= 0; --j)
-	{
-		auto& Info = PoolContainer->ObjectPool.FindChecked(Pool[j]);
-		RemoveInactiveObjectFromPool(Info.ObjectPoolID, Info.ObjectCheckoutID);
-	}
+	while(GetInactivePoolSize() > 0)
+		DestroyPoolEntry(PoolContainer->GetOldestInactive());
 	
 	return true;
 }
 
 
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int32 TBFObjectPool<T, Mode>::MigrateToOwner(UObject* NewOwner)
+{
+	bfValid(NewOwner);
+	bfEnsure(IsValid(PoolContainer)); // You must call Init on your pool before trying to use anything on it.
+	bfEnsure(GetPoolType() != EBFPoolType::Component || Cast<AActor>(NewOwner)); // Components need an actor to be added to.
+	bfEnsure(GetPoolType() != EBFPoolType::UserWidget || Cast<APlayerController>(NewOwner)); // Widgets need a player controller.
+	UWorld* NewWorld = NewOwner ? NewOwner->GetWorld() : nullptr;
+	if(!NewWorld || !IsValid(PoolContainer))
+		return 0;
+
+	ProcessDeferredReturns();
+	if constexpr (Mode == ESPMode::ThreadSafe)
+	{
+		// Staged slots would be released out from under the ready stack (and the staged count) if their object is dropped below.
+		if(ConcurrentState.IsValid())
+			ReclaimConcurrentSlots();
+	}
+
+	// Plain objects don't live in a world, anything else has to have made it into the new one by itself (or was destroyed with the old one).
+	TArray<int64, TInlineAllocator<32>> DroppedIDs;
+	int32 NumDroppedInactive = 0;
+	for(const FBFPooledObjectInfo& Info : PoolContainer->ObjectPool)
+	{
+		if(!Info.bOccupied)
+			continue;
+
+		const UObject* Object = Info.PooledObject;
+		if(IsValid(Object) && (GetPoolType() == EBFPoolType::Object || Object->GetWorld() == NewWorld))
+			continue;
+
+		DroppedIDs.Add(Info.ObjectPoolID);
+		NumDroppedInactive += Info.bActive ? 0 : 1;
+	}
+
+	for(const int64 PoolID : DroppedIDs)
+	{
+		const int32 CheckoutID = PoolContainer->FindPooledObjectChecked(PoolID).ObjectCheckoutID;
+		PoolContainer->ReleasePooledObject(PoolID);
+		OnObjectRemovedFromPool.Broadcast(PoolID, CheckoutID);
+	}
+
+	RehomeUnder(NewOwner, NewWorld);
+
+	// World timestamps from the old world mean nothing on the new clock, everything kept counts as freshly returned and off cooldown.
+	const float SecondsNow = NewWorld->GetTimeSeconds();
+	const float CooldownOffset = PoolInitInfo.CooldownTimeSeconds > 0 ? PoolInitInfo.CooldownTimeSeconds + KINDA_SMALL_NUMBER : 0.f;
+	for(FBFPooledObjectInfo& Info : PoolContainer->ObjectPool)
+	{
+		if(Info.bOccupied && !Info.bActive)
+			Info.LastTimeActive = SecondsNow - CooldownOffset;
+	}
+	DemandSliceStartTime = SecondsNow;
+	OversizedSinceTime = -1.f;
+	PrewarmDeadline = -1.f;
+	if(PoolInitInfo.Dormancy != EBFPoolDormancy::Awake)
+		RequestDormancyEvaluation(SecondsNow + PoolInitInfo.DormancyDelaySeconds);
+
+#if !UE_BUILD_SHIPPING
+	if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Pool {0} migrated to {1}, kept {2} objects and is rebuilding {3}.", GetNameSafe(PoolInitInfo.PoolClass), NewOwner->GetName(), GetPoolSize(), NumDroppedInactive);
+#endif
+
+	if(NumDroppedInactive > 0)
+		Reserve(GetInactivePoolSize() + NumDroppedInactive, PoolInitInfo.bTimeSlicedPrewarm ? -1.f : 0.f);
+	return NumDroppedInactive;
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::ParkUnder(UObject* NewOwner)
+{
+	bfValid(NewOwner);
+	bfEnsure(IsValid(PoolContainer)); // You must call Init on your pool before trying to use anything on it.
+	if(!NewOwner || !IsValid(PoolContainer))
+		return;
+
+	ProcessDeferredReturns();
+	RehomeUnder(NewOwner, nullptr);
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::RehomeUnder(UObject* NewOwner, UWorld* NewWorld)
+{
+	PoolInitInfo.Owner = NewOwner;
+	PoolContainer->MigrateToWorld(NewWorld, NewOwner);
+	if(GetPoolType() != EBFPoolType::Object)
+		return;
+
+	for(const FBFPooledObjectInfo& Info : PoolContainer->ObjectPool)
+	{
+		if(Info.bOccupied && IsValid(Info.PooledObject) && Info.PooledObject->GetOuter() != NewOwner)
+			Info.PooledObject->Rename(nullptr, NewOwner, REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional);
+	}
+}
+
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::AppendInactiveObjects(TArray<UObject*>& OutObjects) const
+{
+	if(!IsValid(PoolContainer))
+		return;
+
+	OutObjects.Reserve(OutObjects.Num() + GetInactivePoolSize());
+	PoolContainer->ForEachInactiveNewestFirst([&OutObjects](const FBFPooledObjectInfo& Info)
+	{
+		OutObjects.Add(Info.PooledObject);
+		return true;
+	});
+}
+
+
 template <typename T, ESPMode Mode>
 requires BF::OP::CIs_UObject<T>
 bool TBFObjectPool<T, Mode>::RemoveInactiveObjectFromPool(int64 PoolID, int32 ObjectCheckoutID)
 {
-	int32 Index = PoolContainer->InactiveObjectIDPool.Find(PoolID);
-	if(Index != -1)
+	FBFPooledObjectInfo* Info = PoolContainer->FindPooledObject(PoolID);
+	if(!Info || Info->bActive || Info->bConcurrentStaged)
+		return false;
+	
+	if(Info->ObjectCheckoutID != ObjectCheckoutID)
 	{
-		auto& Info = PoolContainer->ObjectPool.FindChecked(PoolID);
-		if(Info.ObjectCheckoutID != ObjectCheckoutID)
-		{
 #if !UE_BUILD_SHIPPING
-			if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
-				UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Trying to remove an object with an invalid checkout ID, this is likely due to a stale handle.");
+		if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+			UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Trying to remove an object with an invalid checkout ID, this is likely due to a stale handle.");
 #endif
-			return false;
-		}
+		return false;
+	}
 
-		if(Info.PooledObject->template Implements< UBFPooledObjectInterface>())
-			IBFPooledObjectInterface::Execute_OnObjectDestroyed(Info.PooledObject);
+	DestroyPoolEntry(PoolID);
+	return true;
+}
 
-		
-		switch (GetPoolType())
+
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T, Mode>::DestroyPoolEntry(int64 PoolID)
+{
+	FBFPooledObjectInfo& Info = PoolContainer->FindPooledObjectChecked(PoolID);
+	UObject* Object = Info.PooledObject;
+	const int32 CheckoutID = Info.ObjectCheckoutID;
+	
+	GetInterfaceDispatch(Object).OnObjectDestroyed(Object);
+
+	switch (GetPoolType())
+	{
+		case EBFPoolType::Actor: CastChecked<AActor>(Object)->Destroy(); break;
+		case EBFPoolType::Component: CastChecked<UActorComponent>(Object)->DestroyComponent(); break;
+		case EBFPoolType::UserWidget:
 		{
-			case EBFPoolType::Actor: CastChecked<AActor>(Info.PooledObject)->Destroy(); break;
-			case EBFPoolType::Component: CastChecked<UActorComponent>(Info.PooledObject)->DestroyComponent(); break;
-			case EBFPoolType::UserWidget: CastChecked<UUserWidget>(Info.PooledObject)->RemoveFromParent(); CastChecked<UUserWidget>(Info.PooledObject)->MarkAsGarbage(); break;
-			case EBFPoolType::Object: Info.PooledObject->MarkAsGarbage(); break;
-			case EBFPoolType::Invalid: bfEnsure(false); return false;
+			// Only inactive entries are destroyed, DeactivateObject has already detached virtualized widgets (and their wrapper) by now.
+			UUserWidget* Widget = CastChecked<UUserWidget>(Object);
+			Widget->RemoveFromParent();
+			Object->MarkAsGarbage();
+			break;
 		}
-	
-		int64 ID = Info.ObjectPoolID;
-		PoolContainer->InactiveObjectIDPool.RemoveAtSwap(Index);
-		PoolContainer->ObjectPool.Remove(ID);
-		OnObjectRemovedFromPool.Broadcast(ID, Info.ObjectCheckoutID);
-		return true;
+		case EBFPoolType::Object: Object->MarkAsGarbage(); break;
+		case EBFPoolType::Invalid: bfEnsure(false); break;
 	}
-	return false;
+
+	PoolContainer->ReleasePooledObject(PoolID);
+	OnObjectRemovedFromPool.Broadcast(PoolID, CheckoutID);
 }
 
 
@@ -916,37 +2839,31 @@ bool TBFObjectPool<T, Mode>::RemoveInactiveNumFromPool(int64 NumToRemove)
 	if(NumToRemove > GetInactivePoolSize())	
 		return false;
 
+	// Oldest first, they are the ones least likely to be reused soon.
 	for(int i = 0; i < NumToRemove; ++i)
-	{
-		// Popping from inactive so no need to remove below
-		auto& Info = PoolContainer->ObjectPool.FindChecked(PoolContainer->InactiveObjectIDPool.Pop());
-		
-		if(Info.PooledObject->template Implements< UBFPooledObjectInterface>())
-			IBFPooledObjectInterface::Execute_OnObjectDestroyed(Info.PooledObject);
+		DestroyPoolEntry(PoolContainer->GetOldestInactive());
+	
+	return true;
+}
 
-		
-		switch(GetPoolType())
-		{
-			case EBFPoolType::Actor: CastChecked<AActor>(Info.PooledObject)->Destroy(); break;
-			case EBFPoolType::Component: CastChecked<UActorComponent>(Info.PooledObject)->DestroyComponent(); break;
-			case EBFPoolType::UserWidget: CastChecked<UUserWidget>(Info.PooledObject)->RemoveFromParent(); CastChecked<UUserWidget>(Info.PooledObject)->MarkAsGarbage(); break;
-			case EBFPoolType::Object: Info.PooledObject->MarkAsGarbage(); break;
-			case EBFPoolType::Invalid: bfEnsure(false); return false;
-		}
 
-		int64 ID = Info.ObjectPoolID;
-		PoolContainer->ObjectPool.Remove(ID);
-		OnObjectRemovedFromPool.Broadcast(ID, Info.ObjectCheckoutID);
-	}
-	return true;
+template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
+int64 TBFObjectPool<T, Mode>::EstimateObjectSizeBytes()
+{
+	UObject* Sample = IsValid(PoolContainer) ? PoolContainer->GetAnyPooledObject() : nullptr;
+	if(!Sample)
+		return 0;
+
+	// Every object in a pool is the same class and setup so one sample is representative enough for budgeting.
+	return UBFPoolContainer::GetObjectMemoryBytes(Sample);
 }
 
 
 template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
 bool TBFObjectPool<T, Mode>::IsObjectIDValid(int64 PoolID, int32 ObjectCheckoutID) const
 {
-	if(auto* Info = PoolContainer->ObjectPool.Find(PoolID))
-		return Info->ObjectCheckoutID == ObjectCheckoutID;
+	if(auto* Info = PoolContainer->FindPooledObject(PoolID))
+		return FPlatformAtomics::AtomicRead(&Info->ObjectCheckoutID) == ObjectCheckoutID;
 	return false;
 }
 
@@ -954,8 +2871,8 @@ bool TBFObjectPool<T, Mode>::IsObjectIDValid(int64 PoolID, int32 ObjectCheckoutI
 template <typename T, ESPMode Mode> requires BF::OP::CIs_UObject<T>
 bool TBFObjectPool<T, Mode>::IsObjectInactive(int64 PoolID, int32 ObjectCheckoutID) const
 {
-	if(auto* Info = PoolContainer->ObjectPool.Find(PoolID))
-		return Info->ObjectCheckoutID == ObjectCheckoutID && !Info->bActive;
+	if(auto* Info = PoolContainer->FindPooledObject(PoolID))
+		return Info->ObjectCheckoutID == ObjectCheckoutID && !Info->bActive && !Info->bConcurrentStaged;
 	return false;
 }
 
@@ -964,7 +2881,7 @@ template <typename T, ESPMode Mode>
 requires BF::OP::CIs_UObject<T>
 T* TBFObjectPool<T, Mode>::StealObject(int64 PoolID, int32 ObjectCheckoutID)
 {
-	if(FBFPooledObjectInfo* Info = PoolContainer->ObjectPool.Find(PoolID))
+	if(FBFPooledObjectInfo* Info = PoolContainer->FindPooledObject(PoolID))
 	{
 		if(Info->ObjectCheckoutID != ObjectCheckoutID)
 		{
@@ -975,13 +2892,24 @@ T* TBFObjectPool<T, Mode>::StealObject(int64 PoolID, int32 ObjectCheckoutID)
 			return nullptr;
 		}
 
-		if(!Info->bActive)
-			PoolContainer->InactiveObjectIDPool.Remove(PoolID);
+		if constexpr (Mode == ESPMode::ThreadSafe)
+		{
+			// A worker checkout that hasn't been replayed yet is still staged, replay it so it is released as the plain active checkout it is.
+			if(Info->bConcurrentStaged && ConcurrentState.IsValid())
+			{
+				DrainConcurrentOps();
+				Info = PoolContainer->FindPooledObject(PoolID);
+				if(!Info || Info->ObjectCheckoutID != ObjectCheckoutID)
+					return nullptr;
+			}
+		}
 
-		PoolContainer->ObjectPool.Remove(PoolID);
-		OnObjectRemovedFromPool.Broadcast(PoolID, Info->ObjectCheckoutID);
+		// Cache before releasing, releasing also unlinks it from the inactive list if it wasn't in use and the slot is immediately reusable once released.
+		T* Object = CastChecked<T>(Info->PooledObject);
+		PoolContainer->ReleasePooledObject(PoolID);
+		OnObjectRemovedFromPool.Broadcast(PoolID, ObjectCheckoutID);
 		
-		return CastChecked<T>(Info->PooledObject);
+		return Object;
 	}
 	return nullptr;
 }
@@ -992,12 +2920,20 @@ template<typename T, ESPMode Mode>
 requires BF::OP::CIs_UObject<T>
 void TBFObjectPool<T,  Mode>::ActivateObject(T* Obj, bool bAutoActivate)
 {
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_ActivateObject);
 	bfEnsure(IsValid(Obj));
 #if !UE_BUILD_SHIPPING
 	if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread() && bAutoActivate && PoolInitInfo.bDisableActivationDeactivationLogic)
 		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Trying to get a pooled object with bAutoActivate set to true but the pools init info has activation/deactivation logic disabled, is this intentional?");
 #endif	
 
+	// Wake before anything is touched so the callers setup this frame goes out together with the activation.
+	if(PoolInitInfo.bNetworked)
+		SetPooledActorNetDormant((AActor*)Obj, false);
+
+	if(PoolInitInfo.bVirtualizeWidgets)
+		AttachPooledWidget((UUserWidget*)Obj);
+
 	if(bIsActivateObjectOverridden)
 	{
 		PoolInitInfo.ActivateObjectOverride.Execute(Obj);
@@ -1032,8 +2968,7 @@ void TBFObjectPool<T,  Mode>::ActivateObject(T* Obj, bool bAutoActivate)
 		}
 	}
 	
-	if(Obj->template Implements<UBFPooledObjectInterface>())
-		IBFPooledObjectInterface::Execute_OnObjectUnPooled(Obj);
+	GetInterfaceDispatch(Obj).OnObjectUnPooled(Obj);
 }
 
 
@@ -1041,6 +2976,7 @@ template<typename T, ESPMode Mode>
 requires BF::OP::CIs_UObject<T>
 void TBFObjectPool<T,  Mode>::DeactivateObject(T* Obj)
 {
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_DeactivateObject);
 	bfValid(Obj);
 
 	if(bIsDeactivateObjectOverridden)
@@ -1077,8 +3013,79 @@ void TBFObjectPool<T,  Mode>::DeactivateObject(T* Obj)
 		}
 	}
 
-	if(Obj->template Implements<UBFPooledObjectInterface>())
-		IBFPooledObjectInterface::Execute_OnObjectPooled(Obj);
+	GetInterfaceDispatch(Obj).OnObjectPooled(Obj);
+
+	// Last so the hidden state and anything OnObjectPooled changed are flushed before the channel goes dormant.
+	if(PoolInitInfo.bNetworked)
+		SetPooledActorNetDormant((AActor*)Obj, true);
+	
+	if(PoolInitInfo.bVirtualizeWidgets)
+		DetachPooledWidget((UUserWidget*)Obj);
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+UWidget* TBFObjectPool<T,  Mode>::GetPooledWidgetRoot(UUserWidget* Widget) const
+{
+	// The wrapper is the only parent a virtualized widget ever has outside of being attached.
+	if(PoolInitInfo.WidgetWrapper != EBFPooledWidgetWrapper::None && Widget->GetParent())
+		return Widget->GetParent();
+	return Widget;
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T,  Mode>::AttachPooledWidget(UUserWidget* Widget)
+{
+	UPanelWidget* Parent = PendingWidgetParent.IsValid() ? PendingWidgetParent.Get() : PoolInitInfo.WidgetParent.Get();
+	PendingWidgetParent.Reset();
+
+	// Either way TakeWidget hands back the Slate widget the container retained, nothing is rebuilt.
+	UWidget* Root = GetPooledWidgetRoot(Widget);
+	if(Parent)
+	{
+		Parent->AddChild(Root);
+	}
+	else if(Root == Widget)
+	{
+		Widget->AddToViewport(PoolInitInfo.WidgetZOrder);
+	}
+	else if(UGameViewportClient* Viewport = GetWorld()->GetGameViewport())
+	{
+		Viewport->AddViewportWidgetContent(Root->TakeWidget(), PoolInitInfo.WidgetZOrder);
+	}
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T,  Mode>::DetachPooledWidget(UUserWidget* Widget)
+{
+	UWidget* Root = GetPooledWidgetRoot(Widget);
+
+	// Wrappers added straight to the viewport have no parent panel to leave, removing content that isn't there is a no-op.
+	if(Root != Widget && !Root->GetParent())
+	{
+		if(UGameViewportClient* Viewport = GetWorld()->GetGameViewport())
+			Viewport->RemoveViewportWidgetContent(Root->TakeWidget());
+		return;
+	}
+	Root->RemoveFromParent();
+}
+
+
+template<typename T, ESPMode Mode>
+requires BF::OP::CIs_UObject<T>
+void TBFObjectPool<T,  Mode>::SetPooledActorNetDormant(AActor* Actor, bool bDormant) const
+{
+	if(!Actor->GetIsReplicated() || !Actor->HasAuthority())
+		return;
+
+	// Going dormant replicates the actor one last time before the channel goes quiet, waking re-opens the same channel so the clients actor and NetGUID are reused.
+	Actor->SetNetDormancy(bDormant ? DORM_DormantAll : DORM_Awake);
+	Actor->ForceNetUpdate();
 }
 
 
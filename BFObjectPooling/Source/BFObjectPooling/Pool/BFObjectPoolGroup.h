@@ -0,0 +1,294 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "BFObjectPool.h"
+
+
+template<typename T, ESPMode Mode = ESPMode::NotThreadSafe>
+struct TBFObjectPoolGroup;
+
+template<typename T, ESPMode Mode = ESPMode::NotThreadSafe>
+using TBFObjectPoolGroupPtr = TSharedPtr<TBFObjectPoolGroup<T, Mode>, Mode>;
+
+
+/** TBFObjectPoolGroup:
+ *
+ * One pool for many subclasses of the PoolClass (40 projectile types, a handful of enemy variants...) instead of one pool per class, they share a single container,
+ * slot array, tick and PoolLimit so capacity isn't stranded in pools for classes that aren't being used right now.
+ * 
+ * Objects are looked up by variant, a class (PoolClass or any child of it) plus an optional description object such as a UBFPoolableActorPreset. Variants are registered
+ * the first time they are asked for and inactive objects are bucketed per variant so UnpoolObject(Class) is a bucket pop. When nothing idle is that exact variant:
+ *		- An idle object of the same class with a different description is handed out instead, you re-apply the description (FireAndForgetWithPreset etc. already do).
+ *		- Otherwise one is created if the group is under its PoolLimit, or the oldest idle object of another class is destroyed to make room for it.
+ *		- Misses only happen when every object in the group is active. Variant un-pools ignore cooldowns and the OverflowPolicy, like the tag un-pools.
+ *
+ * The plain UnpoolObject()/UnpoolObjects() are a variant un-pool of PoolClass with no description, so they only ever hand out PoolClass objects (and follow the same
+ * fallbacks). Tag un-pools match on the tag alone and can hand out any variant that has it.
+ * Everything else (InitPool, returning, handles, prewarming PoolClass via InitialCount...) is the regular TBFObjectPool.
+ * 
+ *	MyGroup = TBFObjectPoolGroup<ABFPoolableProjectileActor>::CreatePool();
+ *	MyGroup->InitPool(Params); // PoolClass is the common base every variant derives from.
+ *	MyGroup->ReserveVariant(ARocketProjectile::StaticClass(), 8);
+ *	auto Handle = MyGroup->UnpoolObject(ARocketProjectile::StaticClass(), RocketPreset, false); */
+template<typename T, ESPMode Mode> 
+struct TBFObjectPoolGroup : public TBFObjectPool<T, Mode>
+{
+	using Super = TBFObjectPool<T, Mode>;
+	using Super::UnpoolObject;
+	using Super::UnpoolObjectLite;
+
+protected:
+	template <typename ObjectType, ESPMode PtrMode>
+	friend class SharedPointerInternals::TIntrusiveReferenceController;
+	TBFObjectPoolGroup() = default; // Force factory function for creation of pools.
+
+	struct FVariant
+	{
+		TObjectPtr<UClass> Class;
+		TObjectPtr<UObject> Description;
+	};
+	
+public:
+	// The group MUST be instantiated via this Create method only.
+	static TBFObjectPoolGroupPtr<T, Mode> CreatePool()
+	{
+		LLM_SCOPE_BYTAG(BFObjectPool);
+		return MakeShared<TBFObjectPoolGroup, Mode>();
+	}
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+	{
+		Super::AddReferencedObjects(Collector);
+		for(FVariant& Variant : Variants)
+		{
+			Collector.AddReferencedObject(Variant.Class);
+			Collector.AddReferencedObject(Variant.Description);
+		}
+	}
+	virtual FString GetReferencerName() const override {return TEXT("TBFObjectPoolGroup");}
+
+	virtual void InitPool(const FBFObjectPoolInitParams& Info) override;
+	virtual void Reset() override;
+
+	/* Un-pools an object of exactly Class (PoolClass or a child of it), preferring one that was last un-pooled with the same Description, see the comment above the class
+	 * for the fallbacks. Description is only a key, the group never applies it, pass whatever your activation takes (a preset, a data asset...) or leave it null. */
+	TBFPooledObjectHandlePtr<T, Mode> UnpoolObject(UClass* Class, const UObject* Description, bool bAutoActivate);
+	TBFPooledObjectHandlePtr<T, Mode> UnpoolObject(UClass* Class, bool bAutoActivate) { return UnpoolObject(Class, nullptr, bAutoActivate); }
+	TBFPooledObjectLiteHandle<T> UnpoolObjectLite(UClass* Class, const UObject* Description, bool bAutoActivate);
+
+	/* Synchronously creates up to Num more inactive objects of the variant, within the shared PoolLimit. Objects prewarmed for a description are only bucketed under it,
+	 * they are created the same as any other object of their class. Returns how many were created. */
+	int32 ReserveVariant(UClass* Class, int32 Num, const UObject* Description = nullptr);
+
+	int32 GetNumVariants() const { return Variants.Num(); }
+	
+protected:
+	virtual FBFPooledObjectInfo* CreateNewPoolEntry(bool bIgnorePoolLimit = false, UClass* ObjectClass = nullptr) override;
+	// The plain un-pools only pick from the PoolClass variants, otherwise they would hand out whichever subclass was returned last.
+	virtual int64 GetNextUnpoolID() override;
+	virtual void BeginCheckoutBatch(int32 Num, TArray<int64, TInlineAllocator<32>>& OutIDs, TArray<int32, TInlineAllocator<32>>& OutCheckoutIDs) override;
+	// Registers the variant the first time it is seen, INDEX_NONE if Class isn't a PoolClass.
+	int32 FindOrAddVariant(UClass* Class, const UObject* Description);
+	// Idle object of the variant (or its class), creating/trading one for it if needed, -1 if every object in the group is active.
+	int64 GetNextVariantUnpoolID(int32 VariantIndex);
+
+protected:
+	TArray<FVariant> Variants;
+	TMap<TPair<const UClass*, const UObject*>, int32> VariantIndices;
+	TMap<const UClass*, TArray<int32, TInlineAllocator<4>>> ClassVariants; // Every variant of each class, for handing out an object of the right class with another description.
+};
+
+
+template <typename T, ESPMode Mode>
+void TBFObjectPoolGroup<T, Mode>::InitPool(const FBFObjectPoolInitParams& Info)
+{
+	Variants.Reset();
+	VariantIndices.Reset();
+	ClassVariants.Reset();
+	Super::InitPool(Info);
+}
+
+
+template <typename T, ESPMode Mode>
+void TBFObjectPoolGroup<T, Mode>::Reset()
+{
+	Super::Reset();
+	Variants.Reset();
+	VariantIndices.Reset();
+	ClassVariants.Reset();
+}
+
+
+template <typename T, ESPMode Mode>
+TBFPooledObjectHandlePtr<T, Mode> TBFObjectPoolGroup<T, Mode>::UnpoolObject(UClass* Class, const UObject* Description, bool bAutoActivate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_UnpoolObject);
+	const int32 VariantIndex = FindOrAddVariant(Class, Description);
+	const int64 PoolID = VariantIndex != INDEX_NONE ? GetNextVariantUnpoolID(VariantIndex) : -1;
+	if(PoolID == -1)
+		return nullptr;
+
+	this->PoolContainer->SetVariant(PoolID, VariantIndex);
+	return this->CheckoutObject(PoolID, bAutoActivate);
+}
+
+
+template <typename T, ESPMode Mode>
+TBFPooledObjectLiteHandle<T> TBFObjectPoolGroup<T, Mode>::UnpoolObjectLite(UClass* Class, const UObject* Description, bool bAutoActivate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_BFObjectPool_UnpoolObject);
+	const int32 VariantIndex = FindOrAddVariant(Class, Description);
+	const int64 PoolID = VariantIndex != INDEX_NONE ? GetNextVariantUnpoolID(VariantIndex) : -1;
+	if(PoolID == -1)
+		return TBFPooledObjectLiteHandle<T>();
+
+	this->PoolContainer->SetVariant(PoolID, VariantIndex);
+	return this->CheckoutObjectLite(PoolID, bAutoActivate);
+}
+
+
+template <typename T, ESPMode Mode>
+int32 TBFObjectPoolGroup<T, Mode>::ReserveVariant(UClass* Class, int32 Num, const UObject* Description)
+{
+	LLM_SCOPE_BYTAG(BFObjectPool);
+	const int32 VariantIndex = FindOrAddVariant(Class, Description);
+	if(VariantIndex == INDEX_NONE)
+		return 0;
+
+	int32 NumCreated = 0;
+	for(; NumCreated < Num; ++NumCreated)
+	{
+		const FBFPooledObjectInfo* Info = CreateNewPoolEntry(false, Class);
+		if(!Info)
+			break;
+		
+		this->PoolContainer->SetVariant(Info->ObjectPoolID, VariantIndex);
+	}
+	return NumCreated;
+}
+
+
+template <typename T, ESPMode Mode>
+FBFPooledObjectInfo* TBFObjectPoolGroup<T, Mode>::CreateNewPoolEntry(bool bIgnorePoolLimit, UClass* ObjectClass)
+{
+	FBFPooledObjectInfo* Info = Super::CreateNewPoolEntry(bIgnorePoolLimit, ObjectClass);
+	if(!Info)
+		return nullptr;
+
+	// Everything starts out as the description-less variant of its class, prewarms included.
+	this->PoolContainer->SetVariant(Info->ObjectPoolID, FindOrAddVariant(Info->PooledObject->GetClass(), nullptr));
+	return Info;
+}
+
+
+template <typename T, ESPMode Mode>
+int64 TBFObjectPoolGroup<T, Mode>::GetNextUnpoolID()
+{
+	const int32 VariantIndex = FindOrAddVariant(this->PoolInitInfo.PoolClass, nullptr);
+	const int64 PoolID = VariantIndex != INDEX_NONE ? GetNextVariantUnpoolID(VariantIndex) : -1;
+	if(PoolID != -1)
+		this->PoolContainer->SetVariant(PoolID, VariantIndex);
+	return PoolID;
+}
+
+
+template <typename T, ESPMode Mode>
+void TBFObjectPoolGroup<T, Mode>::BeginCheckoutBatch(int32 Num, TArray<int64, TInlineAllocator<32>>& OutIDs, TArray<int32, TInlineAllocator<32>>& OutCheckoutIDs)
+{
+	OutIDs.Reserve(Num);
+	OutCheckoutIDs.Reserve(Num);
+	for(int32 Count = 0; Count < Num; ++Count)
+	{
+		const int64 PoolID = GetNextUnpoolID();
+		if(PoolID == -1) // Every object in the group is active, the miss is already recorded.
+			break;
+
+		OutIDs.Add(PoolID);
+		OutCheckoutIDs.Add(this->BeginCheckout(PoolID));
+	}
+}
+
+
+template <typename T, ESPMode Mode>
+int32 TBFObjectPoolGroup<T, Mode>::FindOrAddVariant(UClass* Class, const UObject* Description)
+{
+	bfEnsure(IsValid(this->PoolContainer)); // You must call Init on your pool before trying to use anything on it.
+	bfEnsure(Class && Class->IsChildOf(this->PoolInitInfo.PoolClass)); // Every variant has to be the groups PoolClass or a child of it.
+	bfEnsure(!Class || !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)); // Can't be instanced, every un-pool of it would fail.
+	if(!Class || !IsValid(this->PoolContainer) || !Class->IsChildOf(this->PoolInitInfo.PoolClass) || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		return INDEX_NONE;
+
+	const TPair<const UClass*, const UObject*> Key(Class, Description);
+	if(const int32* Found = VariantIndices.Find(Key))
+		return *Found;
+
+	// Descriptions are only ever compared, never written through.
+	const int32 VariantIndex = Variants.Add({Class, const_cast<UObject*>(Description)});
+	VariantIndices.Add(Key, VariantIndex);
+	ClassVariants.FindOrAdd(Class).Add(VariantIndex);
+	
+	// Subclasses can implement or override the IF themselves, resolved once per class like the pools own dispatch.
+	if(Class != this->PoolInitInfo.PoolClass && !this->ClassDispatches.Contains(Class))
+		this->ClassDispatches.Add(Class, FBFPooledObjectInterfaceDispatch::Resolve(Class));
+	
+	return VariantIndex;
+}
+
+
+template <typename T, ESPMode Mode>
+int64 TBFObjectPoolGroup<T, Mode>::GetNextVariantUnpoolID(int32 VariantIndex)
+{
+	UClass* Class = Variants[VariantIndex].Class;
+	
+	// Already this variant, then the same class under another description which the caller converts by re-applying theirs.
+	int64 PoolID = this->PoolContainer->FindInactiveByVariant(VariantIndex);
+	if(PoolID != -1)
+		return PoolID;
+	
+	for(const int32 ClassVariantIndex : ClassVariants.FindChecked(Class))
+	{
+		if(ClassVariantIndex == VariantIndex)
+			continue;
+		
+		PoolID = this->PoolContainer->FindInactiveByVariant(ClassVariantIndex);
+		if(PoolID != -1)
+			return PoolID;
+	}
+
+	// Nothing idle of this class, the shared limit is what matters so trade the oldest idle object of any other class for a new one if we are at it.
+	if(this->GetPoolSize() >= this->PoolInitInfo.PoolLimit)
+	{
+		// The class itself was vetted by FindOrAddVariant, a tearing down world is the only other reason creation fails, don't destroy an idle object for nothing.
+		const UWorld* World = this->GetWorld();
+		if(!World || World->bIsTearingDown)
+		{
+			this->RecordMisses(1);
+			return -1;
+		}
+		
+		const int64 OldestID = this->PoolContainer->GetOldestInactive();
+		if(OldestID == -1)
+		{
+#if !UE_BUILD_SHIPPING
+			if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+				UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Trying to get a pooled {0} for {1} but every object in the pool group is active and it is at capacity.", Class->GetName(), this->GetOwner()->GetName());
+#endif
+			this->RecordMisses(1);
+			return -1;
+		}
+		
+		this->DestroyPoolEntry(OldestID);
+		this->RecordPoolStat(EBFObjectPoolStat::Eviction);
+	}
+
+	const FBFPooledObjectInfo* Info = CreateNewPoolEntry(false, Class);
+	if(!Info)
+	{
+		this->RecordMisses(1);
+		return -1;
+	}
+	
+	this->RecordPoolStat(EBFObjectPoolStat::LazyCreation);
+	return Info->ObjectPoolID;
+}
@@ -0,0 +1,109 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolSizingProfiles.h"
+#include "BFObjectPool.h"
+#include "BFObjectPooling/Pool/Private/BFPoolContainer.h"
+#include "Engine/World.h"
+#include "UObject/UObjectIterator.h"
+
+
+FName UBFObjectPoolSizingProfiles::GetProfileMapName(const UWorld* World)
+{
+	// PIE worlds are the same map as far as sizing goes.
+	return World ? FName(UWorld::RemovePIEPrefix(World->GetMapName())) : NAME_None;
+}
+
+
+const FBFPoolSizingProfile* UBFObjectPoolSizingProfiles::FindProfile(FName MapName, const FSoftObjectPath& OwnerClass, const FSoftObjectPath& PoolClass) const
+{
+	if(OwnerClass.IsNull() || PoolClass.IsNull())
+		return nullptr;
+
+	return Profiles.FindByPredicate([&](const FBFPoolSizingProfile& Profile)
+	{
+		return Profile.MapName == MapName && Profile.OwnerClass.ToSoftObjectPath() == OwnerClass && Profile.PoolClass.ToSoftObjectPath() == PoolClass;
+	});
+}
+
+
+FBFPoolSizingProfile& UBFObjectPoolSizingProfiles::FindOrAddProfile(FName MapName, const UClass* OwnerClass, const UClass* PoolClass)
+{
+	if(const FBFPoolSizingProfile* Existing = FindProfile(MapName, FSoftObjectPath(OwnerClass), FSoftObjectPath(PoolClass)))
+		return const_cast<FBFPoolSizingProfile&>(*Existing);
+
+	FBFPoolSizingProfile& Profile = Profiles.AddDefaulted_GetRef();
+	Profile.MapName = MapName;
+	Profile.OwnerClass = OwnerClass;
+	Profile.PoolClass = PoolClass;
+	return Profile;
+}
+
+
+bool UBFObjectPoolSizingProfiles::ApplyProfile(const UWorld* World, FBFObjectPoolInitParams& InOutInfo, const UClass* DefaultPoolClass, float& OutTimeToPeak) const
+{
+	if(!InOutInfo.Owner)
+		return false;
+
+	const FSoftObjectPath PoolClass = InOutInfo.PoolClass ? FSoftObjectPath(InOutInfo.PoolClass) :
+		!InOutInfo.SoftPoolClass.IsNull() ? InOutInfo.SoftPoolClass.ToSoftObjectPath() : FSoftObjectPath(DefaultPoolClass);
+	const FBFPoolSizingProfile* Profile = FindProfile(GetProfileMapName(World), FSoftObjectPath(InOutInfo.Owner->GetClass()), PoolClass);
+	if(!Profile || Profile->PeakActive <= 0)
+		return false;
+
+	// Misses only say the limit was too small, not by how much, so they can't grow it past double what was ever needed at once.
+	const int32 RecordedLimit = Profile->PeakActive + FMath::Min(Profile->NumMisses, Profile->PeakActive);
+	InOutInfo.PoolLimit = FMath::Max(InOutInfo.PoolLimit, RecordedLimit);
+	InOutInfo.InitialCount = FMath::Min(Profile->PeakActive, InOutInfo.PoolLimit);
+	OutTimeToPeak = Profile->TimeToPeakSeconds;
+	return true;
+}
+
+
+void UBFObjectPoolSizingProfiles::RecordWorld(UWorld* World)
+{
+	if(!World)
+		return;
+
+	UBFObjectPoolSizingProfiles* Settings = GetMutableDefault<UBFObjectPoolSizingProfiles>();
+	const FName MapName = GetProfileMapName(World);
+	bool bChanged = false;
+	for(TObjectIterator<UBFPoolContainer> It; It; ++It)
+	{
+		FBFPoolSizingRecording* Recording = It->GetSizingRecording();
+		if(!Recording || It->GetOwningWorld() != World || !It->GetOuter() || !Recording->PoolClass.IsValid())
+			continue;
+
+		FBFPoolSizingProfile& Profile = Settings->FindOrAddProfile(MapName, It->GetOuter()->GetClass(), Recording->PoolClass.Get());
+		if(Recording->PeakActive >= Profile.PeakActive)
+		{
+			// Ties keep the sooner peak, prewarming has less time in that session.
+			Profile.TimeToPeakSeconds = Recording->PeakActive > Profile.PeakActive || Profile.NumSessions == 0 ? Recording->TimeToPeakSeconds : FMath::Min(Profile.TimeToPeakSeconds, Recording->TimeToPeakSeconds);
+			Profile.PeakActive = Recording->PeakActive;
+		}
+		Profile.NumMisses = FMath::Max(Profile.NumMisses, Recording->NumMisses);
+		// Peaks and misses are maxed so merging the same recording again only picks up what it gained since, the session itself is counted once.
+		if(!Recording->bMerged)
+		{
+			Recording->bMerged = true;
+			++Profile.NumSessions;
+		}
+		bChanged = true;
+	}
+
+	if(bChanged)
+		Settings->SaveProfiles();
+}
+
+
+void UBFObjectPoolSizingProfiles::SaveProfiles()
+{
+#if WITH_EDITOR
+	if(GIsEditor)
+	{
+		TryUpdateDefaultConfigFile();
+		return;
+	}
+#endif
+	SaveConfig();
+}
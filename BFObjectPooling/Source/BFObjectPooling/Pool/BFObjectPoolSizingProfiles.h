@@ -0,0 +1,72 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Engine/DeveloperSettings.h"
+#include "BFObjectPoolSizingProfiles.generated.h"
+
+struct FBFObjectPoolInitParams;
+
+
+// Demand recorded for one pool identity (owner class + pool class) on one map, see UBFObjectPoolSizingProfiles.
+USTRUCT(BlueprintType)
+struct BFOBJECTPOOLING_API FBFPoolSizingProfile
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly)
+	FName MapName;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly)
+	TSoftClassPtr<UObject> OwnerClass;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly)
+	TSoftClassPtr<UObject> PoolClass;
+
+	// Most objects checked out at once in any recorded session.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0"))
+	int32 PeakActive = 0;
+
+	// Un-pools the limit couldn't cover (misses and overflows) in the session that recorded the most.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0"))
+	int32 NumMisses = 0;
+
+	// Game seconds from InitPool to PeakActive, time sliced prewarms are given this as their deadline.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.0"))
+	float TimeToPeakSeconds = 0.f;
+
+	UPROPERTY(Config, VisibleAnywhere, BlueprintReadOnly)
+	int32 NumSessions = 0;
+};
+
+
+/* Recorded pool sizing per map (Project Settings > Plugins > BF Object Pool Sizing Profiles). With BF.OP.RecordSizingProfiles enabled every pool initialized from then on
+ * records its peak active count, misses and time to peak, which are merged in here when its world is cleaned up (the most demanding session wins) and saved,
+ * to DefaultGame.ini in the editor and the saved Game.ini otherwise. Pools initialized with bUseSizingProfile then prewarm PeakActive and grow their PoolLimit to cover
+ * the recorded misses, so each map prewarms what it needed in playtests instead of hand tuned counts. */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "BF Object Pool Sizing Profiles"))
+class BFOBJECTPOOLING_API UBFObjectPoolSizingProfiles : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	static FName GetProfileMapName(const UWorld* World);
+	const FBFPoolSizingProfile* FindProfile(FName MapName, const FSoftObjectPath& OwnerClass, const FSoftObjectPath& PoolClass) const;
+
+	/* Applies the matching profile (if any) to InOutInfo, InitialCount becomes PeakActive and PoolLimit grows to PeakActive + NumMisses (capped at twice the peak) but never shrinks.
+	 * Matched by path so the pool class doesn't need to be loaded yet, DefaultPoolClass is used when neither PoolClass or SoftPoolClass are set.
+	 * OutTimeToPeak is the profiles TimeToPeakSeconds, returns false if there is no profile for this pool on this map. */
+	bool ApplyProfile(const UWorld* World, FBFObjectPoolInitParams& InOutInfo, const UClass* DefaultPoolClass, float& OutTimeToPeak) const;
+	// Merges every recording pool in the world into Profiles and saves if anything changed, bound to world cleanup by the module. Safe to call more than once per session, each recording counts as one session.
+	// Merges every recording pool in the world into Profiles and saves if anything changed, bound to world cleanup by the module.
+	static void RecordWorld(UWorld* World);
+
+	UPROPERTY(Config, EditAnywhere, Category = "Profiles")
+	TArray<FBFPoolSizingProfile> Profiles;
+
+protected:
+	FBFPoolSizingProfile& FindOrAddProfile(FName MapName, const UClass* OwnerClass, const UClass* PoolClass);
+	void SaveProfiles();
+};
@@ -0,0 +1,268 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+
+UBFObjectPoolSubsystem* UBFObjectPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UBFObjectPoolSubsystem>() : nullptr;
+}
+
+
+bool UBFObjectPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+FBFSharedPoolKey UBFObjectPoolSubsystem::MakeSharedPoolKey(const FBFObjectPoolInitParams& Info, UClass* PoolClass, UClass* TemplateClass, bool bThreadSafe, FName PoolKey) const
+{
+	FBFSharedPoolKey Key;
+	Key.PoolClass = PoolClass;
+	Key.TemplateClass = TemplateClass;
+	Key.PoolKey = PoolKey;
+	Key.bThreadSafe = bThreadSafe;
+
+	// Components get added to their owner and widgets need their player controller, so these can only be shared between requests for the same owner.
+	if(Info.PoolType == EBFPoolType::Component || Info.PoolType == EBFPoolType::UserWidget)
+		Key.Owner = Info.Owner.Get();
+
+	return Key;
+}
+
+
+void UBFObjectPoolSubsystem::Tick(float DeltaTime)
+{
+	SCOPED_NAMED_EVENT(UBFObjectPoolSubsystem_Tick, FColor::Green);
+	const double SecondsNow = GetWorld()->GetTimeSeconds();
+
+	// Pools are gathered first since a pools tick/upkeep callbacks are free to request new shared pools, which would invalidate iterating the map.
+	TArray<FBFObjectPoolBase*, TInlineAllocator<32>> PoolsToTick;
+	PoolsToTick.Reserve(SharedPools.Num());
+	for(auto& [Key, Entry] : SharedPools)
+	{
+		FBFObjectPoolBase* Pool = Entry.Get();
+		if(Pool->GetNumCheckouts() != Entry.LastSeenNumCheckouts)
+		{
+			Entry.LastSeenNumCheckouts = Pool->GetNumCheckouts();
+			Entry.LastUsedTime = SecondsNow;
+		}
+		PoolsToTick.Add(Pool);
+	}
+
+	for(FBFObjectPoolBase* Pool : PoolsToTick)
+		Pool->TickExternal(DeltaTime);
+
+	EnforceBudget();
+}
+
+
+void UBFObjectPoolSubsystem::EnforceBudget()
+{
+	const int32 MaxObjects = GetObjectBudget();
+	const int64 MaxBytes = GetMemoryBudgetBytes();
+	if(MaxObjects < 0 && MaxBytes < 0)
+		return;
+
+	int64 NumObjects = 0;
+	int64 NumBytes = 0;
+	TArray<FBFSharedPoolEntry*, TInlineAllocator<32>> Candidates;
+	for(auto& [Key, Entry] : SharedPools)
+	{
+		FBFObjectPoolBase* Pool = Entry.Get();
+		if(Entry.EstimatedBytesPerObject == 0)
+			Entry.EstimatedBytesPerObject = Pool->EstimateObjectSizeBytes();
+
+		NumObjects += Pool->GetPoolSize();
+		NumBytes += Pool->GetPoolSize() * Entry.EstimatedBytesPerObject;
+		if(Pool->GetInactivePoolSize() > 0)
+			Candidates.Add(&Entry);
+	}
+
+	auto IsOverBudget = [&]() { return (MaxObjects >= 0 && NumObjects > MaxObjects) || (MaxBytes >= 0 && NumBytes > MaxBytes); };
+	if(!IsOverBudget())
+		return;
+
+	// Least recently used first, each pool only gives up as much as is needed to get back under before moving on to the next.
+	Candidates.Sort([](const FBFSharedPoolEntry& A, const FBFSharedPoolEntry& B) { return A.LastUsedTime < B.LastUsedTime; });
+	for(FBFSharedPoolEntry* Entry : Candidates)
+	{
+		int64 NumNeeded = MaxObjects >= 0 ? NumObjects - MaxObjects : 0;
+		if(MaxBytes >= 0 && NumBytes > MaxBytes && Entry->EstimatedBytesPerObject > 0)
+			NumNeeded = FMath::Max(NumNeeded, FMath::DivideAndRoundUp(NumBytes - MaxBytes, Entry->EstimatedBytesPerObject));
+
+		FBFObjectPoolBase* Pool = Entry->Get();
+		const int32 NumToRemove = static_cast<int32>(FMath::Min<int64>(NumNeeded, Pool->GetInactivePoolSize()));
+		if(NumToRemove <= 0)
+			continue;
+
+		Pool->RemoveInactiveNumFromPool(NumToRemove);
+		Pool->RecordPoolStat(EBFObjectPoolStat::Eviction, NumToRemove);
+		NumObjects -= NumToRemove;
+		NumBytes -= NumToRemove * Entry->EstimatedBytesPerObject;
+		if(!IsOverBudget())
+			return;
+	}
+
+#if !UE_BUILD_SHIPPING
+	if(BF::OP::CVarObjectPoolEnableLogging.GetValueOnAnyThread())
+		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Shared pools are over budget ({0} objects, ~{1} bytes) with nothing inactive left to evict.", NumObjects, NumBytes);
+#endif
+}
+
+
+int32 UBFObjectPoolSubsystem::ReleaseUnusedPools()
+{
+	int32 NumReleased = 0;
+	for(auto It = SharedPools.CreateIterator(); It; ++It)
+	{
+		// Handles only hold weak refs to their pool so outstanding objects wouldn't keep it alive, pools with active objects are kept regardless of references.
+		FBFObjectPoolBase* Pool = It->Value.Get();
+		if(It->Value.GetSharedReferenceCount() > 1 || Pool->GetPoolSize() != Pool->GetInactivePoolSize())
+			continue;
+
+		Pool->ClearInactiveObjectsPool();
+		It.RemoveCurrent();
+		++NumReleased;
+	}
+	return NumReleased;
+}
+
+
+int32 UBFObjectPoolSubsystem::GetObjectBudget() const
+{
+	return ObjectBudget >= 0 ? ObjectBudget : BF::OP::CVarObjectPoolGlobalObjectBudget.GetValueOnGameThread();
+}
+
+
+int64 UBFObjectPoolSubsystem::GetMemoryBudgetBytes() const
+{
+	if(MemoryBudgetBytes >= 0)
+		return MemoryBudgetBytes;
+
+	const float BudgetMB = BF::OP::CVarObjectPoolGlobalMemoryBudgetMB.GetValueOnGameThread();
+	return BudgetMB >= 0.f ? static_cast<int64>(BudgetMB * 1024.0 * 1024.0) : -1;
+}
+
+
+int32 UBFObjectPoolSubsystem::GetNumPooledObjects() const
+{
+	int32 NumObjects = 0;
+	for(const auto& [Key, Entry] : SharedPools)
+		NumObjects += Entry.Get()->GetPoolSize();
+	return NumObjects;
+}
+
+
+int64 UBFObjectPoolSubsystem::GetEstimatedMemoryBytes() const
+{
+	int64 NumBytes = 0;
+	for(const auto& [Key, Entry] : SharedPools)
+		NumBytes += Entry.Get()->GetPoolSize() * Entry.EstimatedBytesPerObject;
+	return NumBytes;
+}
+
+
+TStatId UBFObjectPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBFObjectPoolSubsystem, STATGROUP_Tickables);
+}
+
+
+void UBFObjectPoolSubsystem::Deinitialize()
+{
+	// Persistent pools are handed to the game instance before the rest go, the world is tearing down its actors anyway, requesters still holding a pool keep it alive until they let go.
+	if(UBFObjectPoolTravelSubsystem* TravelSubsystem = UBFObjectPoolTravelSubsystem::Get(this))
+	{
+		for(auto It = SharedPools.CreateIterator(); It; ++It)
+		{
+			if(!It->Value.Get()->GetPoolInitInfo().bPersistAcrossTravel)
+				continue;
+
+			TravelSubsystem->ParkPool(It->Key, MoveTemp(It->Value));
+			It.RemoveCurrent();
+		}
+	}
+
+	SharedPools.Empty();
+	Super::Deinitialize();
+}
+
+
+FBFSharedPoolEntry* UBFObjectPoolSubsystem::ClaimTravelledPool(const FBFSharedPoolKey& Key)
+{
+	UBFObjectPoolTravelSubsystem* TravelSubsystem = UBFObjectPoolTravelSubsystem::Get(this);
+	FBFSharedPoolEntry Entry;
+	if(!TravelSubsystem || !TravelSubsystem->ClaimPool(Key, Entry))
+		return nullptr;
+
+	Entry.Get()->MigrateToOwner(this);
+	Entry.LastUsedTime = GetWorld()->GetTimeSeconds();
+	Entry.LastSeenNumCheckouts = Entry.Get()->GetNumCheckouts();
+	return &SharedPools.Add(Key, MoveTemp(Entry));
+}
+
+
+void UBFObjectPoolSubsystem::AddSeamlessTravelActors(const UObject* WorldContextObject, TArray<AActor*>& ActorList)
+{
+	TArray<UObject*> Objects;
+	if(const UBFObjectPoolSubsystem* Subsystem = Get(WorldContextObject))
+	{
+		for(const auto& [Key, Entry] : Subsystem->SharedPools)
+		{
+			const FBFObjectPoolInitParams& Info = Entry.Get()->GetPoolInitInfo();
+			if(Info.bPersistAcrossTravel && Info.PoolType == EBFPoolType::Actor)
+				Entry.Get()->AppendInactiveObjects(Objects);
+		}
+	}
+
+	if(const UBFObjectPoolTravelSubsystem* TravelSubsystem = UBFObjectPoolTravelSubsystem::Get(WorldContextObject))
+		TravelSubsystem->AddSeamlessTravelActors(Objects);
+
+	ActorList.Reserve(ActorList.Num() + Objects.Num());
+	for(UObject* Object : Objects)
+	{
+		if(AActor* Actor = Cast<AActor>(Object); IsValid(Actor))
+			ActorList.AddUnique(Actor);
+	}
+}
+
+
+UBFObjectPoolTravelSubsystem* UBFObjectPoolTravelSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UBFObjectPoolTravelSubsystem>() : nullptr;
+}
+
+
+void UBFObjectPoolTravelSubsystem::ParkPool(const FBFSharedPoolKey& Key, FBFSharedPoolEntry&& Entry)
+{
+	Entry.Get()->ParkUnder(this);
+
+	// A pool parked again without a world claiming it in between (e.g. a transition map) just replaces the stale one.
+	ParkedPools.Add(Key, MoveTemp(Entry));
+}
+
+
+void UBFObjectPoolTravelSubsystem::AddSeamlessTravelActors(TArray<UObject*>& OutObjects) const
+{
+	for(const auto& [Key, Entry] : ParkedPools)
+	{
+		if(Entry.Get()->GetPoolInitInfo().PoolType == EBFPoolType::Actor)
+			Entry.Get()->AppendInactiveObjects(OutObjects);
+	}
+}
+
+
+void UBFObjectPoolTravelSubsystem::Deinitialize()
+{
+	ParkedPools.Empty();
+	Super::Deinitialize();
+}
@@ -0,0 +1,182 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "BFObjectPoolSubsystem.generated.h"
+
+
+// Identifies a shared pool, the template class and thread safety are part of the key since a TBFObjectPool<UObject> (BP) and a TBFObjectPool<AMyFoo> can't be handed out as one another.
+struct FBFSharedPoolKey
+{
+	TObjectKey<UClass> PoolClass;
+	TObjectKey<UClass> TemplateClass;
+	TObjectKey<UObject> Owner; // Only for component and widget pools, they need a real owner so are shared per owner rather than per world.
+	FName PoolKey;
+	bool bThreadSafe = false;
+
+	bool operator==(const FBFSharedPoolKey& Rhs) const = default;
+	friend uint32 GetTypeHash(const FBFSharedPoolKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.PoolClass), GetTypeHash(Key.TemplateClass));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Owner));
+		return HashCombine(Hash, HashCombine(GetTypeHash(Key.PoolKey), GetTypeHash(Key.bThreadSafe)));
+	}
+};
+
+
+struct FBFSharedPoolEntry
+{
+	// Only one of these is set depending on the pools ESPMode.
+	TSharedPtr<FBFObjectPoolBase, ESPMode::NotThreadSafe> Pool;
+	TSharedPtr<FBFObjectPoolBase, ESPMode::ThreadSafe> ThreadSafePool;
+
+	double LastUsedTime = 0.0; // World seconds the pool last had something checked out, drives LRU eviction.
+	int64 EstimatedBytesPerObject = 0; // Sampled once the pool has an object.
+	uint32 LastSeenNumCheckouts = 0;
+
+	FBFObjectPoolBase* Get() const { return Pool.IsValid() ? Pool.Get() : ThreadSafePool.Get(); }
+	int32 GetSharedReferenceCount() const { return Pool.IsValid() ? Pool.GetSharedReferenceCount() : ThreadSafePool.GetSharedReferenceCount(); }
+};
+
+
+/** Hands out world wide shared pools keyed by class (plus an optional key) so twenty turrets firing the same projectile share one pool instead of owning twenty.
+ * Shared pools don't register their own tick functions, the subsystem runs every pools upkeep and interval tick from its single tick and then enforces the
+ * global object/memory budget (BF.OP.GlobalObjectBudget and BF.OP.GlobalMemoryBudgetMB, or the setters below) by evicting inactive objects from the least recently used pools.
+ *
+ * The first request creates and initializes the pool from its params, later requests get the same pool back and only grow its PoolLimit if they asked for more.
+ * Actor and object pools are owned by the subsystem so they outlive whoever asked first, component and widget pools keep the requested owner and are shared per owner.
+ * Shared pools always tick in the subsystems tick (after the world tick groups), SetTickGroup has no effect on them.
+ * Pools initialized with bPersistAcrossTravel are parked on UBFObjectPoolTravelSubsystem when the world goes away and migrated into the next world that asks for them. */
+UCLASS()
+class BFOBJECTPOOLING_API UBFObjectPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	static UBFObjectPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// Returns the shared pool for the params class (PoolClass, SoftPoolClass or T) and PoolKey, creating and initializing it with Info the first time. Null if the params are invalid.
+	template<typename T, ESPMode Mode = ESPMode::NotThreadSafe>
+	TBFObjectPoolPtr<T, Mode> GetSharedPool(const FBFObjectPoolInitParams& Info, FName PoolKey = NAME_None);
+
+	/* Drops the subsystems reference to every shared pool that nobody else references and has no active objects, clearing their inactive objects.
+	 * Handy after a level section is done with, returns how many pools were released. */
+	int32 ReleaseUnusedPools();
+
+	// Evicts inactive objects from the least recently used pools until back under budget, runs every tick but can be called right after a known spike.
+	void EnforceBudget();
+
+	/* Call from your game modes (and/or player controllers) GetSeamlessTravelActorList override, adds the inactive actors of every bPersistAcrossTravel pool (live or parked)
+	 * so seamless travel carries them into the next world instead of the pool rebuilding them there. */
+	static void AddSeamlessTravelActors(const UObject* WorldContextObject, TArray<AActor*>& ActorList);
+
+	// Less than 0 falls back to the BF.OP.GlobalObjectBudget/BF.OP.GlobalMemoryBudgetMB console variables.
+	void SetObjectBudget(int32 InObjectBudget) { ObjectBudget = InObjectBudget; }
+	void SetMemoryBudgetBytes(int64 InMemoryBudgetBytes) { MemoryBudgetBytes = InMemoryBudgetBytes; }
+	int32 GetObjectBudget() const;
+	int64 GetMemoryBudgetBytes() const;
+
+	int32 GetNumSharedPools() const { return SharedPools.Num(); }
+	int32 GetNumPooledObjects() const;
+	int64 GetEstimatedMemoryBytes() const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	FBFSharedPoolKey MakeSharedPoolKey(const FBFObjectPoolInitParams& Info, UClass* PoolClass, UClass* TemplateClass, bool bThreadSafe, FName PoolKey) const;
+
+	template<typename T, ESPMode Mode>
+	static TBFObjectPoolPtr<T, Mode> GetTypedPool(const FBFSharedPoolEntry& Entry);
+
+	// Takes the pool for Key back from the travel subsystem if one was parked and migrates it into this world, returns the entry if so.
+	FBFSharedPoolEntry* ClaimTravelledPool(const FBFSharedPoolKey& Key);
+
+protected:
+	TMap<FBFSharedPoolKey, FBFSharedPoolEntry> SharedPools;
+	int32 ObjectBudget = -1;
+	int64 MemoryBudgetBytes = -1;
+};
+
+
+template <typename T, ESPMode Mode>
+TBFObjectPoolPtr<T, Mode> UBFObjectPoolSubsystem::GetTypedPool(const FBFSharedPoolEntry& Entry)
+{
+	// The key includes T and the mode so the stored pool is always exactly this type.
+	if constexpr (Mode == ESPMode::ThreadSafe)
+		return StaticCastSharedPtr<TBFObjectPool<T, Mode>>(Entry.ThreadSafePool);
+	else
+		return StaticCastSharedPtr<TBFObjectPool<T, Mode>>(Entry.Pool);
+}
+
+
+template <typename T, ESPMode Mode>
+TBFObjectPoolPtr<T, Mode> UBFObjectPoolSubsystem::GetSharedPool(const FBFObjectPoolInitParams& Info, FName PoolKey)
+{
+	bfEnsure(Info.PoolType != EBFPoolType::Invalid); // Must set the pool type.
+	if(Info.PoolType == EBFPoolType::Invalid)
+		return nullptr;
+
+	UClass* PoolClass = Info.PoolClass;
+	if(!PoolClass)
+		PoolClass = Info.SoftPoolClass.IsNull() ? T::StaticClass() : Info.SoftPoolClass.LoadSynchronous();
+	if(!PoolClass)
+		return nullptr;
+
+	const FBFSharedPoolKey Key = MakeSharedPoolKey(Info, PoolClass, T::StaticClass(), Mode == ESPMode::ThreadSafe, PoolKey);
+	const FBFSharedPoolEntry* Entry = SharedPools.Find(Key);
+	if(!Entry && Info.bPersistAcrossTravel)
+		Entry = ClaimTravelledPool(Key);
+	if(Entry)
+	{
+		TBFObjectPoolPtr<T, Mode> Pool = GetTypedPool<T, Mode>(*Entry);
+		if(Info.PoolLimit > Pool->GetPoolLimit())
+			Pool->SetPoolLimit(Info.PoolLimit);
+		return Pool;
+	}
+
+	FBFObjectPoolInitParams SharedInfo = Info;
+	SharedInfo.PoolClass = PoolClass;
+	if(Info.PoolType == EBFPoolType::Actor || Info.PoolType == EBFPoolType::Object)
+		SharedInfo.Owner = this;
+
+	TBFObjectPoolPtr<T, Mode> Pool = TBFObjectPool<T, Mode>::CreatePool();
+	Pool->SetExternallyTicked();
+	Pool->InitPool(SharedInfo);
+	if(!Pool->GetPoolInitInfo().Owner) // Init early outs before taking the params if they are invalid.
+		return nullptr;
+
+	FBFSharedPoolEntry& NewEntry = SharedPools.Add(Key);
+	if constexpr (Mode == ESPMode::ThreadSafe)
+		NewEntry.ThreadSafePool = Pool;
+	else
+		NewEntry.Pool = Pool;
+	NewEntry.LastUsedTime = GetWorld()->GetTimeSeconds();
+	return Pool;
+}
+
+
+// Holds bPersistAcrossTravel shared pools between worlds, nothing else should need to talk to this directly.
+UCLASS()
+class BFOBJECTPOOLING_API UBFObjectPoolTravelSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+public:
+	static UBFObjectPoolTravelSubsystem* Get(const UObject* WorldContextObject);
+
+	// The pool is re-homed under this subsystem so nothing keeps its old world alive.
+	void ParkPool(const FBFSharedPoolKey& Key, FBFSharedPoolEntry&& Entry);
+	bool ClaimPool(const FBFSharedPoolKey& Key, FBFSharedPoolEntry& OutEntry) { return ParkedPools.RemoveAndCopyValue(Key, OutEntry); }
+	void AddSeamlessTravelActors(TArray<UObject*>& OutObjects) const;
+	int32 GetNumParkedPools() const { return ParkedPools.Num(); }
+
+	virtual void Deinitialize() override;
+
+protected:
+	TMap<FBFSharedPoolKey, FBFSharedPoolEntry> ParkedPools;
+};
@@ -50,7 +50,7 @@ struct TBFPooledObjectHandle : public TSharedFromThis<TBFPooledObjectHandle<T, M
 
 	TBFPooledObjectHandle(const FBFPooledObjectInfo* PooledComponentInfo, TWeakPtr<TBFObjectPool<T,Mode>, Mode> OwningPool);
 	virtual ~TBFPooledObjectHandle();
-	bool operator==(const TBFPooledObjectHandle& Rhs);
+	bool operator==(const TBFPooledObjectHandle& Rhs) const;
 	T* operator->() {return GetObject();}
 
 	// Queries not only if the handle pointer is valid but also if we are stale or not (meaning we are a copy of a handle to an object that has already been returned to the pool).
@@ -65,7 +65,14 @@ struct TBFPooledObjectHandle : public TSharedFromThis<TBFPooledObjectHandle<T, M
 	// Returns the object and invalidates the handle, removing it from the pool and leaving you to own the objects lifetime, not its owner/outer (depending on the type) will still be the pools owner.
 	T* StealObject();
 
-	// An ID of -1 means invalid, otherwise the ID represents our key into the owning pools map. Use IsHandleValid() to check if the handle is valid this is just the stored ID when first taken from the pool.
+	// RecycleLowestPriority overflow pools recycle the lowest priority checkout first, reset to 0 on every checkout. Returns false if the handle is stale.
+	bool SetRecyclePriority(uint8 Priority) const { return IsHandleValid() && OwningPool.Pin()->SetRecyclePriority(ObjectPoolID, ObjectCheckoutID, Priority); }
+
+	// Pool owned curfew for this checkout, returns it after Seconds unless OnExpired is bound. See TBFObjectPool::SetCurfew.
+	bool SetCurfew(float Seconds, FSimpleDelegate OnExpired = {}) const { return IsHandleValid() && OwningPool.Pin()->SetCurfew(ObjectPoolID, ObjectCheckoutID, Seconds, MoveTemp(OnExpired)); }
+	bool ClearCurfew() const { return IsHandleValid() && OwningPool.Pin()->ClearCurfew(ObjectPoolID, ObjectCheckoutID); }
+
+	// An ID of -1 means invalid, otherwise the ID encodes our slot index and slot generation in the owning pools container. Use IsHandleValid() to check if the handle is valid this is just the stored ID when first taken from the pool.
 	int64 GetPoolID() const {return ObjectPoolID;}
 	
 	/* An ID of -1 means invalid, otherwise the ID represents unique un-pooled ID(Helps with re using objects and stale handles).
@@ -156,9 +163,9 @@ void TBFPooledObjectHandle<T, Mode>::Invalidate()
 
 
 template <typename T, ESPMode Mode>
-bool TBFPooledObjectHandle<T, Mode>::operator==(const TBFPooledObjectHandle& Rhs)
+bool TBFPooledObjectHandle<T, Mode>::operator==(const TBFPooledObjectHandle& Rhs) const
 {
-	return ObjectPoolID == Rhs.ComponentPoolID && ObjectCheckoutID == Rhs.ObjectCheckoutID;
+	return ObjectPoolID == Rhs.ObjectPoolID && ObjectCheckoutID == Rhs.ObjectCheckoutID;
 }
 
 
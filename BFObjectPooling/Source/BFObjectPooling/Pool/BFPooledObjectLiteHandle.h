@@ -0,0 +1,160 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "BFObjectPooling/Pool/Private/BFPoolContainer.h"
+#include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
+
+
+/** TBFPooledObjectLiteHandle:
+ * A plain value alternative to TBFPooledObjectHandlePtr for hot paths (projectiles, hit vfx etc.) where a heap allocated, ref counted handle per un-pool is pure overhead.
+ * Taken from the pool via `MyPool->UnpoolObjectLite(bAutoActivate)`.
+ *
+ * The handle is just a weak pointer to the pools container and the slot index + checkout ID of the object (16 bytes), it can be freely copied and stored by value.
+ * Checkout IDs carry on across slot reuse so the slot + checkout pair identifies one specific checkout, validating is a single compare against the slots current checkout ID.
+ *
+ * Unlike TBFPooledObjectHandlePtr letting copies go out of scope does NOT return the object, you must call `ReturnToPool()` (or use TBFUniquePooledObjectLiteHandle below
+ * if you want the scoped auto return behaviour). Once any copy returns or steals the object every other copy becomes invalid.
+ *
+ * Code:
+ * TBFPooledObjectLiteHandle<AMyFoo> Handle = MyPool->UnpoolObjectLite(true);
+ * if(Handle.IsHandleValid())
+ *		Handle->SomeObjectFunctionToSetThingsUp(); // Same rules as the shared handle, don't store the object itself.
+ * Handle.ReturnToPool(); // Or MyPool->ReturnToPool(Handle);
+ */
+template<typename T>
+struct TBFPooledObjectLiteHandle
+{
+	TBFPooledObjectLiteHandle() = default;
+	TBFPooledObjectLiteHandle(UBFPoolContainer* InContainer, int32 InSlotIndex, int32 InCheckoutID)
+		: Container(InContainer), SlotIndex(InSlotIndex), ObjectCheckoutID(InCheckoutID) {}
+
+	bool operator==(const TBFPooledObjectLiteHandle& Rhs) const { return SlotIndex == Rhs.SlotIndex && ObjectCheckoutID == Rhs.ObjectCheckoutID && Container == Rhs.Container; }
+	friend uint32 GetTypeHash(const TBFPooledObjectLiteHandle& Handle) { return HashCombineFast(GetTypeHash(Handle.SlotIndex), GetTypeHash(Handle.ObjectCheckoutID)); }
+	T* operator->() const { return GetObject(); }
+
+	// True if the object is still checked out under this handle, false once it has been returned or stolen (by any copy) or the pool is gone.
+	bool IsHandleValid() const
+	{
+		const UBFPoolContainer* PoolContainer = Container.Get();
+		return PoolContainer && PoolContainer->IsCheckoutValid(SlotIndex, ObjectCheckoutID);
+	}
+
+	// Returns the pooled object if the handle is still valid.
+	T* GetObject() const
+	{
+		const UBFPoolContainer* PoolContainer = Container.Get();
+		UObject* Object = PoolContainer ? PoolContainer->GetCheckedOutObject(SlotIndex, ObjectCheckoutID) : nullptr;
+		return Object ? CastChecked<T>(Object) : nullptr;
+	}
+
+	// Attempts to return the object to the pool and invalidates this handle, can fail if the object has already been returned or stolen from the pool.
+	bool ReturnToPool()
+	{
+		UBFPoolContainer* PoolContainer = Container.Get();
+		const int32 CachedSlotIndex = SlotIndex;
+		const int32 CachedCheckoutID = ObjectCheckoutID;
+		Invalidate();
+		return PoolContainer && PoolContainer->ReturnCheckedOutObject(CachedSlotIndex, CachedCheckoutID);
+	}
+
+	// Returns the object and invalidates the handle, removing it from the pool and leaving you to own the objects lifetime.
+	T* StealObject()
+	{
+		UBFPoolContainer* PoolContainer = Container.Get();
+		const int32 CachedSlotIndex = SlotIndex;
+		const int32 CachedCheckoutID = ObjectCheckoutID;
+		Invalidate();
+		UObject* Object = PoolContainer ? PoolContainer->StealCheckedOutObject(CachedSlotIndex, CachedCheckoutID) : nullptr;
+		return Object ? CastChecked<T>(Object) : nullptr;
+	}
+
+	// RecycleLowestPriority overflow pools recycle the lowest priority checkout first, reset to 0 on every checkout. Returns false if the handle is stale.
+	bool SetRecyclePriority(uint8 Priority) const
+	{
+		UBFPoolContainer* PoolContainer = Container.Get();
+		return PoolContainer && PoolContainer->SetRecyclePriority(SlotIndex, ObjectCheckoutID, Priority);
+	}
+
+	// Pool owned curfew for this checkout, returns it after Seconds unless OnExpired is bound. See UBFPoolContainer::SetCurfew.
+	bool SetCurfew(float Seconds, FSimpleDelegate OnExpired = {}) const
+	{
+		UBFPoolContainer* PoolContainer = Container.Get();
+		return PoolContainer && PoolContainer->SetCurfew(SlotIndex, ObjectCheckoutID, Seconds, MoveTemp(OnExpired));
+	}
+
+	bool ClearCurfew() const
+	{
+		UBFPoolContainer* PoolContainer = Container.Get();
+		return PoolContainer && PoolContainer->ClearCurfew(SlotIndex, ObjectCheckoutID);
+	}
+
+	// Only invalidates this copy, the object is still checked out.
+	void Invalidate()
+	{
+		Container = nullptr;
+		SlotIndex = INDEX_NONE;
+		ObjectCheckoutID = -1;
+	}
+
+	// The full pool ID (slot index + slot generation) of the object, -1 if the handle is no longer valid.
+	int64 GetPoolID() const { return IsHandleValid() ? Container->ObjectPool[SlotIndex].ObjectPoolID : -1; }
+	int32 GetCheckoutID() const { return ObjectCheckoutID; }
+	const UBFPoolContainer* GetContainer() const { return Container.Get(); }
+
+protected:
+	TWeakObjectPtr<UBFPoolContainer> Container = nullptr;
+	int32 SlotIndex = INDEX_NONE;
+	int32 ObjectCheckoutID = -1;
+};
+
+
+/** TBFUniquePooledObjectLiteHandle:
+ * Optional scoped owner for a lite handle, returns the object to the pool when destroyed (if no one else returned/stole it first). Move only, just like TUniquePtr.
+ * Still allocation free, it is the lite handle and nothing else.
+ *
+ * TBFUniquePooledObjectLiteHandle<AMyFoo> Handle{MyPool->UnpoolObjectLite(true)}; // Returned when Handle goes out of scope.
+ */
+template<typename T>
+struct TBFUniquePooledObjectLiteHandle
+{
+	TBFUniquePooledObjectLiteHandle() = default;
+	explicit TBFUniquePooledObjectLiteHandle(const TBFPooledObjectLiteHandle<T>& InHandle) : Handle(InHandle) {}
+	~TBFUniquePooledObjectLiteHandle() { Handle.ReturnToPool(); }
+
+	TBFUniquePooledObjectLiteHandle(const TBFUniquePooledObjectLiteHandle&) = delete;
+	TBFUniquePooledObjectLiteHandle& operator=(const TBFUniquePooledObjectLiteHandle&) = delete;
+
+	TBFUniquePooledObjectLiteHandle(TBFUniquePooledObjectLiteHandle&& Rhs) noexcept : Handle(Rhs.Handle) { Rhs.Handle.Invalidate(); }
+	TBFUniquePooledObjectLiteHandle& operator=(TBFUniquePooledObjectLiteHandle&& Rhs) noexcept
+	{
+		if(this != &Rhs)
+		{
+			Handle.ReturnToPool();
+			Handle = Rhs.Handle;
+			Rhs.Handle.Invalidate();
+		}
+		return *this;
+	}
+
+	T* operator->() const { return GetObject(); }
+	bool IsHandleValid() const { return Handle.IsHandleValid(); }
+	T* GetObject() const { return Handle.GetObject(); }
+	bool ReturnToPool() { return Handle.ReturnToPool(); }
+	T* StealObject() { return Handle.StealObject(); }
+	bool SetRecyclePriority(uint8 Priority) const { return Handle.SetRecyclePriority(Priority); }
+	bool SetCurfew(float Seconds, FSimpleDelegate OnExpired = {}) const { return Handle.SetCurfew(Seconds, MoveTemp(OnExpired)); }
+	bool ClearCurfew() const { return Handle.ClearCurfew(); }
+	const TBFPooledObjectLiteHandle<T>& Get() const { return Handle; }
+
+	// Gives up ownership without returning the object, it is now the callers responsibility to return it via the returned handle.
+	TBFPooledObjectLiteHandle<T> Release()
+	{
+		TBFPooledObjectLiteHandle<T> Released = Handle;
+		Handle.Invalidate();
+		return Released;
+	}
+
+protected:
+	TBFPooledObjectLiteHandle<T> Handle;
+};
@@ -0,0 +1,85 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Containers/Queue.h"
+#include "Templates/UniquePtr.h"
+#include <atomic>
+
+
+namespace BF::OP
+{
+	/* Lock free MPMC stack of container slot indices (a Treiber stack), the head packs the top slot with a tag that is bumped on every push/pop so a slot
+	 * popped and pushed back between another threads read and compare exchange can't be mistaken for an untouched head (ABA).
+	 * Links live in a fixed array sized up front, nothing is ever allocated or freed while other threads may be reading it. */
+	class FConcurrentSlotStack
+	{
+	public:
+		explicit FConcurrentSlotStack(int32 InCapacity) : Links(MakeUnique<std::atomic<int32>[]>(InCapacity)), Capacity(InCapacity) {}
+
+		void Push(int32 SlotIndex)
+		{
+			check(SlotIndex >= 0 && SlotIndex < Capacity);
+			uint64 Head = HeadAndTag.load(std::memory_order_relaxed);
+			do
+			{
+				Links[SlotIndex].store(UnpackSlot(Head), std::memory_order_relaxed);
+			}
+			while(!HeadAndTag.compare_exchange_weak(Head, Pack(SlotIndex, UnpackTag(Head) + 1), std::memory_order_release, std::memory_order_relaxed));
+			Num.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// INDEX_NONE if empty, otherwise the caller now owns the slot.
+		int32 Pop()
+		{
+			uint64 Head = HeadAndTag.load(std::memory_order_acquire);
+			while(UnpackSlot(Head) != INDEX_NONE)
+			{
+				// A stale link read here is harmless, the head (and its tag) will have moved on so the exchange fails and we retry.
+				const int32 Next = Links[UnpackSlot(Head)].load(std::memory_order_relaxed);
+				if(HeadAndTag.compare_exchange_weak(Head, Pack(Next, UnpackTag(Head) + 1), std::memory_order_acquire, std::memory_order_acquire))
+				{
+					Num.fetch_sub(1, std::memory_order_relaxed);
+					return UnpackSlot(Head);
+				}
+			}
+			return INDEX_NONE;
+		}
+
+		// Approximate while other threads are pushing/popping.
+		int32 GetNum() const { return Num.load(std::memory_order_relaxed); }
+		int32 GetCapacity() const { return Capacity; }
+
+	private:
+		static uint64 Pack(int32 SlotIndex, uint32 Tag) { return (static_cast<uint64>(Tag) << 32) | static_cast<uint32>(SlotIndex); }
+		static int32 UnpackSlot(uint64 Head) { return static_cast<int32>(Head & 0xFFFFFFFF); }
+		static uint32 UnpackTag(uint64 Head) { return static_cast<uint32>(Head >> 32); }
+
+		std::atomic<uint64> HeadAndTag{Pack(INDEX_NONE, 0)};
+		TUniquePtr<std::atomic<int32>[]> Links;
+		std::atomic<int32> Num{0};
+		int32 Capacity = 0;
+	};
+
+
+	// Checkout or return made off the game thread, replayed on the game thread (activation/deactivation, list upkeep and delegates) in the order they happened.
+	struct FConcurrentPoolOp
+	{
+		int64 PoolID = -1;
+		int32 CheckoutID = -1;
+		bool bReturned = false;
+		bool bAutoActivate = false;
+	};
+
+
+	// Only allocated for pools initialized with a ConcurrentReserve, see TBFObjectPool::UnpoolObjectConcurrent.
+	struct FConcurrentPoolState
+	{
+		explicit FConcurrentPoolState(int32 Capacity) : ReadySlots(Capacity) {}
+
+		FConcurrentSlotStack ReadySlots; // Inactive objects the game thread has handed over for worker checkouts.
+		TQueue<FConcurrentPoolOp, EQueueMode::Mpsc> PendingOps;
+		std::atomic<int32> NumMisses{0}; // Worker un-pools that found the ready stack empty, fed into adaptive sizing on the next drain.
+		std::atomic<bool> bWakePending{false}; // Set by the first op (or miss) since the last drain, which posts the one task that wakes the upkeep tick.
+	};
+}
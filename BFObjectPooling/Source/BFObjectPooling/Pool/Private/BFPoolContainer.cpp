@@ -3,12 +3,32 @@
 
 #include "BFPoolContainer.h"
 #include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
+#include "BFObjectPooling/Module/BFObjectPoolStats.h"
+#include "BFObjectPooling/Module/BFObjectPooling.h"
+#include "Components/ActorComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "GameFramework/Actor.h"
+#include "Misc/EngineVersionComparison.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Widgets/SWidget.h"
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+#include "LocalVertexFactory.h"
+#include "PSOPrecache.h"
+#endif
   
 
 void FBFPoolContainerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionEventGraph)
 {
 	if (Tickable && IsValid(Tickable) && TickType != LEVELTICK_ViewportsOnly)
-		Tickable->Tick(DeltaTime);
+	{
+		if(bUpkeep)
+			Tickable->UpkeepTick(DeltaTime);
+		else
+			Tickable->Tick(DeltaTime);
+	}
 }
 
 
@@ -19,6 +39,26 @@ UBFPoolContainer::UBFPoolContainer()
 	PrimaryContainerTick.bTickEvenWhenPaused = false;
 	PrimaryContainerTick.TickGroup = ETickingGroup::TG_DuringPhysics;
 	PrimaryContainerTick.TickInterval = TickInterval;
+
+	UpkeepContainerTick.Tickable = this;
+	UpkeepContainerTick.bUpkeep = true;
+	UpkeepContainerTick.bCanEverTick = true;
+	UpkeepContainerTick.bStartWithTickEnabled = false;
+	UpkeepContainerTick.bTickEvenWhenPaused = false;
+	UpkeepContainerTick.TickGroup = ETickingGroup::TG_PrePhysics;
+}
+
+
+void UBFPoolContainer::BeginDestroy()
+{
+	// Whatever the pool didn't clear up goes with us, take it out of the global totals.
+	BF::OP::Stats::AddObjectCounts(-NumPooledObjects, -GetNumInactive());
+	NumPooledObjects = 0;
+	InactiveList = FBFPoolSlotList();
+	BackdatedInactiveList = FBFPoolSlotList();
+	ReleaseWarmupComponents();
+	RetainedSlateWidgets.Empty();
+	Super::BeginDestroy();
 }
 
 
@@ -29,16 +69,140 @@ void UBFPoolContainer::Tick(float Dt)
 }
 
 
-void UBFPoolContainer::Init(TFunction<void(UWorld*, float)>&& TickFunc, UWorld* World, float InTickInterval)
+void UBFPoolContainer::UpkeepTick(float Dt)
+{
+	if(bPoolUpkeepRequested)
+		bPoolUpkeepRequested = OwningPoolUpkeepFunc && OwningPoolUpkeepFunc(Dt);
+
+	if(Curfews.Num() > 0)
+		AdvanceCurfews();
+
+	if(WarmupComponents.Num() > 0 && GFrameCounter > WarmupFrame)
+		ReleaseWarmupComponents();
+
+	// Building while prewarming would only be dissolved again by the next created object, warmup components aren't ours to cluster.
+	if(bClusterDirty && !bPoolUpkeepRequested && WarmupComponents.Num() == 0 && PendingWarmupAssets.Num() == 0 && FPlatformTime::Seconds() >= ClusterRebuildTime)
+		RebuildCluster();
+	
+	if(!bPoolUpkeepRequested && Curfews.Num() == 0 && WarmupComponents.Num() == 0 && !bClusterDirty)
+		UpkeepContainerTick.SetTickFunctionEnable(false);
+}
+
+
+void UBFPoolContainer::SetUpkeepFunc(TFunction<bool(float)>&& UpkeepFunc)
+{
+	OwningPoolUpkeepFunc = std::move(UpkeepFunc);
+}
+
+
+void UBFPoolContainer::Init(TFunction<void(UWorld*, float)>&& TickFunc, UWorld* World, float InTickInterval, bool bInExternallyTicked)
 {
 	bfValid(World);
 	OwningWorld = World;
-	PrimaryContainerTick.RegisterTickFunction(World->PersistentLevel);
+	bExternallyTicked = bInExternallyTicked;
+	if(bExternallyTicked)
+	{
+		// Never registered, the enabled state is still tracked on the tick functions and read by ExternalTick.
+		PrimaryContainerTick.SetTickFunctionEnable(false);
+		UpkeepContainerTick.SetTickFunctionEnable(false);
+	}
+	else
+	{
+		PrimaryContainerTick.RegisterTickFunction(World->PersistentLevel);
+		UpkeepContainerTick.RegisterTickFunction(World->PersistentLevel);
+	}
 	TickInterval = InTickInterval;
 	OwningPoolTickFunc = std::move(TickFunc);
 }
 
 
+void UBFPoolContainer::MigrateToWorld(UWorld* NewWorld, UObject* NewOuter)
+{
+	bfValid(NewOuter);
+
+	// Returned (or handed to their expiry handler) exactly as if they had run out, collected first since handlers are free to touch the wheel.
+	TArray<FBFPoolCurfew, TInlineAllocator<16>> Expired;
+	for(FBFPoolCurfew& Curfew : Curfews)
+		Expired.Add(MoveTemp(Curfew));
+	for(const FBFPoolCurfew& Curfew : Expired)
+		ClearCurfew(Curfew.SlotIndex);
+	for(FBFPoolCurfew& Curfew : Expired)
+	{
+		if(!IsCheckoutValid(Curfew.SlotIndex, Curfew.CheckoutID) || !ObjectPool[Curfew.SlotIndex].bActive)
+			continue;
+
+		if(Curfew.OnExpired.IsBound())
+			Curfew.OnExpired.Execute();
+		else if(OwningPoolReturnFunc)
+			OwningPoolReturnFunc(ObjectPool[Curfew.SlotIndex].ObjectPoolID, Curfew.CheckoutID);
+	}
+
+	if(GetOuter() != NewOuter)
+		Rename(nullptr, NewOuter, REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional);
+
+	if(!NewWorld)
+		return;
+
+	if(!bExternallyTicked && OwningWorld.Get() != NewWorld)
+	{
+		// Registration doesn't carry over, keep whatever enabled state the pools last asked for.
+		const bool bPrimaryEnabled = PrimaryContainerTick.IsTickFunctionEnabled();
+		const bool bUpkeepEnabled = UpkeepContainerTick.IsTickFunctionEnabled();
+		PrimaryContainerTick.UnRegisterTickFunction();
+		UpkeepContainerTick.UnRegisterTickFunction();
+		PrimaryContainerTick.RegisterTickFunction(NewWorld->PersistentLevel);
+		UpkeepContainerTick.RegisterTickFunction(NewWorld->PersistentLevel);
+		PrimaryContainerTick.SetTickFunctionEnable(bPrimaryEnabled);
+		UpkeepContainerTick.SetTickFunctionEnable(bUpkeepEnabled);
+	}
+	OwningWorld = NewWorld;
+}
+
+
+void UBFPoolContainer::ExternalTick(float Dt)
+{
+	bfEnsure(bExternallyTicked); // Registered containers would tick twice.
+	if(UpkeepContainerTick.IsTickFunctionEnabled())
+		UpkeepTick(Dt);
+
+	if(!PrimaryContainerTick.IsTickFunctionEnabled())
+		return;
+
+	// Same as a registered tick function with an interval, the pool is handed the time since it last ticked.
+	TimeSinceExternalTick += Dt;
+	if(TimeSinceExternalTick >= TickInterval)
+	{
+		Tick(TimeSinceExternalTick);
+		TimeSinceExternalTick = 0.f;
+	}
+}
+
+
+void UBFPoolContainer::SetOwningPoolHandleFuncs(TFunction<bool(int64, int32)>&& ReturnFunc, TFunction<UObject*(int64, int32)>&& StealFunc)
+{
+	OwningPoolReturnFunc = std::move(ReturnFunc);
+	OwningPoolStealFunc = std::move(StealFunc);
+}
+
+
+bool UBFPoolContainer::ReturnCheckedOutObject(int32 SlotIndex, int32 CheckoutID)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID) || !OwningPoolReturnFunc)
+		return false;
+	
+	return OwningPoolReturnFunc(ObjectPool[SlotIndex].ObjectPoolID, CheckoutID);
+}
+
+
+UObject* UBFPoolContainer::StealCheckedOutObject(int32 SlotIndex, int32 CheckoutID)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID) || !OwningPoolStealFunc)
+		return nullptr;
+	
+	return OwningPoolStealFunc(ObjectPool[SlotIndex].ObjectPoolID, CheckoutID);
+}
+
+
 void UBFPoolContainer::SetTickEnabled(bool bEnable)
 {
 	PrimaryContainerTick.SetTickFunctionEnable(bEnable);
@@ -53,8 +217,716 @@ void UBFPoolContainer::SetTickInterval(float InTickInterval)
 
 UClass* UBFPoolContainer::TryGetPoolType() const
 {
-	if(ObjectPool.Num() > 0)
-		return  ObjectPool[0].PooledObject->GetClass();
+	const UObject* Object = GetAnyPooledObject();
+	return Object ? Object->GetClass() : nullptr;
+}
+
+
+UObject* UBFPoolContainer::GetAnyPooledObject() const
+{
+	for(const FBFPooledObjectInfo& Info : ObjectPool)
+	{
+		if(Info.bOccupied && Info.PooledObject)
+			return Info.PooledObject;
+	}
 	
 	return nullptr;
 }
+
+
+FBFObjectPoolMemoryFootprint UBFPoolContainer::GetMemoryFootprint() const
+{
+	FBFObjectPoolMemoryFootprint Footprint;
+	for(const FBFPooledObjectInfo& Info : ObjectPool)
+	{
+		if(!Info.bOccupied || !Info.PooledObject)
+			continue;
+
+		const int64 Bytes = GetObjectMemoryBytes(Info.PooledObject);
+		if(Info.bActive)
+		{
+			Footprint.ActiveBytes += Bytes;
+			++Footprint.NumActive;
+		}
+		else
+		{
+			Footprint.InactiveBytes += Bytes;
+			++Footprint.NumInactive;
+		}
+	}
+	return Footprint;
+}
+
+
+int64 UBFPoolContainer::GetObjectMemoryBytes(const UObject* Object)
+{
+	if(!IsValid(Object))
+		return 0;
+
+	auto GetBytes = [](const UObject* Obj) -> int64
+	{
+		return Obj->GetClass()->GetStructureSize() + Obj->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+	};
+
+	int64 Bytes = GetBytes(Object);
+	if(const AActor* Actor = Cast<AActor>(Object))
+	{
+		for(const UActorComponent* Component : Actor->GetComponents())
+		{
+			if(IsValid(Component))
+				Bytes += GetBytes(Component);
+		}
+	}
+	return Bytes;
+}
+
+
+void UBFPoolContainer::SetConcurrentCapacity(int32 Capacity)
+{
+	// Re-initialized pools keep their slots, the capacity can't be below what is already there.
+	ConcurrentCapacity = Capacity == INDEX_NONE ? INDEX_NONE : FMath::Max(Capacity, ObjectPool.Num());
+	if(ConcurrentCapacity != INDEX_NONE)
+		ObjectPool.Reserve(ConcurrentCapacity);
+}
+
+
+FBFPooledObjectInfo& UBFPoolContainer::AddPooledObject(UObject* Object)
+{
+	bfValid(Object);
+	
+	int32 SlotIndex = FirstFreeSlot;
+	if(SlotIndex != INDEX_NONE)
+	{
+		FirstFreeSlot = ObjectPool[SlotIndex].NextSlot;
+	}
+	else
+	{
+		// Workers may be reading the slot array, growing past what was reserved would free it under them.
+		check(ConcurrentCapacity == INDEX_NONE || ObjectPool.Num() < ConcurrentCapacity);
+		SlotIndex = ObjectPool.AddDefaulted();
+	}
+
+	// The checkout ID carries on from the slots previous occupant so a handle to that occupant can never match this one.
+	FBFPooledObjectInfo& Info = ObjectPool[SlotIndex];
+	Info.PooledObject = Object;
+	Info.ObjectPoolID = BF::OP::MakePoolID(SlotIndex, Info.SlotGeneration);
+	Info.ObjectCheckoutID = BF::OP::NextCheckoutID(Info.ObjectCheckoutID);
+	Info.PrevSlot = INDEX_NONE;
+	Info.NextSlot = INDEX_NONE;
+	Info.bActive = false;
+	Info.bOccupied = true;
+	Info.bDormant = false;
+	Info.bInActiveList = false;
+	Info.RecyclePriority = 0;
+	Info.VariantIndex = INDEX_NONE;
+	
+	++NumPooledObjects;
+	BF::OP::Stats::AddObjectCounts(1, 0);
+	MarkClusterDirty(); // A built cluster stays valid, the new object just isn't in it until the next rebuild.
+	return Info;
+}
+
+
+bool UBFPoolContainer::ReleasePooledObject(int64 PoolID)
+{
+	FBFPooledObjectInfo* Info = FindPooledObject(PoolID);
+	if(!Info)
+		return false;
+
+	// Destroyed or stolen objects can't stay clustered, GC would keep them alive with the pool (or dissolve the whole cluster itself when it finds them garbage).
+	// Only a member leaving breaks the cluster, objects created since the last build were never in it.
+	if(IsClusterBuilt() && IsClusterMember(Info->PooledObject))
+		GUObjectClusters.DissolveCluster(this);
+	MarkClusterDirty();
+	ClearCurfew(BF::OP::GetPoolIDSlotIndex(PoolID));
+	
+	/* Inactive objects can be released directly (evicted), active ones are only in a list if the active order is tracked. Staged ones are owned by the pools ready
+	 * stack and staged count, the pool reclaims or replays them first (TBFObjectPool::ReclaimConcurrentSlots) so releasing one here would leave both pointing at it. */
+	bfEnsure(!Info->bConcurrentStaged);
+	if(Info->bConcurrentStaged)
+		Info->bConcurrentStaged = false;
+	else if(!Info->bActive)
+		UnlinkInactive(BF::OP::GetPoolIDSlotIndex(PoolID));
+	else if(Info->bInActiveList)
+		RemoveActive(PoolID);
+	
+	if(RetainedSlateWidgets.IsValidIndex(BF::OP::GetPoolIDSlotIndex(PoolID)))
+		RetainedSlateWidgets[BF::OP::GetPoolIDSlotIndex(PoolID)].Reset();
+	
+	Info->PooledObject = nullptr;
+	Info->CachedGameplayTag = FGameplayTag::EmptyTag;
+	Info->ObjectPoolID = -1;
+	Info->ObjectCheckoutID = BF::OP::NextCheckoutID(Info->ObjectCheckoutID);
+	Info->SlotGeneration = BF::OP::NextSlotGeneration(Info->SlotGeneration);
+	Info->PrevSlot = INDEX_NONE;
+	Info->NextSlot = FirstFreeSlot;
+	Info->bActive = false;
+	Info->bOccupied = false;
+	FirstFreeSlot = BF::OP::GetPoolIDSlotIndex(PoolID);
+	
+	--NumPooledObjects;
+	BF::OP::Stats::AddObjectCounts(-1, 0);
+	return true;
+}
+
+
+void UBFPoolContainer::RetainSlateWidget(int32 SlotIndex, TSharedRef<SWidget>&& SlateWidget)
+{
+	if(!RetainedSlateWidgets.IsValidIndex(SlotIndex))
+		RetainedSlateWidgets.SetNum(ObjectPool.Num());
+	RetainedSlateWidgets[SlotIndex] = MoveTemp(SlateWidget);
+}
+
+
+FBFPooledObjectInfo* UBFPoolContainer::FindPooledObject(int64 PoolID)
+{
+	const int32 SlotIndex = BF::OP::GetPoolIDSlotIndex(PoolID);
+	if(PoolID < 0 || !ObjectPool.IsValidIndex(SlotIndex))
+		return nullptr;
+
+	FBFPooledObjectInfo& Info = ObjectPool[SlotIndex];
+	if(!Info.bOccupied || Info.SlotGeneration != BF::OP::GetPoolIDGeneration(PoolID))
+		return nullptr;
+	
+	return &Info;
+}
+
+
+const FBFPooledObjectInfo* UBFPoolContainer::FindPooledObject(int64 PoolID) const
+{
+	return const_cast<UBFPoolContainer*>(this)->FindPooledObject(PoolID);
+}
+
+
+FBFPooledObjectInfo& UBFPoolContainer::FindPooledObjectChecked(int64 PoolID)
+{
+	FBFPooledObjectInfo* Info = FindPooledObject(PoolID);
+	check(Info);
+	return *Info;
+}
+
+
+void UBFPoolContainer::AddInactive(int64 PoolID)
+{
+	const int32 Slot = BF::OP::GetPoolIDSlotIndex(PoolID);
+	const float Time = FindPooledObjectChecked(PoolID).LastTimeActive;
+
+	// Returns stamp "now" so they always append to the main list, backdated new objects append to their own list instead of walking into the middle of it.
+	const bool bBackdated = InactiveList.Tail != INDEX_NONE && ObjectPool[InactiveList.Tail].LastTimeActive > Time;
+	FBFPoolSlotList& List = bBackdated ? BackdatedInactiveList : InactiveList;
+
+	// Backdated stamps rise with the world clock too so this doesn't walk, it only keeps the list sorted should a caller ever stamp out of order.
+	int32 After = List.Tail;
+	while(After != INDEX_NONE && ObjectPool[After].LastTimeActive > Time)
+		After = ObjectPool[After].PrevSlot;
+
+	LinkAfter(List, Slot, After);
+	ObjectPool[Slot].bInBackdatedList = bBackdated;
+	BF::OP::Stats::AddObjectCounts(0, 1);
+
+	FBFPooledObjectInfo& Info = ObjectPool[Slot];
+	if(Info.CachedGameplayTag.IsValid())
+	{
+		TArray<int32>& Bucket = InactiveTagBuckets.FindOrAdd(Info.CachedGameplayTag);
+		Info.TagBucketIndex = Bucket.Add(Slot);
+	}
+	LinkVariantBucket(Slot);
+}
+
+
+void UBFPoolContainer::RemoveInactive(int64 PoolID)
+{
+	bfEnsure(FindPooledObject(PoolID) && !FindPooledObject(PoolID)->bActive);
+	UnlinkInactive(BF::OP::GetPoolIDSlotIndex(PoolID));
+}
+
+
+void UBFPoolContainer::UnlinkInactive(int32 Slot)
+{
+	Unlink(ObjectPool[Slot].bInBackdatedList ? BackdatedInactiveList : InactiveList, Slot);
+	ObjectPool[Slot].bInBackdatedList = false;
+	BF::OP::Stats::AddObjectCounts(0, -1);
+
+	UnlinkVariantBucket(Slot);
+	FBFPooledObjectInfo& Info = ObjectPool[Slot];
+	if(Info.TagBucketIndex == INDEX_NONE)
+		return;
+
+	// Swap remove and patch up the index of whichever slot got moved into our place.
+	TArray<int32>& Bucket = InactiveTagBuckets.FindChecked(Info.CachedGameplayTag);
+	Bucket.RemoveAtSwap(Info.TagBucketIndex);
+	if(Bucket.IsValidIndex(Info.TagBucketIndex))
+		ObjectPool[Bucket[Info.TagBucketIndex]].TagBucketIndex = Info.TagBucketIndex;
+	
+	Info.TagBucketIndex = INDEX_NONE;
+}
+
+
+void UBFPoolContainer::SetVariant(int64 PoolID, int32 VariantIndex)
+{
+	FBFPooledObjectInfo& Info = FindPooledObjectChecked(PoolID);
+	if(Info.VariantIndex == VariantIndex)
+		return;
+
+	const int32 Slot = BF::OP::GetPoolIDSlotIndex(PoolID);
+	UnlinkVariantBucket(Slot);
+	Info.VariantIndex = VariantIndex;
+	if(!Info.bActive && !Info.bConcurrentStaged)
+		LinkVariantBucket(Slot);
+}
+
+
+int64 UBFPoolContainer::FindInactiveByVariant(int32 VariantIndex) const
+{
+	return InactiveVariantBuckets.IsValidIndex(VariantIndex) && InactiveVariantBuckets[VariantIndex].Num() > 0 ? ObjectPool[InactiveVariantBuckets[VariantIndex].Last()].ObjectPoolID : -1;
+}
+
+
+void UBFPoolContainer::LinkVariantBucket(int32 Slot)
+{
+	FBFPooledObjectInfo& Info = ObjectPool[Slot];
+	if(Info.VariantIndex == INDEX_NONE)
+		return;
+
+	if(!InactiveVariantBuckets.IsValidIndex(Info.VariantIndex))
+		InactiveVariantBuckets.SetNum(Info.VariantIndex + 1);
+	Info.VariantBucketIndex = InactiveVariantBuckets[Info.VariantIndex].Add(Slot);
+}
+
+
+void UBFPoolContainer::UnlinkVariantBucket(int32 Slot)
+{
+	FBFPooledObjectInfo& Info = ObjectPool[Slot];
+	if(Info.VariantBucketIndex == INDEX_NONE)
+		return;
+
+	// Same swap remove as the tag buckets.
+	TArray<int32>& Bucket = InactiveVariantBuckets[Info.VariantIndex];
+	Bucket.RemoveAtSwap(Info.VariantBucketIndex);
+	if(Bucket.IsValidIndex(Info.VariantBucketIndex))
+		ObjectPool[Bucket[Info.VariantBucketIndex]].VariantBucketIndex = Info.VariantBucketIndex;
+
+	Info.VariantBucketIndex = INDEX_NONE;
+}
+
+
+void UBFPoolContainer::AddActive(int64 PoolID)
+{
+	if(!bTrackActiveOrder)
+		return;
+	
+	FBFPooledObjectInfo& Info = FindPooledObjectChecked(PoolID);
+	bfEnsure(Info.bActive && !Info.bInActiveList);
+	LinkTail(ActiveList, BF::OP::GetPoolIDSlotIndex(PoolID));
+	Info.bInActiveList = true;
+}
+
+
+void UBFPoolContainer::RemoveActive(int64 PoolID)
+{
+	FBFPooledObjectInfo* Info = FindPooledObject(PoolID);
+	if(!Info || !Info->bInActiveList)
+		return;
+	
+	Unlink(ActiveList, BF::OP::GetPoolIDSlotIndex(PoolID));
+	Info->bInActiveList = false;
+}
+
+
+int64 UBFPoolContainer::FindLowestPriorityActive(int32 MaxToConsider) const
+{
+	int32 Lowest = INDEX_NONE;
+	for(int32 Slot = ActiveList.Head; Slot != INDEX_NONE && MaxToConsider-- > 0; Slot = ObjectPool[Slot].NextSlot)
+	{
+		if(Lowest == INDEX_NONE || ObjectPool[Slot].RecyclePriority < ObjectPool[Lowest].RecyclePriority)
+			Lowest = Slot;
+		if(ObjectPool[Lowest].RecyclePriority == 0) // Can't get any lower and the oldest wins ties.
+			break;
+	}
+	return Lowest != INDEX_NONE ? ObjectPool[Lowest].ObjectPoolID : -1;
+}
+
+
+bool UBFPoolContainer::SetRecyclePriority(int32 SlotIndex, int32 CheckoutID, uint8 Priority)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID) || !ObjectPool[SlotIndex].bActive)
+		return false;
+	
+	ObjectPool[SlotIndex].RecyclePriority = Priority;
+	return true;
+}
+
+
+bool UBFPoolContainer::SetCurfew(int32 SlotIndex, int32 CheckoutID, float Seconds, FSimpleDelegate&& OnExpired)
+{
+	LLM_SCOPE_BYTAG(BFObjectPool);
+	const UWorld* World = OwningWorld.Get();
+	if(!World || !IsCheckoutValid(SlotIndex, CheckoutID) || !ObjectPool[SlotIndex].bActive)
+		return false;
+
+	ClearCurfew(SlotIndex);
+	const double Now = World->GetTimeSeconds();
+	if(Curfews.Num() == 0)
+	{
+		// Nothing pending so the cursor can be re-synced (and the resolution picked up) without skipping anything.
+		if(CurfewWheel.Num() == 0)
+			CurfewWheel.Init(INDEX_NONE, NumCurfewBuckets);
+		CurfewTickSeconds = FMath::Max(BF::OP::CVarObjectPoolCurfewResolution.GetValueOnGameThread(), 0.001f);
+		CurfewTick = FMath::FloorToInt64(Now / CurfewTickSeconds);
+	}
+
+	// Rounded up so a curfew never fires early, and always at least the next tick.
+	FBFPoolCurfew Curfew;
+	Curfew.OnExpired = MoveTemp(OnExpired);
+	Curfew.ExpireTick = FMath::Max(FMath::CeilToInt64((Now + FMath::Max(Seconds, 0.f)) / CurfewTickSeconds), CurfewTick + 1);
+	Curfew.SlotIndex = SlotIndex;
+	Curfew.CheckoutID = CheckoutID;
+
+	int32& BucketHead = CurfewWheel[Curfew.ExpireTick % NumCurfewBuckets];
+	Curfew.NextCurfew = BucketHead;
+	const int32 CurfewIndex = Curfews.Add(MoveTemp(Curfew));
+	if(BucketHead != INDEX_NONE)
+		Curfews[BucketHead].PrevCurfew = CurfewIndex;
+	BucketHead = CurfewIndex;
+
+	ObjectPool[SlotIndex].CurfewIndex = CurfewIndex;
+	UpkeepContainerTick.SetTickFunctionEnable(true);
+	return true;
+}
+
+
+bool UBFPoolContainer::ClearCurfew(int32 SlotIndex, int32 CheckoutID)
+{
+	if(!IsCheckoutValid(SlotIndex, CheckoutID) || ObjectPool[SlotIndex].CurfewIndex == INDEX_NONE)
+		return false;
+
+	ClearCurfew(SlotIndex);
+	return true;
+}
+
+
+void UBFPoolContainer::ClearCurfew(int32 SlotIndex)
+{
+	if(!ObjectPool.IsValidIndex(SlotIndex) || ObjectPool[SlotIndex].CurfewIndex == INDEX_NONE)
+		return;
+
+	const int32 CurfewIndex = ObjectPool[SlotIndex].CurfewIndex;
+	const FBFPoolCurfew& Curfew = Curfews[CurfewIndex];
+	if(Curfew.PrevCurfew != INDEX_NONE)
+		Curfews[Curfew.PrevCurfew].NextCurfew = Curfew.NextCurfew;
+	else
+		CurfewWheel[Curfew.ExpireTick % NumCurfewBuckets] = Curfew.NextCurfew;
+
+	if(Curfew.NextCurfew != INDEX_NONE)
+		Curfews[Curfew.NextCurfew].PrevCurfew = Curfew.PrevCurfew;
+
+	Curfews.RemoveAt(CurfewIndex);
+	ObjectPool[SlotIndex].CurfewIndex = INDEX_NONE;
+}
+
+
+void UBFPoolContainer::AdvanceCurfews()
+{
+	const UWorld* World = OwningWorld.Get();
+	if(!World)
+		return;
+	
+	const int64 NowTick = FMath::FloorToInt64(World->GetTimeSeconds() / CurfewTickSeconds);
+	if(NowTick <= CurfewTick)
+		return;
+
+	// A hitch longer than a lap only needs every bucket visiting once.
+	TArray<FBFPoolCurfew, TInlineAllocator<16>> Expired;
+	for(int64 Tick = FMath::Max(CurfewTick + 1, NowTick - NumCurfewBuckets + 1); Tick <= NowTick; ++Tick)
+	{
+		for(int32 CurfewIndex = CurfewWheel[Tick % NumCurfewBuckets]; CurfewIndex != INDEX_NONE;)
+		{
+			FBFPoolCurfew& Curfew = Curfews[CurfewIndex];
+			CurfewIndex = Curfew.NextCurfew;
+			if(Curfew.ExpireTick > NowTick)
+				continue; // A later lap.
+
+			const int32 SlotIndex = Curfew.SlotIndex;
+			Expired.Add(MoveTemp(Curfew));
+			ClearCurfew(SlotIndex);
+		}
+	}
+	CurfewTick = NowTick;
+
+	// Pulled out of the wheel first so expiry handlers are free to set new curfews or return other objects.
+	SCOPED_NAMED_EVENT(UBFPoolContainer_ExpireCurfews, FColor::Green);
+	for(FBFPoolCurfew& Curfew : Expired)
+	{
+		if(!IsCheckoutValid(Curfew.SlotIndex, Curfew.CheckoutID) || !ObjectPool[Curfew.SlotIndex].bActive)
+			continue; // Returned by an earlier handler in this batch.
+
+		if(Curfew.OnExpired.IsBound())
+			Curfew.OnExpired.Execute();
+		else if(OwningPoolReturnFunc)
+			OwningPoolReturnFunc(ObjectPool[Curfew.SlotIndex].ObjectPoolID, Curfew.CheckoutID);
+	}
+}
+
+
+int64 UBFPoolContainer::FindInactiveByTag(const FGameplayTag& Tag, bool bExactMatch) const
+{
+	if(bExactMatch)
+	{
+		const TArray<int32>* Bucket = InactiveTagBuckets.Find(Tag);
+		return Bucket && Bucket->Num() > 0 ? ObjectPool[Bucket->Last()].ObjectPoolID : -1;
+	}
+
+	// Distinct tags per pool are few so walking the buckets is cheap compared to walking objects.
+	for(const auto& [BucketTag, Bucket] : InactiveTagBuckets)
+	{
+		if(Bucket.Num() > 0 && BucketTag.MatchesTag(Tag))
+			return ObjectPool[Bucket.Last()].ObjectPoolID;
+	}
+	return -1;
+}
+
+
+int64 UBFPoolContainer::FindInactiveByTags(const FGameplayTagContainer& Tags, bool bExactMatch) const
+{
+	for(const auto& [BucketTag, Bucket] : InactiveTagBuckets)
+	{
+		if(Bucket.Num() == 0)
+			continue;
+		
+		if(bExactMatch ? Tags.HasTagExact(BucketTag) : BucketTag.MatchesAny(Tags))
+			return ObjectPool[Bucket.Last()].ObjectPoolID;
+	}
+	return -1;
+}
+
+
+void UBFPoolContainer::LinkTail(FBFPoolSlotList& List, int32 Slot)
+{
+	LinkAfter(List, Slot, List.Tail);
+}
+
+
+void UBFPoolContainer::LinkAfter(FBFPoolSlotList& List, int32 Slot, int32 AfterSlot)
+{
+	FBFPooledObjectInfo& Info = ObjectPool[Slot];
+	Info.PrevSlot = AfterSlot;
+	
+	if(AfterSlot == INDEX_NONE) // Becomes the new head.
+	{
+		Info.NextSlot = List.Head;
+		List.Head = Slot;
+	}
+	else
+	{
+		Info.NextSlot = ObjectPool[AfterSlot].NextSlot;
+		ObjectPool[AfterSlot].NextSlot = Slot;
+	}
+
+	if(Info.NextSlot != INDEX_NONE)
+		ObjectPool[Info.NextSlot].PrevSlot = Slot;
+	else
+		List.Tail = Slot;
+
+	++List.Num;
+}
+
+
+void UBFPoolContainer::Unlink(FBFPoolSlotList& List, int32 Slot)
+{
+	FBFPooledObjectInfo& Info = ObjectPool[Slot];
+	
+	if(Info.PrevSlot != INDEX_NONE)
+		ObjectPool[Info.PrevSlot].NextSlot = Info.NextSlot;
+	else
+		List.Head = Info.NextSlot;
+
+	if(Info.NextSlot != INDEX_NONE)
+		ObjectPool[Info.NextSlot].PrevSlot = Info.PrevSlot;
+	else
+		List.Tail = Info.PrevSlot;
+
+	Info.PrevSlot = INDEX_NONE;
+	Info.NextSlot = INDEX_NONE;
+	--List.Num;
+}
+
+
+void UBFPoolContainer::SetClusterObjects(bool bEnabled)
+{
+	if(GIsEditor)
+		bEnabled = false; // Editor worlds re-instance and edit objects under us, clusters are a cooked game optimization anyway.
+
+	if(bClusterObjects == bEnabled)
+		return;
+
+	if(IsClusterBuilt())
+		GUObjectClusters.DissolveCluster(this);
+	bClusterObjects = bEnabled;
+	bClusterDirty = bEnabled && NumPooledObjects > 0;
+}
+
+
+void UBFPoolContainer::MarkClusterDirty()
+{
+	if(!bClusterObjects)
+		return;
+
+	// Every membership change pushes the rebuild back, so a pool that keeps growing/evicting rebuilds once it goes quiet rather than once per change.
+	bClusterDirty = true;
+	ClusterRebuildTime = FPlatformTime::Seconds() + FMath::Max(BF::OP::CVarObjectPoolGCClusterRebuildDelay.GetValueOnGameThread(), 0.f);
+	UpkeepContainerTick.SetTickFunctionEnable(true);
+}
+
+
+void UBFPoolContainer::RebuildCluster()
+{
+	bClusterDirty = false;
+	if(!bClusterObjects || IsUnreachable() || IsGarbageCollecting())
+		return;
+
+	// Still built if only objects were added since, those have to be folded in.
+	if(IsClusterBuilt())
+		GUObjectClusters.DissolveCluster(this);
+	
+	if(NumPooledObjects == 0)
+		return;
+
+	// Follows our reflected references (the slot array) to the pooled objects and from them to their subobjects, anything that can't be clustered stays a normal reference.
+	CreateCluster();
+}
+
+
+bool UBFPoolContainer::IsClusterMember(const UObject* Object) const
+{
+	if(!Object)
+		return false;
+
+	const FUObjectItem* ObjectItem = GUObjectArray.ObjectToObjectItem(Object);
+	return ObjectItem && ObjectItem->GetOwnerIndex() == GUObjectArray.ObjectToIndex(this);
+}
+
+
+void UBFPoolContainer::BeginSizingRecording(UClass* PoolClass)
+{
+	SizingRecording = MakeUnique<FBFPoolSizingRecording>();
+	SizingRecording->PoolClass = PoolClass;
+	SizingRecording->StartTime = OwningWorld.IsValid() ? OwningWorld->GetTimeSeconds() : 0.f;
+}
+
+
+void UBFPoolContainer::RecordSizingPeak(int32 NumActive)
+{
+	SizingRecording->PeakActive = NumActive;
+	if(OwningWorld.IsValid())
+		SizingRecording->TimeToPeakSeconds = OwningWorld->GetTimeSeconds() - SizingRecording->StartTime;
+}
+
+
+void UBFPoolContainer::QueueAssetWarmup(TConstArrayView<TSoftObjectPtr<UObject>> Assets, bool bHiddenActivation)
+{
+	bWarmupActivation = bHiddenActivation;
+	
+	// Popped from the back, so queue in reverse to warm them in the order they were given.
+	for(int32 i = Assets.Num() - 1; i >= 0; --i)
+	{
+		// Anything that didn't load is skipped, its first activation just pays for it like it always has.
+		if(UObject* Asset = Assets[i].Get())
+			PendingWarmupAssets.AddUnique(Asset);
+	}
+}
+
+
+bool UBFPoolContainer::TickAssetWarmup(double EndTime)
+{
+	SCOPED_NAMED_EVENT(UBFPoolContainer_TickAssetWarmup, FColor::Green);
+	while(PendingWarmupAssets.Num() > 0)
+	{
+		WarmupAsset(PendingWarmupAssets.Pop());
+		if(FPlatformTime::Seconds() >= EndTime)
+			break;
+	}
+	return PendingWarmupAssets.Num() > 0;
+}
+
+
+static void PrecacheComponentPSOs(UPrimitiveComponent* Component)
+{
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+	if(IsComponentPSOPrecachingEnabled())
+		Component->PrecachePSOs();
+#endif
+}
+
+
+void UBFPoolContainer::WarmupAsset(UObject* Asset)
+{
+	if(!IsValid(Asset))
+		return;
+
+	/* The transient components are never registered (bar hidden activations) and only exist to gather what the asset would need, the same way a pooled object would.
+	 * The precache requests don't reference the component, so they are destroyed straight away instead of lingering until GC. */
+	if(UNiagaraSystem* System = Cast<UNiagaraSystem>(Asset))
+	{
+#if WITH_EDITOR
+		System->WaitForCompilationComplete(); // Cooked builds only ever have compiled systems.
+#endif
+		UNiagaraComponent* Component = NewObject<UNiagaraComponent>(this, NAME_None, RF_Transient);
+		Component->SetAutoActivate(false);
+		Component->SetAsset(System);
+		PrecacheComponentPSOs(Component);
+		
+		if(bWarmupActivation && OwningWorld.IsValid())
+		{
+			Component->SetAllowScalability(false);
+			Component->SetRenderInMainPass(false);
+			Component->SetRenderInDepthPass(false);
+			Component->SetCastShadow(false);
+			Component->RegisterComponentWithWorld(OwningWorld.Get());
+			Component->Activate(true);
+			WarmupComponents.Add(Component);
+			WarmupFrame = GFrameCounter;
+			RequestUpkeep();
+		}
+		else
+		{
+			Component->DestroyComponent();
+		}
+		return;
+	}
+
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+	if(UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset))
+	{
+		UStaticMeshComponent* Component = NewObject<UStaticMeshComponent>(this, NAME_None, RF_Transient);
+		Component->SetStaticMesh(StaticMesh);
+		PrecacheComponentPSOs(Component);
+		Component->DestroyComponent();
+	}
+	else if(USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Asset))
+	{
+		USkeletalMeshComponent* Component = NewObject<USkeletalMeshComponent>(this, NAME_None, RF_Transient);
+		Component->SetSkeletalMeshAsset(SkeletalMesh);
+		PrecacheComponentPSOs(Component);
+		Component->DestroyComponent();
+	}
+	else if(UMaterialInterface* Material = Cast<UMaterialInterface>(Asset); Material && IsComponentPSOPrecachingEnabled())
+	{
+		// Materials swapped in by a description are mostly drawn through the local vertex factory (static meshes, decals), which is what their components would ask for.
+		FPSOPrecacheVertexFactoryDataList VertexFactories;
+		VertexFactories.Add(FPSOPrecacheVertexFactoryData(&FLocalVertexFactory::StaticType));
+		TArray<FMaterialPSOPrecacheRequestID> RequestIDs;
+		Material->PrecachePSOs(VertexFactories, FPSOPrecacheParams(), EPSOPrecachePriority::High, RequestIDs);
+	}
+#endif
+}
+
+
+void UBFPoolContainer::ReleaseWarmupComponents()
+{
+	for(UPrimitiveComponent* Component : WarmupComponents)
+	{
+		if(IsValid(Component))
+			Component->DestroyComponent();
+	}
+	WarmupComponents.Reset();
+}
@@ -2,8 +2,26 @@
 // Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
 
 #pragma once
+#include "GameplayTagContainer.h"
+#include "BFObjectPooling/Module/BFObjectPoolStats.h"
 #include "BFPoolContainer.generated.h"
 
+class UPrimitiveComponent;
+class SWidget;
+
+
+namespace BF::OP
+{
+	/* Pool IDs are a slot index into the containers slot array in the low 32 bits and the slots generation in the high 32 bits, this means a lookup is a single array index
+	 * and a generation compare instead of a hash lookup. The generation is bumped every time a slot is released so stale pool IDs never resolve to a newer object. */
+	FORCEINLINE int64 MakePoolID(int32 SlotIndex, uint32 Generation) { return (static_cast<int64>(Generation) << 32) | static_cast<uint32>(SlotIndex); }
+	FORCEINLINE int32 GetPoolIDSlotIndex(int64 PoolID) { return static_cast<int32>(PoolID & 0xFFFFFFFF); }
+	FORCEINLINE uint32 GetPoolIDGeneration(int64 PoolID) { return static_cast<uint32>(static_cast<uint64>(PoolID) >> 32); }
+
+	// Generations and checkout IDs are kept positive since -1 is used everywhere as the invalid ID.
+	FORCEINLINE uint32 NextSlotGeneration(uint32 Generation) { return Generation >= MAX_int32 ? 0 : Generation + 1; }
+	FORCEINLINE int32 NextCheckoutID(int32 CheckoutID) { return CheckoutID >= MAX_int32 || CheckoutID < 0 ? 0 : CheckoutID + 1; }
+}
 
 
 
@@ -16,11 +34,25 @@ public:
 	UPROPERTY(Transient)
 	TObjectPtr<UObject> PooledObject;
 	
-	int64 ObjectPoolID = 0; // Statically assigned ID for each new object.
+	int64 ObjectPoolID = -1; // Slot index + slot generation, see BF::OP::MakePoolID. Assigned by the container when the slot is claimed.
 	float CreationTime = 0.0f; // Time the object was created in game world seconds.
-	float LastTimeActive = 0.0f; // Last time this object was used in game world seconds, for culling inactive pool objects if that behaviour is enabled.
-	int16 ObjectCheckoutID = -1; // Every time an object is used from the pool and returned we increment this ID to ensure that other stale handles dont think they are the same just because their pool ID is the same.
+	float LastTimeActive = 0.0f; // Time this object was last returned to the pool (or created) in game world seconds, drives cooldowns and culling inactive pool objects if that behaviour is enabled.
+	int32 ObjectCheckoutID = -1; // Every time an object is used from the pool and returned we increment this ID to ensure that other stale handles dont think they are the same just because their pool ID is the same.
+	uint32 SlotGeneration = 0; // Bumped when the slot is released, carried over to the next object that claims the slot.
+	int32 PrevSlot = INDEX_NONE; // Intrusive links for whichever list the slot is currently in, the free list only uses NextSlot.
+	int32 NextSlot = INDEX_NONE;
+	int32 TagBucketIndex = INDEX_NONE; // Index into the inactive tag bucket for CachedGameplayTag while inactive.
+	int32 VariantIndex = INDEX_NONE; // Pool groups only (TBFObjectPoolGroup), which class + description variant the object currently is.
+	int32 VariantBucketIndex = INDEX_NONE; // Index into the inactive variant bucket for VariantIndex while inactive.
+	FGameplayTag CachedGameplayTag; // Cached result of the IF GetObjectGameplayTag, refreshed when the object is created and each time its returned to the pool.
 	uint8 bActive:1 = false; // Flag to determine if this object is currently in use or not.
+	uint8 bOccupied:1 = false; // False when the slot is sitting in the free list waiting to be reused.
+	uint8 RecyclePriority = 0; // Set by the current user of the checkout, RecycleLowestPriority overflow recycles the lowest first. Reset on every checkout.
+	uint8 bDormant:1 = false; // Inactive and put to sleep by the pools EBFPoolDormancy level, woken before it is activated again.
+	uint8 bInActiveList:1 = false; // Checked out and linked into the active list, only pools with a recycling overflow policy track this.
+	uint8 bConcurrentStaged:1 = false; // In a thread safe pools ready stack (or checked out by a worker and not replayed yet), neither active nor inactive.
+	uint8 bInBackdatedList:1 = false; // Inactive and in the containers backdated list rather than the main inactive list, see AddInactive.
+	int32 CurfewIndex = INDEX_NONE; // Entry in the containers curfew wheel while checked out with a curfew.
 };
 
 
@@ -30,6 +62,7 @@ struct FBFPoolContainerTickFunction : public FTickFunction
 	GENERATED_BODY()
 public:
 	TObjectPtr<class UBFPoolContainer> Tickable;
+	uint8 bUpkeep : 1 = false; // Routes to UBFPoolContainer::UpkeepTick instead of Tick.
 	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionEventGraph) override;
 	virtual FString DiagnosticMessage() override {return TEXT("BFObjectPoolingTickFunction");}
 	virtual FName DiagnosticContext(bool bDetailed) override {return FName(TEXT("BFObjectPoolingTickFunction"));}
@@ -40,6 +73,40 @@ struct TStructOpsTypeTraits<FBFPoolContainerTickFunction> : public TStructOpsTyp
 
 
 
+// Head and tail of an intrusive doubly linked list threaded through the containers slots via PrevSlot/NextSlot.
+struct FBFPoolSlotList
+{
+	int32 Head = INDEX_NONE;
+	int32 Tail = INDEX_NONE;
+	int32 Num = 0;
+};
+
+
+// A pending curfew for one checkout, linked into its wheel bucket. The active list already uses the slot links so these have their own.
+struct FBFPoolCurfew
+{
+	FSimpleDelegate OnExpired; // Unbound just returns the object to the pool.
+	int64 ExpireTick = 0;
+	int32 SlotIndex = INDEX_NONE;
+	int32 CheckoutID = -1;
+	int32 PrevCurfew = INDEX_NONE;
+	int32 NextCurfew = INDEX_NONE;
+};
+
+
+// Demand a pool has seen since InitPool while BF.OP.RecordSizingProfiles was enabled, merged into UBFObjectPoolSizingProfiles on world cleanup.
+struct FBFPoolSizingRecording
+{
+	TWeakObjectPtr<UClass> PoolClass;
+	float StartTime = 0.f;
+	float TimeToPeakSeconds = 0.f;
+	int32 PeakActive = 0;
+	int32 NumMisses = 0;
+	// Set once merged, BF.OP.SaveSizingProfiles merges mid session and world cleanup merges again, only the first one counts as a session.
+	bool bMerged = false;
+};
+
+
 // Internal use only, it was this or I add the pooled object to the RootSet or use TStrongObjectPtr. One extra object per pool is not a big deal at all.
 UCLASS(meta = (Hidden))
 class BFOBJECTPOOLING_API UBFPoolContainer : public UObject
@@ -47,27 +114,227 @@ class BFOBJECTPOOLING_API UBFPoolContainer : public UObject
 	GENERATED_BODY()
 public:
 	UBFPoolContainer();
+	virtual void BeginDestroy() override;
+	virtual bool CanBeClusterRoot() const override { return bClusterObjects; }
 	virtual void Tick(float Dt);
-	void Init(TFunction<void(UWorld*, float)>&& TickFunc, UWorld* World, float TickInterval);
+	// Externally ticked containers never register their tick functions, the owner (UBFObjectPoolSubsystem) calls ExternalTick once per frame instead.
+	void Init(TFunction<void(UWorld*, float)>&& TickFunc, UWorld* World, float TickInterval, bool bInExternallyTicked = false);
+	// Runs the upkeep and the interval based tick the same way the registered tick functions would, only for externally ticked containers.
+	void ExternalTick(float Dt);
+	/* Moves the container under NewOuter and its tick functions to the new worlds persistent level, see TBFObjectPool::MigrateToOwner. NewWorld is null when parking.
+	 * Pending curfews are expired first, their checkouts were for the old world and the wheel runs on its clock. */
+	void MigrateToWorld(UWorld* NewWorld, UObject* NewOuter);
+
+	/* Separate every frame tick for time sliced work (prewarming etc.), it is disabled until RequestUpkeep() is called and disables itself again
+	 * as soon as the upkeep func returns false so an idle pool costs nothing. */
+	virtual void UpkeepTick(float Dt);
+	void SetUpkeepFunc(TFunction<bool(float)>&& UpkeepFunc);
+	void RequestUpkeep() { bPoolUpkeepRequested = true; UpkeepContainerTick.SetTickFunctionEnable(true); }
+	// Lite handles only know about the container, these route their return/steal requests back into the owning pool.
+	void SetOwningPoolHandleFuncs(TFunction<bool(int64, int32)>&& ReturnFunc, TFunction<UObject*(int64, int32)>&& StealFunc);
 	void SetTickGroup(ETickingGroup InTickGroup) {PrimaryContainerTick.TickGroup = InTickGroup;}
+	void SetUpkeepTickGroup(ETickingGroup InTickGroup) {UpkeepContainerTick.TickGroup = InTickGroup;}
 	void SetTickEnabled(bool bEnable);
 	void SetTickInterval(float InTickInterval);
 	bool GetTickEnabled() const {return PrimaryContainerTick.IsTickFunctionEnabled();}
 	UClass* TryGetPoolType() const;
+	UObject* GetAnyPooledObject() const;
+	UWorld* GetOwningWorld() const { return OwningWorld.Get(); }
+
+	// Virtualized widget pools, holds the slots Slate widget while its UUserWidget is detached so re-attaching reuses it rather than rebuilding. Dropped when the slot is released.
+	void RetainSlateWidget(int32 SlotIndex, TSharedRef<SWidget>&& SlateWidget);
+
+	// Walks every pooled object, debug/tooling cost rather than something to call every frame.
+	FBFObjectPoolMemoryFootprint GetMemoryFootprint() const;
+	/* The objects class size plus its exclusive GetResourceSizeEx, actors also add each of their components the same way. Exclusive so shared assets (meshes, textures...)
+	 * aren't counted once per object, this is what destroying the object would actually give back. */
+	static int64 GetObjectMemoryBytes(const UObject* Object);
+
+	// Claims a free slot (or appends a new one) for the object and assigns its pool ID. The returned reference is only valid until the next AddPooledObject call.
+	FBFPooledObjectInfo& AddPooledObject(UObject* Object);
+	
+	// Releases the slot back to the free list, bumping its generation so the old pool ID can never resolve again. Returns false if the ID is stale.
+	bool ReleasePooledObject(int64 PoolID);
+
+	// O(1) lookup, returns nullptr if the ID is stale or the slot is unoccupied.
+	FBFPooledObjectInfo* FindPooledObject(int64 PoolID);
+	const FBFPooledObjectInfo* FindPooledObject(int64 PoolID) const;
+	FBFPooledObjectInfo& FindPooledObjectChecked(int64 PoolID);
+
+	// Number of occupied slots, not the size of the slot array.
+	int32 GetNumPooledObjects() const { return NumPooledObjects; }
+	void ReserveSlots(int32 NumSlots) { if(ConcurrentCapacity == INDEX_NONE) ObjectPool.Reserve(NumSlots); }
+	/* Thread safe pools used from workers reserve the slot array once for the most they can ever hold, after which it must never reallocate since workers index it
+	 * directly. INDEX_NONE for game thread only pools. */
+	void SetConcurrentCapacity(int32 Capacity);
+	int32 GetConcurrentCapacity() const { return ConcurrentCapacity; }
+
+	/* Inactive objects are kept in two lists each sorted by LastTimeActive (oldest at the head). Returned objects are stamped "now" and always append to the main list,
+	 * new objects are backdated by the cooldown so they are instantly available and would land in the middle of it, they append to the backdated list instead, whose
+	 * stamps rise just the same. Both are O(1) tail appends, the oldest/newest entry is whichever of the two heads/tails is older/newer. This lets cooldown checks and
+	 * occupancy eviction only ever look at the heads instead of scanning every inactive object. */
+	void AddInactive(int64 PoolID);
+	void RemoveInactive(int64 PoolID);
+	int64 GetOldestInactive() const { const int32 Slot = PickInactiveSlot(InactiveList.Head, BackdatedInactiveList.Head, true); return Slot != INDEX_NONE ? ObjectPool[Slot].ObjectPoolID : -1; }
+	int64 GetNewestInactive() const { const int32 Slot = PickInactiveSlot(InactiveList.Tail, BackdatedInactiveList.Tail, false); return Slot != INDEX_NONE ? ObjectPool[Slot].ObjectPoolID : -1; }
+	int32 GetNumInactive() const { return InactiveList.Num + BackdatedInactiveList.Num; }
+
+	/* Checked out objects ordered by checkout time (oldest at the head), only tracked once enabled since the recycling overflow policies are the only users.
+	 * Active objects aren't in any other list so this reuses the same intrusive links. */
+	void SetTrackActiveOrder(bool bTrack) { bTrackActiveOrder = bTrack; }
+	void AddActive(int64 PoolID);
+	void RemoveActive(int64 PoolID);
+	int64 GetOldestActive() const { return ActiveList.Head != INDEX_NONE ? ObjectPool[ActiveList.Head].ObjectPoolID : -1; }
+	// Lowest RecyclePriority among the MaxToConsider oldest active objects, the oldest wins ties. -1 if nothing is tracked.
+	int64 FindLowestPriorityActive(int32 MaxToConsider = MAX_int32) const;
+	// Only applies while the checkout is still current, returns false otherwise.
+	bool SetRecyclePriority(int32 SlotIndex, int32 CheckoutID, uint8 Priority);
+
+	/* Returns the checkout to the pool once Seconds of game time have passed, or runs OnExpired instead if bound, replacing any curfew it already has. False if the checkout is stale.
+	 * Curfews live in a timing wheel of BF.OP.CurfewResolution sized buckets advanced by the upkeep tick, instead of every object registering its own world timer,
+	 * so setting/clearing is O(1) and everything expiring in a frame is handled together. Curfews further out than one lap of the wheel just stay in their bucket until their lap. */
+	bool SetCurfew(int32 SlotIndex, int32 CheckoutID, float Seconds, FSimpleDelegate&& OnExpired);
+	bool ClearCurfew(int32 SlotIndex, int32 CheckoutID);
+	// Regardless of checkout, the pool calls this when the object is returned.
+	void ClearCurfew(int32 SlotIndex);
+	int32 GetNumCurfews() const { return Curfews.Num(); }
+
+	/* Queues the loaded assets (Niagara systems, static/skeletal meshes and materials, anything else is ignored) to have their PSOs precached, and in editor their Niagara
+	 * systems finish compiling, before pooled objects ever use them. With bHiddenActivation Niagara systems are also activated once on a never rendered component which
+	 * is destroyed on a later upkeep tick, so their renderers and GPU simulation are created up front too. */
+	void QueueAssetWarmup(TConstArrayView<TSoftObjectPtr<UObject>> Assets, bool bHiddenActivation);
+	// Warms queued assets until EndTime, at least one per call. Returns true while any are still queued.
+	bool TickAssetWarmup(double EndTime);
+	int32 GetNumPendingAssetWarmups() const { return PendingWarmupAssets.Num(); }
+
+	/* GC clusters the pooled objects (and whatever of their subobjects can be) with this container as the root, so reachability marks the whole pool at once instead of
+	 * traversing every object. Only objects whose class allows it join (CanBeInCluster). Created objects join on the next rebuild, the cluster is only dissolved
+	 * early when one of its members is destroyed or stolen. The upkeep tick rebuilds once no object has been created/released for BF.OP.GCClusterRebuildDelay seconds
+	 * and no prewarm/asset warmup is running, so steady state checkout/return never touches it. Only Object pools cluster (see bGCCluster), never in the editor. */
+	void SetClusterObjects(bool bEnabled);
+
+	// Starts (or restarts) recording demand for UBFObjectPoolSizingProfiles, nothing is recorded until this is called.
+	void BeginSizingRecording(UClass* PoolClass);
+	const FBFPoolSizingRecording* GetSizingRecording() const { return SizingRecording.Get(); }
+	FBFPoolSizingRecording* GetSizingRecording() { return SizingRecording.Get(); }
+	void RecordSizingActive(int32 NumActive) { if(SizingRecording.IsValid() && NumActive > SizingRecording->PeakActive) RecordSizingPeak(NumActive); }
+	void RecordSizingMisses(int32 NumMisses) { if(SizingRecording.IsValid()) SizingRecording->NumMisses += NumMisses; }
+	bool IsClusterBuilt() const { return HasAnyInternalFlags(EInternalObjectFlags::ClusterRoot); }
+
+	/* Tagged inactive objects are also bucketed by their cached tag, so tag queries are a bucket pop rather than a scan + reflective call per object.
+	 * Exact matching is a single map lookup, non exact matching also accepts child tags of the query (Bucket "A.B.C" matches query "A.B"). Returns -1 if nothing matches. */
+	int64 FindInactiveByTag(const FGameplayTag& Tag, bool bExactMatch) const;
+	int64 FindInactiveByTags(const FGameplayTagContainer& Tags, bool bExactMatch) const;
+
+	// Pool groups bucket their inactive objects by variant the same way, setting the variant of an inactive object moves it to the new bucket.
+	void SetVariant(int64 PoolID, int32 VariantIndex);
+	int64 FindInactiveByVariant(int32 VariantIndex) const;
+
+	/* Lite handle support, a slot index + checkout ID is enough to identify a single checkout of an object since checkout IDs carry on across slot reuse
+	 * (and are bumped on return/release), so validating is a bounds check and a single compare.
+	 * The checkout ID is read atomically since thread safe pools bump it from worker threads. */
+	FORCEINLINE bool IsCheckoutValid(int32 SlotIndex, int32 CheckoutID) const { return CheckoutID > -1 && IsValidSlotIndex(SlotIndex) && FPlatformAtomics::AtomicRead(&ObjectPool.GetData()[SlotIndex].ObjectCheckoutID) == CheckoutID; }
+	FORCEINLINE UObject* GetCheckedOutObject(int32 SlotIndex, int32 CheckoutID) const { return IsCheckoutValid(SlotIndex, CheckoutID) ? ObjectPool.GetData()[SlotIndex].PooledObject.Get() : nullptr; }
+	bool ReturnCheckedOutObject(int32 SlotIndex, int32 CheckoutID);
+	UObject* StealCheckedOutObject(int32 SlotIndex, int32 CheckoutID);
+
+	/* Worker thread access for thread safe pools, which reserve the slot array up front so it never reallocates and only ever touch slots they own (or the checkout ID atomically).
+	 * No generation or occupancy check, the checkout ID compare is what tells a worker its slot is still the one it checked out. */
+	FORCEINLINE FBFPooledObjectInfo* GetSlotConcurrent(int32 SlotIndex) { check(ConcurrentCapacity != INDEX_NONE); return SlotIndex >= 0 && SlotIndex < ConcurrentCapacity ? ObjectPool.GetData() + SlotIndex : nullptr; }
+	// Against the fixed concurrent capacity when workers may be reading, the game thread can be adding slots so the arrays Num isn't safe to read off it.
+	FORCEINLINE bool IsValidSlotIndex(int32 SlotIndex) const { return SlotIndex >= 0 && SlotIndex < (ConcurrentCapacity != INDEX_NONE ? ConcurrentCapacity : ObjectPool.Num()); }
+
+	// Walks both inactive lists merged from newest to oldest, return false from the predicate to stop early.
+	template<typename FuncType>
+	void ForEachInactiveNewestFirst(FuncType&& Func) const
+	{
+		int32 MainSlot = InactiveList.Tail;
+		int32 BackdatedSlot = BackdatedInactiveList.Tail;
+		while(MainSlot != INDEX_NONE || BackdatedSlot != INDEX_NONE)
+		{
+			const bool bTakeMain = PickInactiveSlot(MainSlot, BackdatedSlot, false) == MainSlot;
+			int32& Slot = bTakeMain ? MainSlot : BackdatedSlot;
+			const FBFPooledObjectInfo& Info = ObjectPool[Slot];
+			Slot = Info.PrevSlot; // Cache first so the predicate is free to unlink the current entry.
+			if(!Func(Info))
+				return;
+		}
+	}
 	
 public:
-	// Reflected container that stores each allocated object some info about them.
+	/* Reflected dense slot array that stores each allocated object and some info about them, indexed by the slot index encoded in the pool ID.
+	 * Unoccupied slots are chained together through NextSlot and reused before the array grows. */
 	UPROPERTY()
-	TMap<int64, FBFPooledObjectInfo> ObjectPool;
-
-	// Storing an array of inactive pool object IDs for quick querying.
-	TArray<int64> InactiveObjectIDPool;
+	TArray<FBFPooledObjectInfo> ObjectPool;
+	
+protected:
+	void LinkTail(FBFPoolSlotList& List, int32 Slot);
+	void LinkAfter(FBFPoolSlotList& List, int32 Slot, int32 AfterSlot);
+	void Unlink(FBFPoolSlotList& List, int32 Slot);
+	void UnlinkInactive(int32 Slot);
+	// The older (bOldest) or newer of two inactive list entries, either may be INDEX_NONE. Ties go to the main list.
+	FORCEINLINE int32 PickInactiveSlot(int32 MainSlot, int32 BackdatedSlot, bool bOldest) const
+	{
+		if(MainSlot == INDEX_NONE || BackdatedSlot == INDEX_NONE)
+			return MainSlot != INDEX_NONE ? MainSlot : BackdatedSlot;
+		
+		const float MainTime = ObjectPool[MainSlot].LastTimeActive;
+		const float BackdatedTime = ObjectPool[BackdatedSlot].LastTimeActive;
+		return (bOldest ? BackdatedTime < MainTime : BackdatedTime > MainTime) ? BackdatedSlot : MainSlot;
+	}
+	void LinkVariantBucket(int32 Slot);
+	void UnlinkVariantBucket(int32 Slot);
+	void AdvanceCurfews();
+	void WarmupAsset(UObject* Asset);
+	void ReleaseWarmupComponents();
+	void MarkClusterDirty();
+	void RebuildCluster();
+	bool IsClusterMember(const UObject* Object) const;
+	void RecordSizingPeak(int32 NumActive);
 	
 protected:
+	FBFPoolSlotList InactiveList;
+	FBFPoolSlotList BackdatedInactiveList; // Inactive objects stamped older than the main lists tail when added, see AddInactive.
+	FBFPoolSlotList ActiveList;
+	TMap<FGameplayTag, TArray<int32>> InactiveTagBuckets;
+	TArray<TArray<int32>> InactiveVariantBuckets;
+	TArray<TSharedPtr<SWidget>> RetainedSlateWidgets; // Indexed by slot, only virtualized widget pools use this.
+	int32 FirstFreeSlot = INDEX_NONE;
+	int32 NumPooledObjects = 0;
+	int32 ConcurrentCapacity = INDEX_NONE;
+	
 	float TickInterval = 1.f;
+	float TimeSinceExternalTick = 0.f;
+	uint8 bExternallyTicked : 1 = false;
+	uint8 bTrackActiveOrder : 1 = false;
+	uint8 bPoolUpkeepRequested : 1 = false;
+	uint8 bWarmupActivation : 1 = false;
+	uint8 bClusterObjects : 1 = false;
+	uint8 bClusterDirty : 1 = false;
+	double ClusterRebuildTime = 0.0; // Real time, the upkeep tick rebuilds the dirty cluster once past this.
+	TUniquePtr<FBFPoolSizingRecording> SizingRecording; // Only while recording.
+	
+	static constexpr int32 NumCurfewBuckets = 512;
+	TSparseArray<FBFPoolCurfew> Curfews;
+	TArray<int32> CurfewWheel; // Bucket heads, only allocated once something sets a curfew.
+	int64 CurfewTick = 0; // Last processed tick, tick N covers the game time up to N * CurfewTickSeconds.
+	double CurfewTickSeconds = 0.02;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> PendingWarmupAssets;
+	
+	// Hidden activations from QueueAssetWarmup, released once a frame has gone by since WarmupFrame.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UPrimitiveComponent>> WarmupComponents;
+	uint64 WarmupFrame = 0;
+	
 	TWeakObjectPtr<UWorld> OwningWorld;
 	TFunction<void(UWorld*, float)> OwningPoolTickFunc;
+	TFunction<bool(int64, int32)> OwningPoolReturnFunc;
+	TFunction<UObject*(int64, int32)> OwningPoolStealFunc;
+	TFunction<bool(float)> OwningPoolUpkeepFunc;
 	FBFPoolContainerTickFunction PrimaryContainerTick;
+	FBFPoolContainerTickFunction UpkeepContainerTick;
 };
 
 
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "BFObjectPooling/Pool/BFObjectPoolGroup.h"
 #include "BFObjectPoolBP.generated.h"
 
 
@@ -21,6 +22,18 @@ public: // Purposely not exposing to BP, use correct BPFL API.
 
 
 
+/* Blueprint struct wrapper for a pool group (TBFObjectPoolGroup), one pool shared by every subclass of its PoolClass.
+* Must use InitializeObjectPoolGroup() before trying to use it, GetObjectPoolFromGroup gives a regular BF Object Pool for everything that isn't variant specific. */
+USTRUCT(BlueprintType, meta = (DisplayName = "BF Object Pool Group"))
+struct BFOBJECTPOOLING_API FBFObjectPoolGroupBP
+{
+	GENERATED_BODY()
+	
+public: // Purposely not exposing to BP, use correct BPFL API.
+	UPROPERTY()
+	FBFObjectPoolInitParams InitInfo;
+	TBFObjectPoolGroupPtr<UObject, ESPMode::NotThreadSafe> PoolGroup;
+};
 
 
 
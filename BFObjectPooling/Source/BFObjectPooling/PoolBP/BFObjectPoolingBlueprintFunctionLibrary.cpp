@@ -5,6 +5,7 @@
 #include "BFObjectPooling/Pool/Private/BFObjectPoolHelpers.h"
 #include "BFPooledObjectHandleBP.h"
 #include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "BFObjectPooling/Pool/BFObjectPoolSubsystem.h"
 #include "BFObjectPooling/PoolBP/BFObjectPoolBP.h"
 
 #include "BFObjectPooling/GameplayActors/BFPoolable3DWidgetActor.h"
@@ -17,6 +18,46 @@
 
 
 
+namespace
+{
+	// The pool resolves its class on init (possibly from a soft class) so check what it actually ended up with rather than the BP structs copy of the params.
+	template<typename ActorType>
+	bool IsPoolOfActorType(const FBFObjectPoolBP& Pool)
+	{
+		return Pool.ObjectPool.IsValid() && Pool.ObjectPool->GetPoolInitInfo().PoolClass && Pool.ObjectPool->GetPoolInitInfo().PoolClass->IsChildOf<ActorType>();
+	}
+
+	
+	// Shared body of the QuickUnpool...Batch nodes, un-pools the whole batch up front then hands each actor its handle and transform.
+	template<typename ActorType, typename DescriptionType>
+	int32 QuickUnpoolActorBatch(FBFObjectPoolBP& Pool, const DescriptionType& InitParams, const TArray<FTransform>& ActorTransforms)
+	{
+		// You cannot call this function with a pool that is not for this specific actor.
+		bfEnsure(IsPoolOfActorType<ActorType>(Pool));
+		if(!IsPoolOfActorType<ActorType>(Pool) || ActorTransforms.IsEmpty())
+			return 0;
+
+		TArray<TBFPooledObjectHandlePtr<UObject, ESPMode::NotThreadSafe>> Handles;
+		const int32 NumUnpooled = Pool.ObjectPool->UnpoolObjects(ActorTransforms.Num(), Handles, false);
+		for(int32 Index = 0; Index < NumUnpooled; ++Index)
+		{
+			// An earlier actors activation could have returned a later one, skip any that are already stale.
+			if(!Handles[Index]->IsHandleValid())
+				continue;
+			
+			FBFPooledObjectHandleBP BPHandle;
+			BPHandle.Handle = Handles[Index];
+			BPHandle.PooledObjectID = Handles[Index]->GetPoolID();
+			BPHandle.ObjectCheckoutID = Handles[Index]->GetCheckoutID();
+			
+			auto* Actor = CastChecked<ActorType>(Handles[Index]->GetObject());
+			Actor->FireAndForgetBP(BPHandle, InitParams, ActorTransforms[Index]);
+		}
+		return NumUnpooled;
+	}
+}
+
+
 void UBFObjectPoolingBlueprintFunctionLibrary::InitializeObjectPool(FBFObjectPoolBP& Pool, const FBFObjectPoolInitParams& PoolInfo)
 {
 	// Ensure we aren't already valid or if we are then we must have 0 members, you need to clear your pool before re purposing it.
@@ -29,6 +70,91 @@ void UBFObjectPoolingBlueprintFunctionLibrary::InitializeObjectPool(FBFObjectPoo
 	Pool.ObjectPool->InitPool(Pool.InitInfo);
 }
 
+
+void UBFObjectPoolingBlueprintFunctionLibrary::InitializeObjectPoolAsync(FBFObjectPoolBP& Pool, const FBFObjectPoolInitParams& PoolInfo, FOnObjectPoolReady OnReady)
+{
+	bfEnsure(!Pool.ObjectPool.IsValid() || Pool.ObjectPool->GetPoolSize() == 0);
+	if(Pool.ObjectPool.IsValid() && Pool.ObjectPool->GetPoolSize() > 0)
+		return;
+	
+	Pool.InitInfo = PoolInfo;
+	Pool.ObjectPool = TBFObjectPool<UObject, ESPMode::NotThreadSafe>::CreatePool();
+	Pool.ObjectPool->GetOnPoolReady().AddLambda([OnReady](bool bSuccess)
+	{
+		OnReady.ExecuteIfBound(bSuccess);
+	});
+	Pool.ObjectPool->InitPoolAsync(Pool.InitInfo);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::InitializeObjectPoolGroup(FBFObjectPoolGroupBP& PoolGroup, const FBFObjectPoolInitParams& PoolInfo)
+{
+	bfEnsure(!PoolGroup.PoolGroup.IsValid() || PoolGroup.PoolGroup->GetPoolSize() == 0);
+	if(PoolGroup.PoolGroup.IsValid() && PoolGroup.PoolGroup->GetPoolSize() > 0)
+		return;
+	
+	PoolGroup.InitInfo = PoolInfo;
+	PoolGroup.PoolGroup = TBFObjectPoolGroup<UObject, ESPMode::NotThreadSafe>::CreatePool();
+	PoolGroup.PoolGroup->InitPool(PoolGroup.InitInfo);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::UnpoolObjectFromGroup(FBFObjectPoolGroupBP& PoolGroup, TSubclassOf<UObject> Class, const UObject* Description,
+	FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate)
+{
+	ReturnValue = BF::OP::ToBPSuccessEnum(false);
+	ReturnObject = nullptr;
+	FBFPooledObjectHandleBP Handle;
+	if(PoolGroup.PoolGroup.IsValid())
+		Handle.Handle = PoolGroup.PoolGroup->UnpoolObject(Class, Description, bAutoActivate);
+	
+	if(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid())
+	{
+		Handle.PooledObjectID = Handle.Handle->GetPoolID();
+		Handle.ObjectCheckoutID = Handle.Handle->GetCheckoutID();
+		ReturnValue = BF::OP::ToBPSuccessEnum(true);
+		ReturnObject = Handle.Handle->GetObject();
+	}
+	ObjectHandle = Handle;
+}
+
+
+int32 UBFObjectPoolingBlueprintFunctionLibrary::ReserveObjectPoolGroupVariant(FBFObjectPoolGroupBP& PoolGroup, TSubclassOf<UObject> Class, int32 Num, const UObject* Description)
+{
+	return PoolGroup.PoolGroup.IsValid() ? PoolGroup.PoolGroup->ReserveVariant(Class, Num, Description) : 0;
+}
+
+
+FBFObjectPoolBP UBFObjectPoolingBlueprintFunctionLibrary::GetObjectPoolFromGroup(FBFObjectPoolGroupBP& PoolGroup)
+{
+	FBFObjectPoolBP Pool;
+	Pool.InitInfo = PoolGroup.InitInfo;
+	Pool.ObjectPool = PoolGroup.PoolGroup;
+	return Pool;
+}
+
+
+bool UBFObjectPoolingBlueprintFunctionLibrary::IsObjectPoolReady(FBFObjectPoolBP& Pool)
+{
+	return Pool.ObjectPool.IsValid() && Pool.ObjectPool->IsPoolReady();
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::GetSharedObjectPool(const UObject* WorldContextObject, const FBFObjectPoolInitParams& PoolInfo, FName PoolKey, FBFObjectPoolBP& Pool, EBFSuccess& ReturnValue)
+{
+	ReturnValue = BF::OP::ToBPSuccessEnum(false);
+	UBFObjectPoolSubsystem* Subsystem = UBFObjectPoolSubsystem::Get(WorldContextObject);
+	if(!Subsystem)
+		return;
+
+	Pool.ObjectPool = Subsystem->GetSharedPool<UObject>(PoolInfo, PoolKey);
+	if(!Pool.ObjectPool.IsValid())
+		return;
+
+	Pool.InitInfo = Pool.ObjectPool->GetPoolInitInfo();
+	ReturnValue = BF::OP::ToBPSuccessEnum(true);
+}
+
 void UBFObjectPoolingBlueprintFunctionLibrary::UnpoolObject(FBFObjectPoolBP& Pool, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate)
 {
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
@@ -46,20 +172,67 @@ void UBFObjectPoolingBlueprintFunctionLibrary::UnpoolObject(FBFObjectPoolBP& Poo
 }
 
 
+void UBFObjectPoolingBlueprintFunctionLibrary::UnpoolWidget(FBFObjectPoolBP& Pool, UPanelWidget* Parent, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate)
+{
+	ReturnValue = BF::OP::ToBPSuccessEnum(false);
+	ReturnObject = nullptr;
+	FBFPooledObjectHandleBP Handle;
+	if(Pool.ObjectPool.IsValid())
+		Handle.Handle = Pool.ObjectPool->UnpoolWidget(Parent, bAutoActivate);
+	
+	if(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid())
+	{
+		Handle.PooledObjectID = Handle.Handle->GetPoolID();
+		Handle.ObjectCheckoutID = Handle.Handle->GetCheckoutID();
+		ReturnValue = BF::OP::ToBPSuccessEnum(true);
+		ReturnObject = Handle.Handle->GetObject();
+	}
+	ObjectHandle = Handle;
+}
+
+
 void UBFObjectPoolingBlueprintFunctionLibrary::UnpoolObjectByTag(FBFObjectPoolBP& Pool, FGameplayTag Tag,
-	 FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject,  bool bAutoActivate)
+	 FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject,  bool bAutoActivate, bool bExactMatch)
+{
+	FBFPooledObjectHandleBP BPHandle;
+
+	if(Pool.ObjectPool.IsValid())
+	{		
+		auto Handle = Pool.ObjectPool->UnpoolObjectByTag(Tag, bAutoActivate, bExactMatch);
+		if(Handle.IsValid() && Handle->IsHandleValid())
+		{
+			BPHandle.Handle = Handle;
+			BPHandle.PooledObjectID = Handle->GetPoolID();
+			BPHandle.ObjectCheckoutID = Handle->GetCheckoutID();
+			
+			ObjectHandle = BPHandle;
+			ReturnValue = BF::OP::ToBPSuccessEnum(true);
+			ReturnObject = Handle->GetObject();
+			return;
+		}
+	}
+
+	ObjectHandle = BPHandle;
+	ReturnValue = BF::OP::ToBPSuccessEnum(false);
+	ReturnObject = nullptr;
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::UnpoolObjectByTags(FBFObjectPoolBP& Pool, const FGameplayTagContainer& Tags,
+	FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate, bool bExactMatch)
 {
 	FBFPooledObjectHandleBP BPHandle;
 
 	if(Pool.ObjectPool.IsValid())
 	{		
-		auto Handle = Pool.ObjectPool->UnpoolObjectByTag(Tag, bAutoActivate);
+		auto Handle = Pool.ObjectPool->UnpoolObjectByTags(Tags, bAutoActivate, bExactMatch);
 		if(Handle.IsValid() && Handle->IsHandleValid())
 		{
 			BPHandle.Handle = Handle;
 			BPHandle.PooledObjectID = Handle->GetPoolID();
 			BPHandle.ObjectCheckoutID = Handle->GetCheckoutID();
 			
+			ObjectHandle = BPHandle;
 			ReturnValue = BF::OP::ToBPSuccessEnum(true);
 			ReturnObject = Handle->GetObject();
 			return;
@@ -84,6 +257,11 @@ bool UBFObjectPoolingBlueprintFunctionLibrary::ReturnPooledObject(FBFPooledObjec
 	return false;
 }
 
+bool UBFObjectPoolingBlueprintFunctionLibrary::SetPooledObjectRecyclePriority(FBFPooledObjectHandleBP& Handle, uint8 Priority)
+{
+	return Handle.Handle.IsValid() && Handle.Handle->SetRecyclePriority(Priority);
+}
+
 void UBFObjectPoolingBlueprintFunctionLibrary::GetObjectFromHandle(FBFPooledObjectHandleBP& Handle, UObject*& PooledObject, EBFSuccess& ReturnValue)
 {
 	if(Handle.Handle.IsValid() && Handle.Handle->IsHandleValid())
@@ -213,14 +391,57 @@ bool UBFObjectPoolingBlueprintFunctionLibrary::ClearObjectPoolInactiveObjects(FB
 }
 
 
+int32 UBFObjectPoolingBlueprintFunctionLibrary::ReserveObjectPool(FBFObjectPoolBP& Pool, int32 Num, float DeadlineSeconds)
+{
+	if(Pool.ObjectPool.IsValid())
+		return Pool.ObjectPool->Reserve(Num, DeadlineSeconds);
+	return 0;
+}
+
+
+bool UBFObjectPoolingBlueprintFunctionLibrary::IsObjectPoolPrewarming(FBFObjectPoolBP& Pool)
+{
+	return Pool.ObjectPool.IsValid() && Pool.ObjectPool->IsPrewarming();
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::FlushObjectPoolPrewarm(FBFObjectPoolBP& Pool)
+{
+	if(Pool.ObjectPool.IsValid())
+		Pool.ObjectPool->FlushPrewarm();
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::BindToObjectPoolPrewarmComplete(FBFObjectPoolBP& Pool, FOnObjectPoolPrewarmComplete OnComplete)
+{
+	if(!Pool.ObjectPool.IsValid())
+		return;
+	
+	if(!Pool.ObjectPool->IsPrewarming())
+	{
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	// One shot, the binding removes itself once fired so re-binding for a later Reserve doesn't stack.
+	TSharedRef<FDelegateHandle> BindingHandle = MakeShared<FDelegateHandle>();
+	*BindingHandle = Pool.ObjectPool->GetOnPrewarmComplete().AddLambda([OnComplete, BindingHandle, WeakPool = TWeakPtr<TBFObjectPool<UObject>>(Pool.ObjectPool)]()
+	{
+		OnComplete.ExecuteIfBound();
+		if(auto PinnedPool = WeakPool.Pin())
+			PinnedPool->GetOnPrewarmComplete().Remove(*BindingHandle);
+	});
+}
+
+
 void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolStaticMeshActor(FBFObjectPoolBP& Pool, const FBFPoolableStaticMeshActorDescription& InitParams, const FTransform& ActorTransform, EBFSuccess& ReturnValue,  UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableStaticMeshActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolableStaticMeshActor>(Pool));
 
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableStaticMeshActor>())
+	if(!IsPoolOfActorType<ABFPoolableStaticMeshActor>(Pool))
 		return;
 
 	FBFPooledObjectHandleBP BPHandle;
@@ -237,11 +458,11 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolSkeletalMeshActor(FBFO
 	const FBFPoolableSkeletalMeshActorDescription& InitParams, const FTransform& ActorTransform, EBFSuccess& ReturnValue, UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableSkeletalMeshActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolableSkeletalMeshActor>(Pool));
 	
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableSkeletalMeshActor>())
+	if(!IsPoolOfActorType<ABFPoolableSkeletalMeshActor>(Pool))
 		return;
 
 
@@ -259,11 +480,11 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolProjectileActor(FBFObj
 	const FBFPoolableProjectileActorDescription& InitParams, const FTransform& ActorTransform, EBFSuccess& ReturnValue, UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableProjectileActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolableProjectileActor>(Pool));
 
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableProjectileActor>())
+	if(!IsPoolOfActorType<ABFPoolableProjectileActor>(Pool))
 		return;
 
 	FBFPooledObjectHandleBP BPHandle;
@@ -280,11 +501,15 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolNiagaraActor(FBFObject
 	UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableNiagaraActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolableNiagaraActor>(Pool));
 
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableNiagaraActor>())
+	if(!IsPoolOfActorType<ABFPoolableNiagaraActor>(Pool))
+		return;
+
+	// Culled requests never touch the pool.
+	if(InitParams.bPreCullWithScalability && ABFPoolableNiagaraActor::WouldSystemBePreCulled(Pool.InitInfo.Owner.Get(), InitParams, ActorTransform.GetLocation()))
 		return;
 
 	FBFPooledObjectHandleBP BPHandle;
@@ -301,12 +526,16 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolSoundActor(FBFObjectPo
 	UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableSoundActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolableSoundActor>(Pool));
 	
 	
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableSoundActor>())
+	if(!IsPoolOfActorType<ABFPoolableSoundActor>(Pool))
+		return;
+
+	// Checked before touching the pool.
+	if(InitParams.bSkipIfInaudible && !ABFPoolableSoundActor::WouldSoundBeAudible(Pool.InitInfo.Owner.Get(), InitParams, ActorTransform.GetLocation()))
 		return;
 
 	FBFPooledObjectHandleBP BPHandle;
@@ -323,11 +552,11 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolDecalActor(FBFObjectPo
 	UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableDecalActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolableDecalActor>(Pool));
 
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolableDecalActor>())
+	if(!IsPoolOfActorType<ABFPoolableDecalActor>(Pool))
 		return;
 
 	FBFPooledObjectHandleBP BPHandle;
@@ -344,11 +573,11 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpool3DWidgetActor(FBFObjec
 	 UObject*& ReturnObject)
 {
 	// You cannot call this function with a pool that is not for this specific actor.
-	bfEnsure(Pool.InitInfo.PoolClass->IsChildOf<ABFPoolable3DWidgetActor>());
+	bfEnsure(IsPoolOfActorType<ABFPoolable3DWidgetActor>(Pool));
 	
 	ReturnObject = nullptr;
 	ReturnValue = BF::OP::ToBPSuccessEnum(false);
-	if(!Pool.ObjectPool.IsValid() || !Pool.InitInfo.PoolClass->IsChildOf<ABFPoolable3DWidgetActor>())
+	if(!IsPoolOfActorType<ABFPoolable3DWidgetActor>(Pool))
 		return;
 
 	FBFPooledObjectHandleBP BPHandle;
@@ -361,6 +590,93 @@ void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpool3DWidgetActor(FBFObjec
 }
 
 
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolStaticMeshActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolableStaticMeshActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolableStaticMeshActor>(Pool, InitParams, ActorTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolSkeletalMeshActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolableSkeletalMeshActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolableSkeletalMeshActor>(Pool, InitParams, ActorTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolProjectileActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolableProjectileActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolableProjectileActor>(Pool, InitParams, ActorTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolNiagaraActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolableNiagaraActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	if(!InitParams.bPreCullWithScalability || !IsPoolOfActorType<ABFPoolableNiagaraActor>(Pool))
+	{
+		NumUnpooled = QuickUnpoolActorBatch<ABFPoolableNiagaraActor>(Pool, InitParams, ActorTransforms);
+		ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+		return;
+	}
+
+	TArray<FTransform> VisibleTransforms;
+	VisibleTransforms.Reserve(ActorTransforms.Num());
+	for(const FTransform& Transform : ActorTransforms)
+	{
+		if(!ABFPoolableNiagaraActor::WouldSystemBePreCulled(Pool.InitInfo.Owner.Get(), InitParams, Transform.GetLocation()))
+			VisibleTransforms.Add(Transform);
+	}
+
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolableNiagaraActor>(Pool, InitParams, VisibleTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolSoundActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolableSoundActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	if(!InitParams.bSkipIfInaudible || !IsPoolOfActorType<ABFPoolableSoundActor>(Pool))
+	{
+		NumUnpooled = QuickUnpoolActorBatch<ABFPoolableSoundActor>(Pool, InitParams, ActorTransforms);
+		ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+		return;
+	}
+
+	// Filtered before un-pooling so only the audible ones take an actor. The voice budget is the devices, sounds from this batch only count once they start playing.
+	TArray<FTransform> AudibleTransforms;
+	AudibleTransforms.Reserve(ActorTransforms.Num());
+	for(const FTransform& Transform : ActorTransforms)
+	{
+		if(ABFPoolableSoundActor::WouldSoundBeAudible(Pool.InitInfo.Owner.Get(), InitParams, Transform.GetLocation()))
+			AudibleTransforms.Add(Transform);
+	}
+
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolableSoundActor>(Pool, InitParams, AudibleTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpoolDecalActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolableDecalActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolableDecalActor>(Pool, InitParams, ActorTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
+void UBFObjectPoolingBlueprintFunctionLibrary::QuickUnpool3DWidgetActorBatch(FBFObjectPoolBP& Pool,
+	const FBFPoolable3DWidgetActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled)
+{
+	NumUnpooled = QuickUnpoolActorBatch<ABFPoolable3DWidgetActor>(Pool, InitParams, ActorTransforms);
+	ReturnValue = BF::OP::ToBPSuccessEnum(NumUnpooled > 0);
+}
+
+
 void UBFObjectPoolingBlueprintFunctionLibrary::IsPooledObjectHandleValid(FBFPooledObjectHandleBP& Handle, EBFSuccess& ReturnValue, bool& bSuccess)
 {
 	bSuccess = Handle.Handle.IsValid() && Handle.Handle->IsHandleValid();
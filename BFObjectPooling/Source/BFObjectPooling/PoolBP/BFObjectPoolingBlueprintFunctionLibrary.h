@@ -9,6 +9,9 @@
 
 struct FBFPooledObjectHandleBP;
 
+DECLARE_DYNAMIC_DELEGATE(FOnObjectPoolPrewarmComplete);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnObjectPoolReady, bool, bSuccess);
+
 
 /** Blueprint Function library for interfacing with pooled objects from blueprint. */
 UCLASS(DisplayName = "BF Object Pooling Library")
@@ -64,6 +67,28 @@ public:
 	static void QuickUnpool3DWidgetActor(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolable3DWidgetActorDescription& InitParams, const FTransform& ActorTransform, EBFSuccess& ReturnValue, UObject*& ReturnObject);
 
 
+	/** Batch versions of the QuickUnpool nodes, un-pools one actor per transform in a single batch (one creation pass and one pool notification rather than one per actor)
+	 * and calls FireAndForget on each. NumUnpooled is less than the number of transforms if the pool ran out of capacity, fails only if nothing could be un-pooled. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpoolStaticMeshActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolableStaticMeshActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
+
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpoolSkeletalMeshActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolableSkeletalMeshActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
+
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpoolProjectileActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolableProjectileActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
+
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpoolNiagaraActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolableNiagaraActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
+
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpoolSoundActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolableSoundActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
+
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpoolDecalActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolableDecalActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
+
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void QuickUnpool3DWidgetActorBatch(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFPoolable3DWidgetActorDescription& InitParams, const TArray<FTransform>& ActorTransforms, EBFSuccess& ReturnValue, int32& NumUnpooled);
 
 
 
@@ -71,6 +96,46 @@ public:
 	// SUPER important and required by any pool before being able to use it.
 	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
 	static void InitializeObjectPool(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFObjectPoolInitParams& PoolInfo);
+
+
+	/* Same as InitializeObjectPool but first streams in the SoftPoolClass and AssetsToPreload without hitching, OnReady is called once the pool has finished
+	 * loading and prewarming (false if the class failed to load). Un-pooling before then is allowed but will create objects synchronously. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static void InitializeObjectPoolAsync(UPARAM(ref)FBFObjectPoolBP& Pool, const FBFObjectPoolInitParams& PoolInfo, FOnObjectPoolReady OnReady);
+
+
+	// Pool group version of InitializeObjectPool, PoolInfo's PoolClass is the common base class every variant un-pooled from the group must derive from.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static void InitializeObjectPoolGroup(UPARAM(ref)FBFObjectPoolGroupBP& PoolGroup, const FBFObjectPoolInitParams& PoolInfo);
+
+
+	/* Un-pools an object of exactly Class from the group, preferring one last un-pooled with the same Description (a preset or any other object you key activations by).
+	 * Falls back to an idle object of the same class you re-apply your description to, then a new object (trading away the oldest idle object of another class when at the limit),
+	 * only fails if every object in the group is in use. Same handle rules as UnpoolObject. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void UnpoolObjectFromGroup(UPARAM(ref)FBFObjectPoolGroupBP& PoolGroup, TSubclassOf<UObject> Class, const UObject* Description, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate = true);
+
+
+	// Creates up to Num inactive objects of the variant right away within the groups shared pool limit, returns how many were created.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static int32 ReserveObjectPoolGroupVariant(UPARAM(ref)FBFObjectPoolGroupBP& PoolGroup, TSubclassOf<UObject> Class, int32 Num, const UObject* Description = nullptr);
+
+
+	/* The group as a regular pool (same pool, not a copy) for the rest of the pool nodes, returning, limits, sizes, ticking... The plain un-pool nodes only hand out
+	 * PoolClass objects, tag un-pools can hand out any variant with the tag. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static FBFObjectPoolBP GetObjectPoolFromGroup(UPARAM(ref)FBFObjectPoolGroupBP& PoolGroup);
+
+
+	// True once the pool has loaded its assets and finished its initial prewarm.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static bool IsObjectPoolReady(UPARAM(ref)FBFObjectPoolBP& Pool);
+
+
+	/* Alternative to InitializeObjectPool, gets the worlds shared pool for the PoolInfo's class and PoolKey, only creating and initializing it the first time it is asked for.
+	 * Everything asking for the same class shares the one pool, it is ticked and kept under the global budget by the UBFObjectPoolSubsystem. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(WorldContext="WorldContextObject", ExpandEnumAsExecs="ReturnValue"))
+	static void GetSharedObjectPool(const UObject* WorldContextObject, const FBFObjectPoolInitParams& PoolInfo, FName PoolKey, FBFObjectPoolBP& Pool, EBFSuccess& ReturnValue);
 	
 
 	/* Attempts to un-pool an object, can only fail if the pool is at capacity and all objects are in use. The return ObjectHandle should be stored somewhere otherwise as soon as it exits scope the object will be returned,
@@ -78,12 +143,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
 	static void UnpoolObject(UPARAM(ref)FBFObjectPoolBP& Pool, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate = true);
 
+
+	/* UnpoolObject for widget pools with bVirtualizeWidgets, the widget is attached to Parent (left empty, the pools WidgetParent or the viewport) and detached again once returned.
+	 * Its Slate widget is reused, so attaching costs a slot rather than rebuilding the widget. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void UnpoolWidget(UPARAM(ref)FBFObjectPoolBP& Pool, UPanelWidget* Parent, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject, bool bAutoActivate = true);
+
 	
 	/* Attempts to un-pool the first matching object to the tag and return it via handle, if unable to locate a matching object or have no free objects function may fail. 
 	 * The handle is your responsibility to manage, once destroyed the handle will automatically return the object to the pool if it has not already been returned. You should not store the return object and always try
 	 * get it from the handle when using it as it may may be invalid due to another copy already returning the object or it being stolen. */
 	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
-	static void UnpoolObjectByTag(UPARAM(ref)FBFObjectPoolBP& Pool, FGameplayTag Tag, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject,  bool bAutoActivate = true);
+	static void UnpoolObjectByTag(UPARAM(ref)FBFObjectPoolBP& Pool, FGameplayTag Tag, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject,  bool bAutoActivate = true, bool bExactMatch = true);
+
+	
+	/* Same as UnpoolObjectByTag but un-pools the first inactive object whose tag matches any of the tags, if bExactMatch is false then
+	 * objects tagged with a child of any of the tags also match. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling", meta=(ExpandEnumAsExecs="ReturnValue"))
+	static void UnpoolObjectByTags(UPARAM(ref)FBFObjectPoolBP& Pool, const FGameplayTagContainer& Tags, FBFPooledObjectHandleBP& ObjectHandle, EBFSuccess& ReturnValue, UObject*& ReturnObject,  bool bAutoActivate = true, bool bExactMatch = true);
 
 	
 	// Returns null if the handle is invalid due to another copy already returning the object or the object was stolen from the pool.
@@ -103,6 +180,11 @@ public:
 	static bool ReturnPooledObject(UPARAM(ref)FBFPooledObjectHandleBP& Handle);
 
 
+	// Pools with the RecycleLowestPriority overflow policy recycle the lowest priority object first when at capacity, reset to 0 every un-pool. False if the handle is invalid or stale.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static bool SetPooledObjectRecyclePriority(UPARAM(ref)FBFPooledObjectHandleBP& Handle, uint8 Priority);
+
+
 	// Checks not only object validity but ensures IDs match in-case someone else was to return or steal the object.
 	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling",  meta=(ExpandEnumAsExecs="ReturnValue"))
 	static void IsPooledObjectHandleValid(UPARAM(ref)FBFPooledObjectHandleBP& Handle, EBFSuccess& ReturnValue, bool& bIsValid);
@@ -178,6 +260,25 @@ public:
 	static bool ClearObjectPoolInactiveObjects(UPARAM(ref)FBFObjectPoolBP& Pool);
 
 
+	/* Queues up creation so the pool has Num inactive objects ready, spread over the following frames within the pools PrewarmBudgetMs. If DeadlineSeconds is above 0
+	 * the pool goes faster as needed to be done by then (great ahead of a known burst), 0 creates them right away. Returns how many new objects were queued. */
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static int32 ReserveObjectPool(UPARAM(ref)FBFObjectPoolBP& Pool, int32 Num, float DeadlineSeconds = -1.f);
+
+
+	// True while the pool is still time slicing a prewarm/reserve.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static bool IsObjectPoolPrewarming(UPARAM(ref)FBFObjectPoolBP& Pool);
+
+
+	// Synchronously creates everything still queued for prewarming.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static void FlushObjectPoolPrewarm(UPARAM(ref)FBFObjectPoolBP& Pool);
+
+
+	// Calls OnComplete once the current prewarm finishes, or right away if the pool isn't prewarming.
+	UFUNCTION(BlueprintCallable, Category = "BF Object Pooling")
+	static void BindToObjectPoolPrewarmComplete(UPARAM(ref)FBFObjectPoolBP& Pool, FOnObjectPoolPrewarmComplete OnComplete);
 		
 
 	
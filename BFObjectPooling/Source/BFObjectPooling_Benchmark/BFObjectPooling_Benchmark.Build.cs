@@ -0,0 +1,28 @@
+﻿using UnrealBuildTool;
+
+public class BFObjectPooling_Benchmark : ModuleRules
+{
+    public BFObjectPooling_Benchmark(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+            }
+        );
+
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "CoreUObject",
+                "Engine",
+                "UMG",
+                "GameplayTags",
+                "DeveloperSettings",
+                "BFObjectPooling",
+            }
+        );
+    }
+}
\ No newline at end of file
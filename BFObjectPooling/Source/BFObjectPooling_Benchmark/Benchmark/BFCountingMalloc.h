@@ -0,0 +1,76 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "HAL/MemoryBase.h"
+
+
+namespace BF::OP
+{
+	/* Pass through allocator swapped in as GMalloc for the duration of a benchmark run, counts every Malloc/Realloc made on the game thread so scenarios can report
+	 * allocations per op without LLM or a memory tracing build. Other threads go straight through uncounted, the benchmarks only run game thread work.
+	 * Never destroyed, a thread that read GMalloc just before Uninstall can still safely call through it afterwards. */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		static FCountingMalloc& Get()
+		{
+			static FCountingMalloc* Instance = new FCountingMalloc();
+			return *Instance;
+		}
+
+		void Install()
+		{
+			check(IsInGameThread());
+			if(GMalloc == this)
+				return;
+
+			Inner = GMalloc;
+			FPlatformMisc::MemoryBarrier();
+			GMalloc = this;
+		}
+
+		void Uninstall()
+		{
+			check(IsInGameThread());
+			if(GMalloc == this) // Someone may have wrapped us since, leave them be.
+				GMalloc = Inner;
+		}
+
+		uint64 GetNumGameThreadAllocs() const { return NumGameThreadAllocs; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { RecordAlloc(); return Inner->Malloc(Count, Alignment); }
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { RecordAlloc(); return Inner->TryMalloc(Count, Alignment); }
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override { RecordAlloc(); return Inner->Realloc(Original, Count, Alignment); }
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override { RecordAlloc(); return Inner->TryRealloc(Original, Count, Alignment); }
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUsedOnCurrentThread() override { Inner->MarkTLSCachesAsUsedOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { Inner->MarkTLSCachesAsUnusedOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		FCountingMalloc() = default;
+
+		// Only the game thread ever writes, so no atomics.
+		void RecordAlloc()
+		{
+			if(IsInGameThread())
+				++NumGameThreadAllocs;
+		}
+
+		FMalloc* Inner = nullptr;
+		uint64 NumGameThreadAllocs = 0;
+	};
+}
@@ -0,0 +1,404 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolBenchmark.h"
+#include "BFCountingMalloc.h"
+#include "BFObjectPoolBenchmarkSettings.h"
+#include "BFObjectPoolBenchmarkTypes.h"
+#include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "BFObjectPooling/PoolBP/BFObjectPoolingBlueprintFunctionLibrary.h"
+#include "BFObjectPooling/GameplayActors/BFPoolable3DWidgetActor.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableDecalActor.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableNiagaraActor.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableProjectileActor.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableSkeletalMeshActor.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableSoundActor.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableStaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+
+namespace BF::OP
+{
+	static constexpr int32 BenchmarkWarmupOps = 16;
+	static constexpr int32 BenchmarkPoolSizes[] = {10, 100, 1000};
+
+	// Well away from anything in the level so the quick unpool actors don't collide or get culled differently run to run.
+	static const FTransform BenchmarkTransform(FVector(0.0, 0.0, 100000.0));
+}
+
+
+template<typename OpType>
+void FBFObjectPoolBenchmark::Measure(FSample& Sample, int32 NumOps, OpType&& Op)
+{
+	const BF::OP::FCountingMalloc& Malloc = BF::OP::FCountingMalloc::Get();
+	const uint64 StartAllocs = Malloc.GetNumGameThreadAllocs();
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	for(int32 i = 0; i < NumOps; ++i)
+		Op(i);
+
+	Sample.Cycles += FPlatformTime::Cycles64() - StartCycles;
+	Sample.NumAllocs += Malloc.GetNumGameThreadAllocs() - StartAllocs;
+	Sample.NumOps += NumOps;
+}
+
+
+template<typename OpType>
+void FBFObjectPoolBenchmark::MeasureWarm(FSample& Sample, int32 NumOps, OpType&& Op)
+{
+	FSample Warmup;
+	Measure(Warmup, FMath::Min(NumOps, BF::OP::BenchmarkWarmupOps), Op);
+	Measure(Sample, NumOps, Op);
+}
+
+
+void FBFObjectPoolBenchmark::Run()
+{
+	if(!World || !World->IsGameWorld())
+	{
+		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] BF.OP.Benchmark needs a game world (PIE, -game or a packaged build).");
+		return;
+	}
+
+	Results.Reset();
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags = RF_Transient;
+	Owner = World->SpawnActor<AActor>(AActor::StaticClass(), SpawnParams);
+
+	UE_LOGFMT(LogTemp, Display, "[BFObjectPool] Running benchmark, {0} iterations per scenario, filter '{1}'.", Settings.Iterations, Settings.NameFilter);
+
+	// Start every run from the same place, anything left from gameplay or a previous run shouldn't land in our first scenario.
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	BF::OP::FCountingMalloc& Malloc = BF::OP::FCountingMalloc::Get();
+	Malloc.Install();
+
+	RunThroughputScenarios();
+	RunHandleScenarios();
+	for(int32 NumObjects : BF::OP::BenchmarkPoolSizes)
+		RunCooldownScenarios(NumObjects);
+	for(int32 NumObjects : BF::OP::BenchmarkPoolSizes)
+		RunTagScenarios(NumObjects);
+	RunQuickUnpoolScenarios();
+
+	Malloc.Uninstall();
+
+	Owner->Destroy();
+	Owner = nullptr;
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	Report();
+}
+
+
+FBFObjectPoolInitParams FBFObjectPoolBenchmark::MakePoolParams(EBFPoolType PoolType, UClass* PoolClass, UObject* PoolOwner, int32 NumObjects) const
+{
+	FBFObjectPoolInitParams Params;
+	Params.Owner = PoolOwner;
+	Params.PoolClass = PoolClass;
+	Params.PoolType = PoolType;
+	Params.PoolLimit = NumObjects;
+	Params.InitialCount = NumObjects; // Always created up front, lazy creation would otherwise land in the first few timed ops.
+	return Params;
+}
+
+
+void FBFObjectPoolBenchmark::RunThroughputScenarios()
+{
+	auto RunScenario = [this]<typename T>(const FString& Name, TBFObjectPoolPtr<T> Pool, const FBFObjectPoolInitParams& Params, auto&& SpawnAndDestroy)
+	{
+		if(!ShouldRun(Name))
+			return;
+
+		Pool->InitPool(Params);
+
+		FResult Result{Name, 1};
+		MeasureWarm(Result.Pooled, Settings.Iterations, [&Pool](int32)
+		{
+			if(TBFPooledObjectHandlePtr<T> Handle = Pool->UnpoolObject(true))
+				Handle->ReturnToPool();
+		});
+		MeasureWarm(Result.Baseline, Settings.Iterations, SpawnAndDestroy);
+
+		Pool->ClearInactiveObjectsPool();
+		AddResult(MoveTemp(Result));
+	};
+
+	RunScenario(TEXT("Throughput/Actor"), TBFObjectPool<AActor>::CreatePool(), MakePoolParams(EBFPoolType::Actor, AActor::StaticClass(), Owner, 1), [this](int32)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = Owner;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		World->SpawnActor<AActor>(AActor::StaticClass(), SpawnParams)->Destroy();
+	});
+
+	RunScenario(TEXT("Throughput/Component"), TBFObjectPool<USceneComponent>::CreatePool(), MakePoolParams(EBFPoolType::Component, USceneComponent::StaticClass(), Owner, 1), [this](int32)
+	{
+		USceneComponent* Component = NewObject<USceneComponent>(Owner);
+		Component->bAutoActivate = false;
+		Owner->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+		Component->Activate(true);
+		Component->DestroyComponent();
+	});
+
+	if(APlayerController* PlayerController = World->GetFirstPlayerController())
+	{
+		RunScenario(TEXT("Throughput/UserWidget"), TBFObjectPool<UUserWidget>::CreatePool(), MakePoolParams(EBFPoolType::UserWidget, UBFObjectPoolBenchmarkWidget::StaticClass(), PlayerController, 1),
+			[PlayerController](int32)
+		{
+			UUserWidget* Widget = CreateWidget<UBFObjectPoolBenchmarkWidget>(PlayerController);
+			Widget->AddToViewport();
+			Widget->RemoveFromParent();
+		});
+	}
+	else if(ShouldRun(TEXT("Throughput/UserWidget")))
+	{
+		UE_LOGFMT(LogTemp, Display, "[BFObjectPool] Skipping Throughput/UserWidget, there is no local player controller to own the widgets.");
+	}
+
+	RunScenario(TEXT("Throughput/Object"), TBFObjectPool<UBFObjectPoolBenchmarkObject>::CreatePool(),
+		MakePoolParams(EBFPoolType::Object, UBFObjectPoolBenchmarkObject::StaticClass(), Owner, 1), [this](int32)
+	{
+		NewObject<UBFObjectPoolBenchmarkObject>(Owner)->MarkAsGarbage();
+	});
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS); // Flush every destroyed baseline object before the next set.
+}
+
+
+void FBFObjectPoolBenchmark::RunHandleScenarios()
+{
+	const FString SharedName = TEXT("Handle/Shared");
+	const FString LiteName = TEXT("Handle/Lite");
+	if(!ShouldRun(SharedName) && !ShouldRun(LiteName))
+		return;
+
+	TBFObjectPoolPtr<UBFObjectPoolBenchmarkObject> Pool = TBFObjectPool<UBFObjectPoolBenchmarkObject>::CreatePool();
+	Pool->InitPool(MakePoolParams(EBFPoolType::Object, UBFObjectPoolBenchmarkObject::StaticClass(), Owner, 1));
+
+	// Same pool and object, the only difference is the shared handle allocation and ref counting vs the lite value handle.
+	if(ShouldRun(SharedName))
+	{
+		FResult Shared{SharedName, 1};
+		MeasureWarm(Shared.Pooled, Settings.Iterations, [&Pool](int32)
+		{
+			if(TBFPooledObjectHandlePtr<UBFObjectPoolBenchmarkObject> Handle = Pool->UnpoolObject(false))
+				Handle->ReturnToPool();
+		});
+		AddResult(MoveTemp(Shared));
+	}
+
+	if(ShouldRun(LiteName))
+	{
+		FResult Lite{LiteName, 1};
+		MeasureWarm(Lite.Pooled, Settings.Iterations, [&Pool](int32)
+		{
+			TBFPooledObjectLiteHandle<UBFObjectPoolBenchmarkObject> Handle = Pool->UnpoolObjectLite(false);
+			Handle.ReturnToPool();
+		});
+		AddResult(MoveTemp(Lite));
+	}
+
+	Pool->ClearInactiveObjectsPool();
+}
+
+
+void FBFObjectPoolBenchmark::RunCooldownScenarios(int32 NumObjects)
+{
+	const FString HitName = FString::Printf(TEXT("Cooldown/Hit/%d"), NumObjects);
+	const FString RejectionName = FString::Printf(TEXT("Cooldown/Rejection/%d"), NumObjects);
+	if(!ShouldRun(HitName) && !ShouldRun(RejectionName))
+		return;
+
+	FResult Hit{HitName, NumObjects};
+	FResult Rejection{RejectionName, NumObjects};
+
+	/* World time doesn't move while we run, so each object only comes off cooldown once (thanks to the creation offset) and everything returned stays on cooldown.
+	 * Each round is a fresh full pool: un-pool every object (hits), return them all untimed, then try again with the entire pool on cooldown (rejections). */
+	TArray<TBFPooledObjectLiteHandle<UBFObjectPoolBenchmarkObject>> Handles;
+	Handles.Reserve(NumObjects);
+
+	const int32 NumRounds = FMath::Max(1, Settings.Iterations / NumObjects);
+	for(int32 Round = 0; Round < NumRounds; ++Round)
+	{
+		TBFObjectPoolPtr<UBFObjectPoolBenchmarkObject> Pool = TBFObjectPool<UBFObjectPoolBenchmarkObject>::CreatePool();
+		FBFObjectPoolInitParams Params = MakePoolParams(EBFPoolType::Object, UBFObjectPoolBenchmarkObject::StaticClass(), Owner, NumObjects);
+		Params.CooldownTimeSeconds = 1000.f;
+		Pool->InitPool(Params);
+
+		Measure(Hit.Pooled, NumObjects, [&Pool, &Handles](int32)
+		{
+			Handles.Add(Pool->UnpoolObjectLite(false));
+		});
+
+		Pool->ReturnToPool(MakeArrayView(Handles));
+		Handles.Reset();
+
+		Measure(Rejection.Pooled, NumObjects, [&Pool](int32)
+		{
+			Pool->UnpoolObjectLite(false); // Full pool and everything on cooldown, always comes back invalid.
+		});
+
+		Pool->ClearInactiveObjectsPool();
+	}
+
+	if(ShouldRun(HitName))
+		AddResult(MoveTemp(Hit));
+	if(ShouldRun(RejectionName))
+		AddResult(MoveTemp(Rejection));
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+
+void FBFObjectPoolBenchmark::RunTagScenarios(int32 NumObjects)
+{
+	const FString ExactName = FString::Printf(TEXT("Tag/Exact/%d"), NumObjects);
+	const FString ParentName = FString::Printf(TEXT("Tag/Parent/%d"), NumObjects);
+	if(!ShouldRun(ExactName) && !ShouldRun(ParentName))
+		return;
+
+	UBFObjectPoolBenchmarkObject::ResetTagRoundRobin();
+	TBFObjectPoolPtr<UBFObjectPoolBenchmarkObject> Pool = TBFObjectPool<UBFObjectPoolBenchmarkObject>::CreatePool();
+	Pool->InitPool(MakePoolParams(EBFPoolType::Object, UBFObjectPoolBenchmarkObject::StaticClass(), Owner, NumObjects));
+
+	if(ShouldRun(ExactName))
+	{
+		FResult Exact{ExactName, NumObjects};
+		MeasureWarm(Exact.Pooled, Settings.Iterations, [&Pool](int32 Index)
+		{
+			if(TBFPooledObjectHandlePtr<UBFObjectPoolBenchmarkObject> Handle = Pool->UnpoolObjectByTag(UBFObjectPoolBenchmarkObject::GetBenchmarkTag(Index), false, true))
+				Handle->ReturnToPool();
+		});
+		AddResult(MoveTemp(Exact));
+	}
+
+	if(ShouldRun(ParentName))
+	{
+		FResult Parent{ParentName, NumObjects};
+		const FGameplayTag ParentTag = UBFObjectPoolBenchmarkObject::GetBenchmarkParentTag();
+		MeasureWarm(Parent.Pooled, Settings.Iterations, [&Pool, &ParentTag](int32)
+		{
+			if(TBFPooledObjectHandlePtr<UBFObjectPoolBenchmarkObject> Handle = Pool->UnpoolObjectByTag(ParentTag, false, false))
+				Handle->ReturnToPool();
+		});
+		AddResult(MoveTemp(Parent));
+	}
+
+	Pool->ClearInactiveObjectsPool();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+
+template<typename ActorType, typename DescriptionType>
+void FBFObjectPoolBenchmark::RunQuickUnpool(const FString& Name, const DescriptionType& Description, bool bHasRequiredAssets,
+	void(*QuickUnpool)(FBFObjectPoolBP&, const DescriptionType&, const FTransform&, EBFSuccess&, UObject*&))
+{
+	if(!ShouldRun(Name))
+		return;
+
+	// Loading is not what we are measuring, get everything the description references in memory before timing.
+	TArray<TSoftObjectPtr<UObject>> Assets;
+	Description.AppendAssetsToPreload(Assets);
+	for(const TSoftObjectPtr<UObject>& Asset : Assets)
+		bHasRequiredAssets &= Asset.LoadSynchronous() != nullptr;
+
+	if(!bHasRequiredAssets)
+	{
+		UE_LOGFMT(LogTemp, Display, "[BFObjectPool] Skipping {0}, its description in the BF Object Pool Benchmark settings is missing an asset or one failed to load.", Name);
+		return;
+	}
+
+	FBFObjectPoolBP Pool;
+	UBFObjectPoolingBlueprintFunctionLibrary::InitializeObjectPool(Pool, MakePoolParams(EBFPoolType::Actor, ActorType::StaticClass(), Owner, 1));
+
+	FResult Result{Name, 1};
+	MeasureWarm(Result.Pooled, Settings.Iterations, [&Pool, &Description, QuickUnpool](int32)
+	{
+		EBFSuccess Success;
+		UObject* Object = nullptr;
+		QuickUnpool(Pool, Description, BF::OP::BenchmarkTransform, Success, Object);
+		if(ActorType* Actor = Cast<ActorType>(Object))
+			Actor->ReturnToPool();
+	});
+
+	// What you would be doing without a pool, spawn a fresh actor and then get rid of it.
+	MeasureWarm(Result.Baseline, Settings.Iterations, [this](int32)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = Owner;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		World->SpawnActor<ActorType>(ActorType::StaticClass(), BF::OP::BenchmarkTransform, SpawnParams)->Destroy();
+	});
+
+	Pool.ObjectPool->ClearInactiveObjectsPool();
+	AddResult(MoveTemp(Result));
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+
+void FBFObjectPoolBenchmark::RunQuickUnpoolScenarios()
+{
+	using FLibrary = UBFObjectPoolingBlueprintFunctionLibrary;
+	const UBFObjectPoolBenchmarkSettings* BenchmarkSettings = GetDefault<UBFObjectPoolBenchmarkSettings>();
+
+	RunQuickUnpool<ABFPoolableStaticMeshActor>(TEXT("QuickUnpool/StaticMeshActor"), BenchmarkSettings->StaticMeshActor,
+		!BenchmarkSettings->StaticMeshActor.Mesh.IsNull(), &FLibrary::QuickUnpoolStaticMeshActor);
+	RunQuickUnpool<ABFPoolableSkeletalMeshActor>(TEXT("QuickUnpool/SkeletalMeshActor"), BenchmarkSettings->SkeletalMeshActor,
+		!BenchmarkSettings->SkeletalMeshActor.Mesh.IsNull(), &FLibrary::QuickUnpoolSkeletalMeshActor);
+	RunQuickUnpool<ABFPoolableProjectileActor>(TEXT("QuickUnpool/ProjectileActor"), BenchmarkSettings->ProjectileActor,
+		true, &FLibrary::QuickUnpoolProjectileActor);
+	RunQuickUnpool<ABFPoolableNiagaraActor>(TEXT("QuickUnpool/NiagaraActor"), BenchmarkSettings->NiagaraActor,
+		!BenchmarkSettings->NiagaraActor.NiagaraSystem.IsNull(), &FLibrary::QuickUnpoolNiagaraActor);
+	RunQuickUnpool<ABFPoolableSoundActor>(TEXT("QuickUnpool/SoundActor"), BenchmarkSettings->SoundActor,
+		!BenchmarkSettings->SoundActor.Sound.IsNull(), &FLibrary::QuickUnpoolSoundActor);
+	RunQuickUnpool<ABFPoolableDecalActor>(TEXT("QuickUnpool/DecalActor"), BenchmarkSettings->DecalActor,
+		!BenchmarkSettings->DecalActor.DecalMaterial.IsNull(), &FLibrary::QuickUnpoolDecalActor);
+	RunQuickUnpool<ABFPoolable3DWidgetActor>(TEXT("QuickUnpool/3DWidgetActor"), BenchmarkSettings->WidgetActor,
+		!BenchmarkSettings->WidgetActor.WidgetClass.IsNull(), &FLibrary::QuickUnpool3DWidgetActor);
+}
+
+
+void FBFObjectPoolBenchmark::AddResult(FResult&& Result)
+{
+	Results.Add(MoveTemp(Result));
+}
+
+
+void FBFObjectPoolBenchmark::Report() const
+{
+	FString Csv = TEXT("Scenario,Objects,PooledNsPerOp,PooledAllocsPerOp,BaselineNsPerOp,BaselineAllocsPerOp\n");
+
+	UE_LOGFMT(LogTemp, Display, "[BFObjectPool] {0}", FString::Printf(TEXT("%-32s %8s %14s %14s %14s %14s %9s"),
+		TEXT("Scenario"), TEXT("Objects"), TEXT("Pooled ns/op"), TEXT("Pooled allocs"), TEXT("Spawn ns/op"), TEXT("Spawn allocs"), TEXT("Speedup")));
+
+	for(const FResult& Result : Results)
+	{
+		const bool bHasBaseline = Result.Baseline.IsSet();
+		const double PooledNs = Result.Pooled.GetNsPerOp();
+		const double BaselineNs = Result.Baseline.GetNsPerOp();
+
+		UE_LOGFMT(LogTemp, Display, "[BFObjectPool] {0}", bHasBaseline
+			? FString::Printf(TEXT("%-32s %8d %14.1f %14.2f %14.1f %14.2f %8.1fx"), *Result.Name, Result.NumObjects,
+				PooledNs, Result.Pooled.GetAllocsPerOp(), BaselineNs, Result.Baseline.GetAllocsPerOp(), PooledNs > 0.0 ? BaselineNs / PooledNs : 0.0)
+			: FString::Printf(TEXT("%-32s %8d %14.1f %14.2f %14s %14s %9s"), *Result.Name, Result.NumObjects,
+				PooledNs, Result.Pooled.GetAllocsPerOp(), TEXT("-"), TEXT("-"), TEXT("-")));
+
+		Csv += bHasBaseline
+			? FString::Printf(TEXT("%s,%d,%.2f,%.3f,%.2f,%.3f\n"), *Result.Name, Result.NumObjects, PooledNs, Result.Pooled.GetAllocsPerOp(), BaselineNs, Result.Baseline.GetAllocsPerOp())
+			: FString::Printf(TEXT("%s,%d,%.2f,%.3f,,\n"), *Result.Name, Result.NumObjects, PooledNs, Result.Pooled.GetAllocsPerOp());
+	}
+
+	const FString CsvPath = FPaths::ProfilingDir() / TEXT("BFObjectPool") / FString::Printf(TEXT("Benchmark-%s.csv"), *FDateTime::Now().ToString());
+	if(FFileHelper::SaveStringToFile(Csv, *CsvPath))
+		UE_LOGFMT(LogTemp, Display, "[BFObjectPool] Benchmark results written to {0}", IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*CsvPath));
+	else
+		UE_LOGFMT(LogTemp, Warning, "[BFObjectPool] Failed to write benchmark results to {0}", CsvPath);
+}
@@ -0,0 +1,79 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+struct FBFObjectPoolBP;
+struct FBFObjectPoolInitParams;
+enum class EBFPoolType : uint8;
+enum class EBFSuccess : uint8;
+
+
+/* Repeatable pooling vs spawning scenarios, run through the BF.OP.Benchmark console command. Every scenario reports ns/op and game thread allocations/op for the pooled path
+ * and where there is one, the raw SpawnActor/NewObject/CreateWidget path it replaces. Numbers are only meaningful relative to each other on the same machine and build config,
+ * run a Development (or Test) build rather than the editor for anything you intend to compare. */
+class FBFObjectPoolBenchmark
+{
+public:
+	struct FSettings
+	{
+		int32 Iterations = 1000;
+		FString NameFilter; // Substring match on the scenario name, empty runs everything.
+	};
+
+	FBFObjectPoolBenchmark(UWorld* InWorld, const FSettings& InSettings) : World(InWorld), Settings(InSettings) {}
+
+	void Run();
+
+private:
+	struct FSample
+	{
+		uint64 Cycles = 0;
+		uint64 NumAllocs = 0;
+		int64 NumOps = 0;
+
+		bool IsSet() const { return NumOps > 0; }
+		double GetNsPerOp() const { return IsSet() ? FPlatformTime::ToSeconds64(Cycles) * 1e9 / NumOps : 0.0; }
+		double GetAllocsPerOp() const { return IsSet() ? static_cast<double>(NumAllocs) / NumOps : 0.0; }
+	};
+
+	struct FResult
+	{
+		FString Name;
+		int32 NumObjects = 0;
+		FSample Pooled;
+		FSample Baseline; // Unset if there is nothing to compare against.
+	};
+
+	// Runs Op(Index) NumOps times and adds the elapsed time and allocations to Sample, Op should be one full unpool/return (or spawn/destroy) round trip.
+	template<typename OpType>
+	void Measure(FSample& Sample, int32 NumOps, OpType&& Op);
+
+	// Same as Measure but throws away a short warm up first so first use costs (lazy allocations, cold caches) don't skew small iteration counts.
+	template<typename OpType>
+	void MeasureWarm(FSample& Sample, int32 NumOps, OpType&& Op);
+
+	bool ShouldRun(const FString& Name) const { return Settings.NameFilter.IsEmpty() || Name.Contains(Settings.NameFilter); }
+	FBFObjectPoolInitParams MakePoolParams(EBFPoolType PoolType, UClass* PoolClass, UObject* Owner, int32 NumObjects) const;
+
+	void RunThroughputScenarios();
+	void RunHandleScenarios();
+	void RunCooldownScenarios(int32 NumObjects);
+	void RunTagScenarios(int32 NumObjects);
+	void RunQuickUnpoolScenarios();
+
+	template<typename ActorType, typename DescriptionType>
+	void RunQuickUnpool(const FString& Name, const DescriptionType& Description, bool bHasRequiredAssets,
+		void(*QuickUnpool)(FBFObjectPoolBP&, const DescriptionType&, const FTransform&, EBFSuccess&, UObject*&));
+
+	void AddResult(FResult&& Result);
+	void Report() const;
+
+	UWorld* World = nullptr;
+	AActor* Owner = nullptr; // Owns every pool (and component) the scenarios make, spawned and destroyed by Run.
+	FSettings Settings;
+	TArray<FResult> Results;
+};
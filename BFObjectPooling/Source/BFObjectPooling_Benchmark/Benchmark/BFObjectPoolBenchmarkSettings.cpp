@@ -0,0 +1,17 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolBenchmarkSettings.h"
+#include "BFObjectPoolBenchmarkTypes.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+
+
+UBFObjectPoolBenchmarkSettings::UBFObjectPoolBenchmarkSettings()
+{
+	StaticMeshActor.Mesh = TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Engine/BasicShapes/Cube.Cube")));
+	SkeletalMeshActor.Mesh = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Engine/EngineMeshes/SkeletalCube.SkeletalCube")));
+	DecalActor.DecalMaterial = TSoftObjectPtr<UMaterialInterface>(FSoftObjectPath(TEXT("/Engine/EngineMaterials/DefaultDeferredDecalMaterial.DefaultDeferredDecalMaterial")));
+	WidgetActor.WidgetClass = UBFObjectPoolBenchmarkWidget::StaticClass();
+}
@@ -0,0 +1,44 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Engine/DeveloperSettings.h"
+#include "BFObjectPooling/GameplayActors/BFPoolableActorHelpers.h"
+#include "BFObjectPoolBenchmarkSettings.generated.h"
+
+
+/* Descriptions the BF.OP.Benchmark QuickUnpool scenarios fire their actors with (Project Settings > Plugins > BF Object Pool Benchmark).
+ * Defaults point at engine content where there is something suitable, a scenario whose required asset is unset or fails to load is skipped and logged. */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "BF Object Pool Benchmark"))
+class UBFObjectPoolBenchmarkSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UBFObjectPoolBenchmarkSettings();
+
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolableStaticMeshActorDescription StaticMeshActor;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolableSkeletalMeshActorDescription SkeletalMeshActor;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolableProjectileActorDescription ProjectileActor;
+
+	// There is no engine Niagara system to default to, set one to include this scenario.
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolableNiagaraActorDescription NiagaraActor;
+
+	// There is no engine sound to default to, set one to include this scenario.
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolableSoundActorDescription SoundActor;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolableDecalActorDescription DecalActor;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Quick Unpool")
+	FBFPoolable3DWidgetActorDescription WidgetActor;
+};
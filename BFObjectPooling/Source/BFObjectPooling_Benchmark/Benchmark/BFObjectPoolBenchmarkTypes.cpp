@@ -0,0 +1,43 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolBenchmarkTypes.h"
+#include "NativeGameplayTags.h"
+
+
+namespace BF::OP
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark, "BFObjectPool.Benchmark");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_A, "BFObjectPool.Benchmark.A");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_B, "BFObjectPool.Benchmark.B");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_C, "BFObjectPool.Benchmark.C");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Benchmark_D, "BFObjectPool.Benchmark.D");
+}
+
+
+int32 UBFObjectPoolBenchmarkObject::NextTagIndex = 0;
+
+
+FGameplayTag UBFObjectPoolBenchmarkObject::GetBenchmarkTag(int32 Index)
+{
+	static_assert(NumBenchmarkTags == 4);
+	switch(Index % NumBenchmarkTags)
+	{
+		case 0: return BF::OP::TAG_Benchmark_A;
+		case 1: return BF::OP::TAG_Benchmark_B;
+		case 2: return BF::OP::TAG_Benchmark_C;
+		default: return BF::OP::TAG_Benchmark_D;
+	}
+}
+
+
+FGameplayTag UBFObjectPoolBenchmarkObject::GetBenchmarkParentTag()
+{
+	return BF::OP::TAG_Benchmark;
+}
+
+
+void UBFObjectPoolBenchmarkObject::OnObjectCreated_Implementation()
+{
+	Tag = GetBenchmarkTag(NextTagIndex++);
+}
@@ -0,0 +1,41 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "Blueprint/UserWidget.h"
+#include "BFObjectPooling/Interfaces/BFPooledObjectInterface.h"
+#include "BFObjectPoolBenchmarkTypes.generated.h"
+
+
+// Plain pooled object for the Object pool scenarios, hands out the benchmark tags round robin on creation so the tag lookups have an even spread.
+UCLASS(Transient, NotBlueprintable)
+class UBFObjectPoolBenchmarkObject : public UObject, public IBFPooledObjectInterface
+{
+	GENERATED_BODY()
+
+public:
+	// Leaf tags under BFObjectPool.Benchmark, objects cycle through these.
+	static constexpr int32 NumBenchmarkTags = 4;
+	static FGameplayTag GetBenchmarkTag(int32 Index);
+	static FGameplayTag GetBenchmarkParentTag();
+
+	// Call before creating a pool so every run hands out the same tags in the same order.
+	static void ResetTagRoundRobin() { NextTagIndex = 0; }
+
+protected:
+	virtual void OnObjectCreated_Implementation() override;
+	virtual FGameplayTag GetObjectGameplayTag_Implementation() override { return Tag; }
+
+	UPROPERTY()
+	FGameplayTag Tag;
+
+	static int32 NextTagIndex;
+};
+
+
+// UUserWidget is abstract, this is the smallest widget we can create for the UserWidget and 3D widget actor scenarios.
+UCLASS(Transient, NotBlueprintable)
+class UBFObjectPoolBenchmarkWidget : public UUserWidget
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,40 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+
+#include "BFObjectPooling_Benchmark.h"
+#include "BFObjectPooling_Benchmark/Benchmark/BFObjectPoolBenchmark.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#define LOCTEXT_NAMESPACE "FBFObjectPooling_BenchmarkModule"
+
+namespace BF::OP
+{
+	// Headless: -ExecCmds="BF.OP.Benchmark 1000, Quit" on a packaged development build or UnrealEditor-Cmd.exe <Project> <Map> -game -nullrhi.
+	static FAutoConsoleCommandWithWorldAndArgs CmdObjectPoolBenchmark(TEXT("BF.OP.Benchmark"),
+		TEXT("Runs the pooling vs spawning benchmark scenarios in this world and logs ns/op and allocations/op, results are also written to Saved/Profiling/BFObjectPool. Args: [Iterations=1000] [NameFilter]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			FBFObjectPoolBenchmark::FSettings Settings;
+			if(Args.Num() > 0)
+				Settings.Iterations = FMath::Max(1, FCString::Atoi(*Args[0]));
+			if(Args.Num() > 1)
+				Settings.NameFilter = Args[1];
+
+			FBFObjectPoolBenchmark Benchmark(World, Settings);
+			Benchmark.Run();
+		}));
+}
+
+void FBFObjectPooling_BenchmarkModule::StartupModule()
+{
+}
+
+void FBFObjectPooling_BenchmarkModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+    
+IMPLEMENT_MODULE(FBFObjectPooling_BenchmarkModule, BFObjectPooling_Benchmark)
\ No newline at end of file
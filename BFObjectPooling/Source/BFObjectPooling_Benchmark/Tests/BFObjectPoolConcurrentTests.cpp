@@ -0,0 +1,94 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolTestHelpers.h"
+#include "Async/ParallelFor.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBFObjectPoolConcurrentRoundTripTest, "BFObjectPooling.Concurrent.CheckoutReturnRoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+bool FBFObjectPoolConcurrentRoundTripTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 Reserve = 4;
+	BF::OP::FScopedTestWorld TestWorld;
+	{
+		TBFObjectPoolPtr<UBFObjectPoolTestObject, ESPMode::ThreadSafe> Pool = TBFObjectPool<UBFObjectPoolTestObject, ESPMode::ThreadSafe>::CreatePool();
+		FBFObjectPoolInitParams Params = BF::OP::MakeTestPoolParams(TestWorld.World, Reserve * 2);
+		Params.ConcurrentReserve = Reserve;
+		Pool->InitPool(Params);
+
+		// The upkeep would fill the ready stack next frame, flush instead of ticking the world.
+		Pool->FlushConcurrentOps();
+		TestEqual(TEXT("Ready stack is filled to the reserve"), Pool->GetNumConcurrentReady(), Reserve);
+		TestEqual(TEXT("Staged objects are neither active nor inactive"), Pool->GetActivePoolSize() + Pool->GetInactivePoolSize(), 0);
+
+		TArray<TBFPooledObjectLiteHandle<UBFObjectPoolTestObject>> Handles;
+		Handles.SetNum(Reserve);
+		ParallelFor(Reserve, [&Pool, &Handles](int32 Index) { Handles[Index] = Pool->UnpoolObjectConcurrent(true); });
+
+		TestEqual(TEXT("Every worker popped an object"), Handles.FilterByPredicate([](const auto& Handle) { return Handle.IsHandleValid(); }).Num(), Reserve);
+		TestEqual(TEXT("Worker checkouts only count as active once replayed"), Pool->GetActivePoolSize(), 0);
+		TestFalse(TEXT("Popping from an empty ready stack misses"), Pool->UnpoolObjectConcurrent(true).IsHandleValid());
+
+		Pool->FlushConcurrentOps();
+		TestEqual(TEXT("Replayed checkouts are active"), Pool->GetActivePoolSize(), Reserve);
+		TestEqual(TEXT("Ready stack is topped back up"), Pool->GetNumConcurrentReady(), Reserve);
+		TestEqual(TEXT("Restocking grew the pool to its limit"), Pool->GetPoolSize(), Reserve * 2);
+		for(const TBFPooledObjectLiteHandle<UBFObjectPoolTestObject>& Handle : Handles)
+			TestTrue(TEXT("Replayed checkouts are activated once"), Handle.IsHandleValid() && Handle->NumUnPooled == 1 && Handle->NumPooled == 0);
+
+		TArray<UBFObjectPoolTestObject*> Objects;
+		for(const TBFPooledObjectLiteHandle<UBFObjectPoolTestObject>& Handle : Handles)
+			Objects.Add(Handle.GetObject());
+
+		// Copies so the stale originals can be checked against afterwards.
+		TArray<TBFPooledObjectLiteHandle<UBFObjectPoolTestObject>> ReturnHandles = Handles;
+		std::atomic<int32> NumReturned = 0;
+		ParallelFor(Reserve, [&ReturnHandles, &NumReturned](int32 Index)
+		{
+			if(ReturnHandles[Index].ReturnToPool())
+				NumReturned.fetch_add(1, std::memory_order_relaxed);
+		});
+
+		TestEqual(TEXT("Every worker return won its checkout"), NumReturned.load(), Reserve);
+		TestEqual(TEXT("Returned handles are stale straight away"), Handles.FilterByPredicate([](const auto& Handle) { return Handle.IsHandleValid(); }).Num(), 0);
+		TestFalse(TEXT("A stale copy can't return the object again"), Handles[0].ReturnToPool());
+
+		Pool->FlushConcurrentOps();
+		TestEqual(TEXT("Replayed returns are no longer active"), Pool->GetActivePoolSize(), 0);
+		TestEqual(TEXT("Replayed returns are inactive"), Pool->GetInactivePoolSize(), Reserve);
+		for(const UBFObjectPoolTestObject* Object : Objects)
+			TestTrue(TEXT("Replayed returns are deactivated once"), Object->NumUnPooled == 1 && Object->NumPooled == 1);
+
+		// A game thread return of a checkout that hasn't been replayed yet must still see it activated first.
+		TBFPooledObjectLiteHandle<UBFObjectPoolTestObject> PendingHandle = Pool->UnpoolObjectConcurrent(true);
+		UBFObjectPoolTestObject* PendingObject = PendingHandle.GetObject();
+		if(TestNotNull(TEXT("Pending checkout has an object"), PendingObject))
+		{
+			const int32 NumUnPooledBefore = PendingObject->NumUnPooled;
+			TestTrue(TEXT("Pending checkout can be returned on the game thread"), PendingHandle.ReturnToPool());
+			TestEqual(TEXT("Pending checkout isn't activated before it is replayed"), PendingObject->NumUnPooled, NumUnPooledBefore);
+
+			Pool->FlushConcurrentOps();
+			TestEqual(TEXT("Pending checkout is activated then deactivated"), PendingObject->NumUnPooled - PendingObject->NumPooled, 0);
+			TestEqual(TEXT("Pending checkout was activated exactly once"), PendingObject->NumUnPooled, NumUnPooledBefore + 1);
+			TestEqual(TEXT("Nothing is left active"), Pool->GetActivePoolSize(), 0);
+		}
+
+		// Stealing a checkout that hasn't been replayed yet must leave the staged count and ready stack alone.
+		TBFPooledObjectLiteHandle<UBFObjectPoolTestObject> StolenHandle = Pool->UnpoolObjectConcurrent(true);
+		const int32 PoolSizeBeforeSteal = Pool->GetPoolSize();
+		if(TestNotNull(TEXT("Pending checkout can be stolen"), StolenHandle.StealObject()))
+		{
+			TestEqual(TEXT("Stolen object left the pool"), Pool->GetPoolSize(), PoolSizeBeforeSteal - 1);
+			TestEqual(TEXT("Only the ready stack is still staged"), Pool->GetNumConcurrentStaged(), Pool->GetNumConcurrentReady());
+			TestEqual(TEXT("Stealing leaves nothing active"), Pool->GetActivePoolSize(), 0);
+		}
+	}
+	return true;
+}
+
+
+#endif
@@ -0,0 +1,68 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#include "BFObjectPoolTestHelpers.h"
+#include "BFObjectPooling/Pool/BFObjectPoolGroup.h"
+#include "Algo/AllOf.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBFObjectPoolGroupVariantTest, "BFObjectPooling.Group.VariantSelection", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+bool FBFObjectPoolGroupVariantTest::RunTest(const FString& Parameters)
+{
+	UClass* BaseClass = UBFObjectPoolTestObject::StaticClass();
+	UClass* ChildClass = UBFObjectPoolTestObjectChild::StaticClass();
+	// Descriptions are only compared, any object will do.
+	const UObject* DescriptionA = GetDefault<UBFObjectPoolTestObject>();
+	const UObject* DescriptionB = GetDefault<UBFObjectPoolTestObjectChild>();
+	
+	BF::OP::FScopedTestWorld TestWorld;
+	{
+		TBFObjectPoolGroupPtr<UBFObjectPoolTestObject> Group = TBFObjectPoolGroup<UBFObjectPoolTestObject>::CreatePool();
+		Group->InitPool(BF::OP::MakeTestPoolParams(TestWorld.World, 4));
+		TestEqual(TEXT("ReserveVariant creates the requested objects"), Group->ReserveVariant(ChildClass, 2), 2);
+
+		// Plain un-pools must not hand out the idle child objects.
+		TBFPooledObjectHandlePtr<UBFObjectPoolTestObject> BaseHandle = Group->UnpoolObject(true);
+		if(!TestTrue(TEXT("Plain un-pool succeeds"), BaseHandle.IsValid() && BaseHandle->IsHandleValid()))
+			return false;
+		TestTrue(TEXT("Plain un-pool is exactly the PoolClass"), BaseHandle->GetObject()->GetClass() == BaseClass);
+		TestEqual(TEXT("Plain un-pool created a PoolClass object"), Group->GetPoolSize(), 3);
+
+		TBFPooledObjectHandlePtr<UBFObjectPoolTestObject> HandleA = Group->UnpoolObject(ChildClass, DescriptionA, false);
+		TBFPooledObjectHandlePtr<UBFObjectPoolTestObject> HandleB = Group->UnpoolObject(ChildClass, DescriptionB, false);
+		if(!TestTrue(TEXT("Variant un-pools succeed"), HandleA.IsValid() && HandleB.IsValid()))
+			return false;
+		UBFObjectPoolTestObject* ObjectA = HandleA->GetObject();
+		UBFObjectPoolTestObject* ObjectB = HandleB->GetObject();
+		TestTrue(TEXT("Variant un-pools are of the asked class"), ObjectA->GetClass() == ChildClass && ObjectB->GetClass() == ChildClass);
+		TestEqual(TEXT("Idle objects of the class are reused under another description"), Group->GetPoolSize(), 3);
+
+		// B is the newest idle object, the exact description still has to win.
+		HandleA->ReturnToPool();
+		HandleB->ReturnToPool();
+		HandleA = Group->UnpoolObject(ChildClass, DescriptionA, false);
+		TestTrue(TEXT("The object last un-pooled with the description is preferred"), HandleA.IsValid() && HandleA->GetObject() == ObjectA);
+		HandleA->ReturnToPool();
+
+		// Idle: one PoolClass object and the two children. The second plain un-pool creates, the third has to trade an idle child at the limit.
+		BaseHandle->ReturnToPool();
+		TArray<TBFPooledObjectHandlePtr<UBFObjectPoolTestObject>> BaseHandles;
+		for(int32 i = 0; i < 3; ++i)
+			BaseHandles.Add(Group->UnpoolObject(true));
+
+		TestEqual(TEXT("Every plain un-pool succeeds within the shared limit"), BaseHandles.FilterByPredicate([](const auto& Handle) { return Handle.IsValid() && Handle->IsHandleValid(); }).Num(), 3);
+		TestTrue(TEXT("Each is exactly the PoolClass"), Algo::AllOf(BaseHandles, [BaseClass](const auto& Handle) { return Handle.IsValid() && Handle->GetObject()->GetClass() == BaseClass; }));
+		TestEqual(TEXT("The group never grows past its limit"), Group->GetPoolSize(), 4);
+		TestEqual(TEXT("An idle child was traded for the last one"), Group->GetInactivePoolSize(), 1);
+
+		for(TBFPooledObjectHandlePtr<UBFObjectPoolTestObject>& Handle : BaseHandles)
+			Handle->ReturnToPool();
+	}
+	return true;
+}
+
+
+#endif
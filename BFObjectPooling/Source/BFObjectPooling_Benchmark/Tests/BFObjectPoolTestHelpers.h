@@ -0,0 +1,48 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "BFObjectPoolTestTypes.h"
+#include "BFObjectPooling/Pool/BFObjectPool.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+
+namespace BF::OP
+{
+	// Throwaway game world the test pools are owned by, pools must be gone before it is destroyed.
+	struct FScopedTestWorld
+	{
+		FScopedTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+			World->InitializeActorsForPlay(FURL());
+			World->BeginPlay();
+		}
+
+		~FScopedTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		UWorld* World = nullptr;
+	};
+
+	inline FBFObjectPoolInitParams MakeTestPoolParams(UWorld* World, int32 PoolLimit)
+	{
+		FBFObjectPoolInitParams Params;
+		Params.Owner = World;
+		Params.PoolClass = UBFObjectPoolTestObject::StaticClass();
+		Params.PoolType = EBFPoolType::Object;
+		Params.PoolLimit = PoolLimit;
+		return Params;
+	}
+}
+
+
+#endif
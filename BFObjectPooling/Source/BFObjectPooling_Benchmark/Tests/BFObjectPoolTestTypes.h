@@ -0,0 +1,30 @@
+﻿// Copyright (c) 2024 Jack Holland 
+// Licensed under the MIT License. See LICENSE.md file in repo root for full license information.
+
+#pragma once
+#include "BFObjectPooling/Interfaces/BFPooledObjectInterface.h"
+#include "BFObjectPoolTestTypes.generated.h"
+
+
+// Plain pooled object for the automation tests, counts the interface events so tests can check every activation is paired with a deactivation.
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class UBFObjectPoolTestObject : public UObject, public IBFPooledObjectInterface
+{
+	GENERATED_BODY()
+
+public:
+	int32 NumUnPooled = 0;
+	int32 NumPooled = 0;
+
+protected:
+	virtual void OnObjectUnPooled_Implementation() override { ++NumUnPooled; }
+	virtual void OnObjectPooled_Implementation() override { ++NumPooled; }
+};
+
+
+// Second class for the pool group tests, a variant of UBFObjectPoolTestObject.
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class UBFObjectPoolTestObjectChild : public UBFObjectPoolTestObject
+{
+	GENERATED_BODY()
+};